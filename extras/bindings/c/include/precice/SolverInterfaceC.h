@@ -218,6 +218,22 @@ void precicec_getMeshVertices(
     const int *ids,
     double *   positions);
 
+/**
+ * @brief Moves existing vertices of a provided mesh to new positions.
+ *
+ * @param[in] meshID the id of the mesh to move the vertices of
+ * @param[in] size Number of vertices to move
+ * @param[in] ids The ids of the vertices to move
+ * @param[in] positions a pointer to the new coordinates of the vertices
+ *            The 2D-format is (d0x, d0y, d1x, d1y, ..., dnx, dny)
+ *            The 3D-format is (d0x, d0y, d0z, d1x, d1y, d1z, ..., dnx, dny, dnz)
+ */
+void precicec_setMeshVertexCoordinates(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions);
+
 /**
  * @brief Gets mesh vertex IDs from positions.
  *
@@ -303,6 +319,44 @@ void precicec_setMeshQuadWithEdges(
     int thirdVertexID,
     int fourthVertexID);
 
+/**
+ * @brief Sets multiple mesh edges from vertex IDs.
+ *
+ * @param[in] meshID ID of the mesh to add the edges to
+ * @param[in] size Number of edges to create
+ * @param[in] vertices the IDs of the vertices of the edges, two per edge
+ * @param[out] ids the IDs of the created edges
+ */
+void precicec_setMeshEdges(
+    int        meshID,
+    int        size,
+    const int *vertices,
+    int *      ids);
+
+/**
+ * @brief Sets multiple triangles from vertex IDs. Creates missing edges.
+ *
+ * @param[in] meshID ID of the mesh to add the triangles to
+ * @param[in] size Number of triangles to create
+ * @param[in] vertices the IDs of the vertices of the triangles, three per triangle
+ */
+void precicec_setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertices);
+
+/**
+ * @brief Sets multiple surface mesh quadrangles from vertex IDs. Creates missing edges.
+ *
+ * @param[in] meshID ID of the mesh to add the quadrangles to
+ * @param[in] size Number of quadrangles to create
+ * @param[in] vertices the IDs of the vertices of the quadrangles, four per quadrangle
+ */
+void precicec_setMeshQuads(
+    int        meshID,
+    int        size,
+    const int *vertices);
+
 ///@}
 
 ///@name Data Access
@@ -476,6 +530,20 @@ void precicec_getMeshVerticesAndIDs(
     int *     ids,
     double *  coordinates);
 
+/**
+ * @brief See precice::SolverInterface::getWriteDataBuffer().
+ */
+double *precicec_getWriteDataBuffer(
+    int  dataID,
+    int *size);
+
+/**
+ * @brief See precice::SolverInterface::getReadDataBuffer().
+ */
+const double *precicec_getReadDataBuffer(
+    int  dataID,
+    int *size);
+
 ///@}
 
 #ifdef __cplusplus
@@ -216,6 +216,16 @@ void precicec_getMeshVertices(
   impl->getMeshVertices(meshID, size, ids, positions);
 }
 
+void precicec_setMeshVertexCoordinates(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshVertexCoordinates(meshID, size, ids, positions);
+}
+
 void precicec_setMeshVertices(
     int           meshID,
     int           size,
@@ -294,6 +304,34 @@ void precicec_setMeshQuadWithEdges(
   impl->setMeshQuadWithEdges(meshID, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
 }
 
+void precicec_setMeshEdges(
+    int        meshID,
+    int        size,
+    const int *vertices,
+    int *      ids)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshEdges(meshID, size, vertices, ids);
+}
+
+void precicec_setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertices)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshTriangles(meshID, size, vertices);
+}
+
+void precicec_setMeshQuads(
+    int        meshID,
+    int        size,
+    const int *vertices)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshQuads(meshID, size, vertices);
+}
+
 void precicec_writeBlockVectorData(
     int           dataID,
     int           size,
@@ -418,6 +456,22 @@ void precicec_getMeshVerticesAndIDs(
   impl->getMeshVerticesAndIDs(meshID, size, ids, coordinates);
 }
 
+double *precicec_getWriteDataBuffer(
+    int  dataID,
+    int *size)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  return impl->getWriteDataBuffer(dataID, *size);
+}
+
+const double *precicec_getReadDataBuffer(
+    int  dataID,
+    int *size)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  return impl->getReadDataBuffer(dataID, *size);
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
@@ -432,6 +432,26 @@ void precicef_get_vertices_(
     int *      ids,
     double *   positions);
 
+/**
+ * Fortran syntax:
+ * precicef_set_vertex_coordinates(
+ *   INTEGER          meshID,
+ *   INTEGER          size,
+ *   INTEGER          ids(size),
+ *   DOUBLE PRECISION positions(dim*size))
+ *
+ * IN:  meshID, size, ids, positions
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::setMeshVertexCoordinates()
+ *
+ */
+void precicef_set_vertex_coordinates_(
+    const int *   meshID,
+    const int *   size,
+    const int *   ids,
+    const double *positions);
+
 /**
  * Fortran syntax:
  * precicef_get_vertices(
@@ -556,6 +576,62 @@ void precicef_set_quad_we_(
     const int *thirdVertexID,
     const int *fourthVertexID);
 
+/**
+ * Fortran syntax:
+ * precicef_set_edges(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertices(2*size),
+ *   INTEGER edgeIDs(size) )
+ *
+ * IN:  meshID, size, vertices
+ * OUT: edgeIDs
+ *
+ * @copydoc precice::SolverInterface::setMeshEdges()
+ *
+ */
+void precicef_set_edges_(
+    const int *meshID,
+    const int *size,
+    const int *vertices,
+    int *      edgeIDs);
+
+/**
+ * Fortran syntax:
+ * precicef_set_triangles(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertices(3*size) )
+ *
+ * IN:  meshID, size, vertices
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::setMeshTriangles()
+ *
+ */
+void precicef_set_triangles_(
+    const int *meshID,
+    const int *size,
+    const int *vertices);
+
+/**
+ * Fortran syntax:
+ * precicef_set_quads(
+ *   INTEGER meshID,
+ *   INTEGER size,
+ *   INTEGER vertices(4*size) )
+ *
+ * IN:  meshID, size, vertices
+ * OUT: -
+ *
+ * @copydoc precice::SolverInterface::setMeshQuads()
+ *
+ */
+void precicef_set_quads_(
+    const int *meshID,
+    const int *size,
+    const int *vertices);
+
 /**
  * Fortran syntax:
  * precicef_write_bvdata(
@@ -805,6 +881,44 @@ void precicef_get_mesh_vertices_and_IDs_(
     int *     ids,
     double *  coordinates);
 
+/**
+ * Fortran syntax:
+ * precicef_get_write_data_buffer_(
+ *   INTEGER     dataID,
+ *   TYPE(C_PTR) buffer,
+ *   INTEGER     size)
+ *
+ * IN:  dataID
+ * OUT: buffer, size
+ *
+ * The buffer can be accessed with C_F_POINTER(buffer, values, [size]).
+ *
+ * @copydoc precice::SolverInterface::getWriteDataBuffer()
+ */
+void precicef_get_write_data_buffer_(
+    const int *dataID,
+    double **  buffer,
+    int *      size);
+
+/**
+ * Fortran syntax:
+ * precicef_get_read_data_buffer_(
+ *   INTEGER     dataID,
+ *   TYPE(C_PTR) buffer,
+ *   INTEGER     size)
+ *
+ * IN:  dataID
+ * OUT: buffer, size
+ *
+ * The buffer can be accessed with C_F_POINTER(buffer, values, [size]).
+ *
+ * @copydoc precice::SolverInterface::getReadDataBuffer()
+ */
+void precicef_get_read_data_buffer_(
+    const int *     dataID,
+    const double **buffer,
+    int *           size);
+
 ///@}
 
 #ifdef __cplusplus
@@ -323,6 +323,16 @@ void precicef_get_vertices_(
   impl->getMeshVertices(*meshID, *size, ids, positions);
 }
 
+void precicef_set_vertex_coordinates_(
+    const int *   meshID,
+    const int *   size,
+    const int *   ids,
+    const double *positions)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshVertexCoordinates(*meshID, *size, ids, positions);
+}
+
 void precicef_get_vertex_ids_from_positions_(
     const int *meshID,
     const int *size,
@@ -385,6 +395,34 @@ void precicef_set_quad_we_(
   impl->setMeshQuadWithEdges(*meshID, *firstVertexID, *secondVertexID, *thirdVertexID, *fourthVertexID);
 }
 
+void precicef_set_edges_(
+    const int *meshID,
+    const int *size,
+    const int *vertices,
+    int *      edgeIDs)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshEdges(*meshID, *size, vertices, edgeIDs);
+}
+
+void precicef_set_triangles_(
+    const int *meshID,
+    const int *size,
+    const int *vertices)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshTriangles(*meshID, *size, vertices);
+}
+
+void precicef_set_quads_(
+    const int *meshID,
+    const int *size,
+    const int *vertices)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  impl->setMeshQuads(*meshID, *size, vertices);
+}
+
 void precicef_write_bvdata_(
     const int *dataID,
     const int *size,
@@ -548,6 +586,24 @@ void precicef_get_mesh_vertices_and_IDs_(
   impl->getMeshVerticesAndIDs(meshID, size, ids, coordinates);
 }
 
+void precicef_get_write_data_buffer_(
+    const int *dataID,
+    double **  buffer,
+    int *      size)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  *buffer = impl->getWriteDataBuffer(*dataID, *size);
+}
+
+void precicef_get_read_data_buffer_(
+    const int *     dataID,
+    const double **buffer,
+    int *           size)
+{
+  PRECICE_CHECK(impl != nullptr, errormsg);
+  *buffer = impl->getReadDataBuffer(*dataID, *size);
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace precice {
+namespace benchmarks {
+
+/// A named micro-benchmark, which reports its results itself
+struct Benchmark {
+  std::string           name;
+  std::function<void()> run;
+};
+
+/// Returns all registered benchmarks
+std::vector<Benchmark> &registry();
+
+/**
+ * @brief Registers a benchmark.
+ *
+ * Intended to initialize a static variable in the translation unit of the benchmark.
+ */
+bool registerBenchmark(std::string name, std::function<void()> run);
+
+/// Prints the throughput of a benchmark variant
+void report(const std::string &variant, double items, double seconds, const std::string &unit);
+
+/// Returns the number of bytes currently allocated on the heap by operator new
+std::size_t allocatedBytes();
+
+/// Keeps the compiler from discarding the computation of value
+void doNotOptimize(double value);
+
+/**
+ * @brief Measures the mean wall-clock time of a function.
+ *
+ * The function is repeated until at least minimalDuration seconds have elapsed.
+ *
+ * @returns mean time per call in seconds
+ */
+template <typename Function>
+double measure(Function &&function, double minimalDuration = 0.5)
+{
+  using Clock      = std::chrono::steady_clock;
+  const auto start = Clock::now();
+  int        runs  = 0;
+
+  std::chrono::duration<double> elapsed{0.0};
+  do {
+    function();
+    ++runs;
+    elapsed = Clock::now() - start;
+  } while (elapsed.count() < minimalDuration);
+  return elapsed.count() / runs;
+}
+
+} // namespace benchmarks
+} // namespace precice
@@ -0,0 +1,136 @@
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmarks/Benchmark.hpp"
+#include "math/barycenter.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+#include "utils/fmt.hpp"
+
+using namespace precice;
+using namespace precice::math::barycenter;
+
+namespace {
+
+/// Number of candidates per location, as used by the nearest-projection mapping
+constexpr int CANDIDATES = 4;
+
+/// Compares the scalar barycentric coordinates of candidate triangles to the batched kernel
+void benchmarkKernels(int locations)
+{
+  const BatchedCorners  a = BatchedCorners::Random(locations * CANDIDATES, 3);
+  const BatchedCorners  b = BatchedCorners::Random(locations * CANDIDATES, 3);
+  const BatchedCorners  c = BatchedCorners::Random(locations * CANDIDATES, 3);
+  const Eigen::MatrixXd l = Eigen::MatrixXd::Random(3, locations);
+
+  std::vector<Eigen::VectorXd> normals;
+  for (int i = 0; i < a.rows(); ++i) {
+    const Eigen::Vector3d ab = b.row(i) - a.row(i);
+    const Eigen::Vector3d ac = c.row(i) - a.row(i);
+    normals.emplace_back(ab.cross(ac).normalized());
+  }
+
+  const double candidates = static_cast<double>(a.rows());
+  const auto   variant    = [&](const std::string &kind) {
+    return fmt::format("triangles candidates={} {}", CANDIDATES, kind);
+  };
+
+  benchmarks::report(variant("scalar"), candidates, benchmarks::measure([&] {
+                       double sum = 0.0;
+                       for (int i = 0; i < a.rows(); ++i) {
+                         const Eigen::VectorXd location = l.col(i / CANDIDATES);
+                         sum += calcBarycentricCoordsForTriangle(a.row(i).transpose(), b.row(i).transpose(), c.row(i).transpose(), normals[i], location)
+                                    .barycentricCoords[0];
+                       }
+                       benchmarks::doNotOptimize(sum);
+                     }),
+                     "candidates");
+
+  BatchedCorners blockA(CANDIDATES, 3), blockB(CANDIDATES, 3), blockC(CANDIDATES, 3), coords(CANDIDATES, 3);
+  benchmarks::report(variant("batched"), candidates, benchmarks::measure([&] {
+                       double sum = 0.0;
+                       for (int i = 0; i < locations; ++i) {
+                         blockA = a.middleRows<CANDIDATES>(i * CANDIDATES);
+                         blockB = b.middleRows<CANDIDATES>(i * CANDIDATES);
+                         blockC = c.middleRows<CANDIDATES>(i * CANDIDATES);
+                         calcBarycentricCoordsForTriangles(blockA, blockB, blockC, l.col(i), coords);
+                         sum += coords(0, 0);
+                       }
+                       benchmarks::doNotOptimize(sum);
+                     }),
+                     "candidates");
+}
+
+/// Creates a triangulated wavy surface with size x size quads
+mesh::PtrMesh surfaceMesh(int size)
+{
+  auto mesh = std::make_shared<mesh::Mesh>("Surface", 3, 0);
+  for (int i = 0; i <= size; ++i) {
+    for (int j = 0; j <= size; ++j) {
+      const double x = static_cast<double>(i) / size;
+      const double y = static_cast<double>(j) / size;
+      mesh->createVertex(Eigen::Vector3d(x, y, 0.1 * std::sin(6 * x) * std::cos(4 * y)));
+    }
+  }
+  auto vertex = [&](int i, int j) -> mesh::Vertex & { return mesh->vertices()[i * (size + 1) + j]; };
+  for (int i = 0; i < size; ++i) {
+    for (int j = 0; j < size; ++j) {
+      auto &bottom   = mesh->createEdge(vertex(i, j), vertex(i + 1, j));
+      auto &right    = mesh->createEdge(vertex(i + 1, j), vertex(i + 1, j + 1));
+      auto &top      = mesh->createEdge(vertex(i, j + 1), vertex(i + 1, j + 1));
+      auto &left     = mesh->createEdge(vertex(i, j), vertex(i, j + 1));
+      auto &diagonal = mesh->createEdge(vertex(i, j), vertex(i + 1, j + 1));
+      mesh->createTriangle(bottom, right, diagonal);
+      mesh->createTriangle(left, top, diagonal);
+    }
+  }
+  return mesh;
+}
+
+/// Measures the nearest projections of the vertices of a shifted mesh, as done by the nearest-projection mapping
+void benchmarkProjections(int size)
+{
+  auto mesh = surfaceMesh(size);
+
+  std::vector<double> locations;
+  for (const auto &vertex : mesh->vertices()) {
+    locations.push_back(vertex.getCoords()[0] + 0.3 / size);
+    locations.push_back(vertex.getCoords()[1] + 0.6 / size);
+    locations.push_back(vertex.getCoords()[2] + 0.01);
+  }
+
+  query::Index index(mesh);
+  index.findNearestProjection(Eigen::Vector3d(0.5, 0.5, 0.5), CANDIDATES);
+
+  const double queries = mesh->vertices().size();
+  benchmarks::report(fmt::format("projection triangles={} single", mesh->triangles().size()), queries, benchmarks::measure([&] {
+                       double sum = 0.0;
+                       for (std::size_t i = 0; i < mesh->vertices().size(); ++i) {
+                         sum += index.findNearestProjection(Eigen::Vector3d(locations[3 * i], locations[3 * i + 1], locations[3 * i + 2]), CANDIDATES).distance;
+                       }
+                       benchmarks::doNotOptimize(sum);
+                     }),
+                     "queries");
+  benchmarks::report(fmt::format("projection triangles={} batched", mesh->triangles().size()), queries, benchmarks::measure([&] {
+                       benchmarks::doNotOptimize(index.findNearestProjectionBatched(locations, CANDIDATES).front().distance);
+                     }),
+                     "queries");
+}
+
+void run()
+{
+  benchmarkKernels(10000);
+  benchmarkProjections(100);
+  benchmarkProjections(200);
+}
+
+const bool registered = benchmarks::registerBenchmark("projection", run);
+
+} // namespace
@@ -0,0 +1,97 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "benchmarks/Benchmark.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/EigenHelperFunctions.hpp"
+#include "utils/fmt.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+
+namespace {
+
+/// Fills the mesh with quasi-random vertices in the unit cube
+void fillMesh(mesh::Mesh &mesh, int size, double seed)
+{
+  for (int i = 0; i < size; ++i) {
+    Eigen::VectorXd coords(mesh.getDimensions());
+    for (int d = 0; d < mesh.getDimensions(); ++d) {
+      coords[d] = std::fmod(seed + (i + 1) * (0.7548776662 + 0.2451223338 * d), 1.0);
+    }
+    mesh.createVertex(coords);
+  }
+}
+
+/// Assembles the evaluation matrix entry by entry on reduced coordinates, as done before the assembly kernels
+template <typename RBF>
+Eigen::MatrixXd scalarMatrixA(const RBF &basisFunction, const mesh::Mesh &inMesh, const mesh::Mesh &outMesh, const std::vector<bool> &deadAxis)
+{
+  const int inSize     = inMesh.vertices().size();
+  const int outSize    = outMesh.vertices().size();
+  const int polyparams = 1 + inMesh.getDimensions() - std::count(deadAxis.begin(), deadAxis.end(), true);
+
+  Eigen::MatrixXd matrixA = Eigen::MatrixXd::Zero(outSize, inSize + polyparams);
+  for (int i = 0; i < outSize; ++i) {
+    for (int j = 0; j < inSize; ++j) {
+      const auto &u = outMesh.vertices()[i].getCoords();
+      const auto &v = inMesh.vertices()[j].getCoords();
+      matrixA(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
+    }
+    const auto reduced = utils::reduceVector(outMesh.vertices()[i].getCoords(), deadAxis);
+    for (int dim = 0; dim < polyparams - 1; dim++) {
+      matrixA(i, inSize + 1 + dim) = reduced[dim];
+    }
+    matrixA(i, inSize) = 1.0;
+  }
+  return matrixA;
+}
+
+template <typename RBF>
+void benchmarkAssembly(const std::string &name, const RBF &basisFunction, int dimensions, const std::vector<bool> &deadAxis, int size)
+{
+  mesh::Mesh inMesh("InMesh", dimensions, 0);
+  mesh::Mesh outMesh("OutMesh", dimensions, 1);
+  fillMesh(inMesh, size, 0.0);
+  fillMesh(outMesh, size, 0.5);
+
+  const int    polyparams = 1 + dimensions - std::count(deadAxis.begin(), deadAxis.end(), true);
+  const double entriesA   = static_cast<double>(size) * (size + polyparams);
+  const double entriesC   = static_cast<double>(size + polyparams) * (size + polyparams);
+  const auto   variant    = [&](const std::string &matrix) {
+    return fmt::format("{} {}D dead={} n={} {}", name, dimensions, std::count(deadAxis.begin(), deadAxis.end(), true), size, matrix);
+  };
+
+  benchmarks::report(variant("A scalar"), entriesA, benchmarks::measure([&] {
+                       benchmarks::doNotOptimize(scalarMatrixA(basisFunction, inMesh, outMesh, deadAxis)(0, 0));
+                     }),
+                     "entries");
+  benchmarks::report(variant("A kernel"), entriesA, benchmarks::measure([&] {
+                       benchmarks::doNotOptimize(buildMatrixA(basisFunction, inMesh, outMesh, deadAxis)(0, 0));
+                     }),
+                     "entries");
+  benchmarks::report(variant("C kernel"), entriesC, benchmarks::measure([&] {
+                       benchmarks::doNotOptimize(buildMatrixCLU(basisFunction, inMesh, deadAxis)(0, 0));
+                     }),
+                     "entries");
+}
+
+void run()
+{
+  for (int size : {500, 2000}) {
+    benchmarkAssembly("thin-plate-splines", ThinPlateSplines(), 3, {false, false, false}, size);
+    benchmarkAssembly("thin-plate-splines", ThinPlateSplines(), 3, {false, false, true}, size);
+    benchmarkAssembly("thin-plate-splines", ThinPlateSplines(), 2, {false, false}, size);
+    benchmarkAssembly("gaussian", Gaussian(5.0), 3, {false, false, false}, size);
+    benchmarkAssembly("compact-polynomial-c6", CompactPolynomialC6(0.3), 3, {false, false, false}, size);
+  }
+}
+
+const bool registered = benchmarks::registerBenchmark("rbf-assembly", run);
+
+} // namespace
@@ -0,0 +1,161 @@
+#include <Eigen/Core>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "benchmarks/Benchmark.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "query/Index.hpp"
+#include "query/impl/Indexer.hpp"
+#include "query/impl/VertexIndex.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/fmt.hpp"
+
+using namespace precice;
+
+namespace {
+
+/// Number of queries per measurement
+constexpr int QUERIES = 20000;
+
+/// Creates quasi-random vertices in the unit cube
+mesh::PtrMesh volumeMesh(int size)
+{
+  auto mesh = std::make_shared<mesh::Mesh>("Volume", 3, 0);
+  for (int i = 0; i < size; ++i) {
+    mesh->createVertex(Eigen::Vector3d(std::fmod((i + 1) * 0.7548776662, 1.0),
+                                       std::fmod((i + 1) * 0.5698402910, 1.0),
+                                       std::fmod((i + 1) * 0.4301597090, 1.0)));
+  }
+  return mesh;
+}
+
+/// Creates vertices on the surface of a cylinder, which resembles a coupling interface
+mesh::PtrMesh surfaceMesh(int size)
+{
+  auto      mesh   = std::make_shared<mesh::Mesh>("Surface", 3, 1);
+  const int layers = static_cast<int>(std::sqrt(size));
+  for (int i = 0; i < size; ++i) {
+    const double angle = 2 * M_PI * (i % layers) / layers;
+    mesh->createVertex(Eigen::Vector3d(std::cos(angle), std::sin(angle), static_cast<double>(i / layers) / layers));
+  }
+  return mesh;
+}
+
+/**
+ * @brief Reads the vertices of a real interface mesh from the file given by PRECICE_BENCHMARK_MESH.
+ *
+ * The file contains the three coordinates of one vertex per line.
+ */
+mesh::PtrMesh fileMesh()
+{
+  const char *filename = std::getenv("PRECICE_BENCHMARK_MESH");
+  if (not filename) {
+    return nullptr;
+  }
+  auto            mesh = std::make_shared<mesh::Mesh>("File", 3, 2);
+  std::ifstream   file(filename);
+  Eigen::Vector3d coords;
+  while (file >> coords[0] >> coords[1] >> coords[2]) {
+    mesh->createVertex(coords);
+  }
+  if (mesh->vertices().empty()) {
+    std::cerr << "  Could not read any vertex from " << filename << '\n';
+    return nullptr;
+  }
+  return mesh;
+}
+
+/// Query locations scattered around the vertices of the mesh
+Eigen::MatrixXd queryLocations(const mesh::Mesh &mesh)
+{
+  Eigen::MatrixXd locations(3, QUERIES);
+  const int       size = mesh.vertices().size();
+  for (int i = 0; i < QUERIES; ++i) {
+    const auto &coords = mesh.vertices()[(i * 7919) % size].getCoords();
+    locations.col(i)   = coords + 0.01 * Eigen::Vector3d(std::fmod(i * 0.618, 1.0), std::fmod(i * 0.382, 1.0), std::fmod(i * 0.236, 1.0));
+  }
+  return locations;
+}
+
+void benchmarkBackend(const std::string &name, const mesh::PtrMesh &mesh, query::IndexBackend backend, utils::ThreadPool *pool)
+{
+  const auto variant = [&](const std::string &what) {
+    return fmt::format("{} n={} {}{} {}", mesh->getName(), mesh->vertices().size(), name, pool ? " parallel" : "", what);
+  };
+  query::setIndexBackend(*mesh, backend);
+
+  const double buildTime = benchmarks::measure([&] {
+    query::clearCache(mesh->getID());
+    benchmarks::doNotOptimize(query::impl::Indexer::instance()->getVertexIndex(mesh, pool) != nullptr);
+  });
+  benchmarks::report(variant("build"), mesh->vertices().size(), buildTime, "vertices");
+
+  query::clearCache(mesh->getID());
+  const std::size_t before = benchmarks::allocatedBytes();
+  const auto        index  = query::impl::Indexer::instance()->getVertexIndex(mesh, pool);
+  std::cout << fmt::format("  {:<56} {:>12.4g} bytes/vertex", variant("memory"),
+                           static_cast<double>(benchmarks::allocatedBytes() - before) / mesh->vertices().size())
+            << std::endl;
+
+  const Eigen::MatrixXd locations = queryLocations(*mesh);
+  for (int n : {1, 8}) {
+    std::vector<query::VertexMatch> matches(n);
+    benchmarks::report(variant(fmt::format("nearest {}", n)), QUERIES, benchmarks::measure([&] {
+                         for (int i = 0; i < QUERIES; ++i) {
+                           index->nearest(locations.col(i).data(), n, matches.data());
+                         }
+                         benchmarks::doNotOptimize(matches[0].distance);
+                       }),
+                       "queries");
+  }
+
+  // Boxes containing about 32 vertices on average, as used by the support radius of RBFs
+  const double          radius = 0.5 * std::cbrt(32.0 / mesh->vertices().size());
+  std::vector<VertexID> ids;
+  benchmarks::report(variant("box"), QUERIES, benchmarks::measure([&] {
+                       for (int i = 0; i < QUERIES; ++i) {
+                         ids.clear();
+                         const Eigen::Vector3d min = locations.col(i).array() - radius;
+                         const Eigen::Vector3d max = locations.col(i).array() + radius;
+                         index->insideBox(min.data(), max.data(), ids);
+                       }
+                       benchmarks::doNotOptimize(ids.size());
+                     }),
+                     "queries");
+  query::clearCache(mesh->getID());
+}
+
+void benchmarkMesh(const mesh::PtrMesh &mesh, utils::ThreadPool &pool)
+{
+  benchmarkBackend("rtree", mesh, query::IndexBackend::RTree, nullptr);
+  benchmarkBackend("kd-tree", mesh, query::IndexBackend::KDTree, nullptr);
+  benchmarkBackend("grid", mesh, query::IndexBackend::Grid, nullptr);
+  if (pool.size() > 1) {
+    benchmarkBackend("kd-tree", mesh, query::IndexBackend::KDTree, &pool);
+    benchmarkBackend("grid", mesh, query::IndexBackend::Grid, &pool);
+  }
+  query::setIndexBackend(*mesh, query::IndexBackend::RTree);
+}
+
+void run()
+{
+  utils::ThreadPool pool(0);
+  for (int size : {10000, 200000}) {
+    benchmarkMesh(volumeMesh(size), pool);
+    benchmarkMesh(surfaceMesh(size), pool);
+  }
+  if (auto mesh = fileMesh()) {
+    benchmarkMesh(mesh, pool);
+  }
+}
+
+const bool registered = benchmarks::registerBenchmark("spatial-index", run);
+
+} // namespace
@@ -0,0 +1,123 @@
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+#include "benchmarks/Benchmark.hpp"
+#include "logging/LogConfiguration.hpp"
+#include "utils/fmt.hpp"
+
+namespace precice {
+namespace benchmarks {
+
+std::vector<Benchmark> &registry()
+{
+  static std::vector<Benchmark> benchmarks;
+  return benchmarks;
+}
+
+bool registerBenchmark(std::string name, std::function<void()> run)
+{
+  registry().push_back(Benchmark{std::move(name), std::move(run)});
+  return true;
+}
+
+void report(const std::string &variant, double items, double seconds, const std::string &unit)
+{
+  std::cout << fmt::format("  {:<56} {:>12.4g} {}/s  ({:.4g} s)", variant, items / seconds, unit, seconds) << std::endl;
+}
+
+namespace {
+volatile double sink = 0.0;
+
+std::atomic<std::size_t> liveBytes{0};
+} // namespace
+
+std::size_t allocatedBytes()
+{
+  return liveBytes.load();
+}
+
+void doNotOptimize(double value)
+{
+  sink = sink + value;
+}
+
+} // namespace benchmarks
+} // namespace precice
+
+namespace {
+/// Every allocation is prefixed by its size, keeping the maximal fundamental alignment
+constexpr std::size_t ALLOCATION_HEADER = alignof(std::max_align_t);
+} // namespace
+
+void *operator new(std::size_t bytes)
+{
+  void *block = std::malloc(bytes + ALLOCATION_HEADER);
+  if (not block) {
+    throw std::bad_alloc();
+  }
+  *static_cast<std::size_t *>(block) = bytes;
+  precice::benchmarks::liveBytes += bytes;
+  return static_cast<char *>(block) + ALLOCATION_HEADER;
+}
+
+void operator delete(void *pointer) noexcept
+{
+  if (not pointer) {
+    return;
+  }
+  void *block = static_cast<char *>(pointer) - ALLOCATION_HEADER;
+  precice::benchmarks::liveBytes -= *static_cast<std::size_t *>(block);
+  std::free(block);
+}
+
+void operator delete(void *pointer, std::size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+void printUsage()
+{
+  std::cerr << "Usage:\n\n";
+  std::cerr << "Run all benchmarks      :  benchprecice\n";
+  std::cerr << "Run matching benchmarks :  benchprecice FILTER\n";
+  std::cerr << "List benchmarks         :  benchprecice --list\n";
+}
+
+int main(int argc, char **argv)
+{
+  using precice::benchmarks::registry;
+
+  if (argc > 2) {
+    printUsage();
+    return 1;
+  }
+
+  const std::string filter = (argc == 2) ? argv[1] : "";
+  if (filter == "--help" || filter == "-h") {
+    printUsage();
+    return 0;
+  }
+  if (filter == "--list") {
+    for (const auto &benchmark : registry()) {
+      std::cout << benchmark.name << '\n';
+    }
+    return 0;
+  }
+
+  // Only warnings, as the debug and trace output of the measured functions would dominate the timings
+  precice::logging::BackendConfiguration config;
+  config.filter = "%Severity% >= warning";
+  precice::logging::setupLogging({config});
+
+  for (const auto &benchmark : registry()) {
+    if (benchmark.name.find(filter) != std::string::npos) {
+      std::cout << benchmark.name << '\n';
+      benchmark.run();
+    }
+  }
+  return 0;
+}
@@ -1,5 +1,9 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include "CommunicateBoundingBox.hpp"
@@ -7,10 +11,308 @@
 #include "logging/LogMacros.hpp"
 #include "mesh/BoundingBox.hpp"
 #include "precice/types.hpp"
+#include "query/Index.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
 namespace com {
+
+namespace {
+
+/// Concatenates the bounds of all boxes of the map in the order of their ranks
+std::vector<double> packBoundingBoxMap(const mesh::Mesh::BoundingBoxMap &bbm)
+{
+  std::vector<double> data;
+  for (const auto &bb : bbm) {
+    const auto bounds = bb.second.dataVector();
+    data.insert(data.end(), bounds.begin(), bounds.end());
+  }
+  return data;
+}
+
+/// Replaces the boxes of the map by the concatenated bounds of as many boxes
+void unpackBoundingBoxMap(const std::vector<double> &data, mesh::Mesh::BoundingBoxMap &bbm)
+{
+  PRECICE_ASSERT(not bbm.empty());
+  PRECICE_ASSERT(data.size() % bbm.size() == 0, data.size(), bbm.size());
+  const std::size_t entries = data.size() / bbm.size();
+  auto              bounds  = data.begin();
+  for (auto &bb : bbm) {
+    bb.second = mesh::BoundingBox(std::vector<double>(bounds, bounds + entries));
+    bounds += entries;
+  }
+}
+
+/// Returns the largest power of two which is not larger than size
+int powerOfTwoBelow(int size)
+{
+  int power = 1;
+  while (2 * power <= size) {
+    power *= 2;
+  }
+  return power;
+}
+
+/// Appends a message of the form [destination, length, payload...] to messages
+void appendMessage(std::vector<double> &messages, Rank destination, const std::vector<double> &payload)
+{
+  messages.push_back(destination);
+  messages.push_back(payload.size());
+  messages.insert(messages.end(), payload.begin(), payload.end());
+}
+
+/// Calls function(destination, begin, end) for the payload of every message
+template <typename Function>
+void forEachMessage(const std::vector<double> &messages, Function function)
+{
+  for (auto message = messages.begin(); message != messages.end();) {
+    const Rank        destination = static_cast<Rank>(message[0]);
+    const std::size_t length      = static_cast<std::size_t>(message[1]);
+    function(destination, message + 2, message + 2 + length);
+    message += 2 + length;
+  }
+}
+
+/// Sends and receives in the order of the ranks, such that blocking sends cannot deadlock
+void exchange(Communication &communication, const std::vector<double> &send, std::vector<double> &received, Rank partner, Rank rank)
+{
+  if (rank < partner) {
+    communication.send(send, partner);
+    communication.receive(received, partner);
+  } else {
+    communication.receive(received, partner);
+    communication.send(send, partner);
+  }
+}
+
+/**
+ * Delivers the messages of all ranks along a hypercube, which takes log(size) steps.
+ *
+ * Ranks beyond the largest power of two hand their messages to a proxy rank of the
+ * hypercube and get the messages addressed to them back from it.
+ *
+ * @returns the messages addressed to rank
+ */
+std::vector<double> routeMessages(Communication &communication, std::vector<double> messages, Rank rank, int size)
+{
+  const int power = powerOfTwoBelow(size);
+  if (rank >= power) {
+    communication.send(messages, rank - power);
+    communication.receive(messages, rank - power);
+    return messages;
+  }
+
+  if (rank + power < size) {
+    std::vector<double> extraMessages;
+    communication.receive(extraMessages, rank + power);
+    messages.insert(messages.end(), extraMessages.begin(), extraMessages.end());
+  }
+
+  // Each step fixes one bit of the proxy rank of the destination
+  for (int bit = 1; bit < power; bit *= 2) {
+    const Rank          partner = rank ^ bit;
+    std::vector<double> keep, send, received;
+    forEachMessage(messages, [&](Rank destination, std::vector<double>::const_iterator begin, std::vector<double>::const_iterator end) {
+      const Rank proxy = destination >= power ? destination - power : destination;
+      appendMessage((proxy & bit) == (rank & bit) ? keep : send, destination, std::vector<double>(begin, end));
+    });
+    exchange(communication, send, received, partner, rank);
+    keep.insert(keep.end(), received.begin(), received.end());
+    messages = std::move(keep);
+  }
+
+  std::vector<double> own, extra;
+  forEachMessage(messages, [&](Rank destination, std::vector<double>::const_iterator begin, std::vector<double>::const_iterator end) {
+    PRECICE_ASSERT(destination == rank || destination == rank + power, destination, rank);
+    appendMessage(destination == rank ? own : extra, destination, std::vector<double>(begin, end));
+  });
+  if (rank + power < size) {
+    communication.send(extra, rank + power);
+  }
+  return own;
+}
+
+/// Merges the bounding boxes of all ranks along a butterfly, such that all ranks get the same box
+mesh::BoundingBox mergeBoundingBoxes(Communication &communication, const mesh::BoundingBox &bb, Rank rank, int size)
+{
+  const int power  = powerOfTwoBelow(size);
+  auto      bounds = bb.dataVector();
+  if (rank >= power) {
+    communication.send(bounds, rank - power);
+    communication.receive(bounds, rank - power);
+    return mesh::BoundingBox(bounds);
+  }
+
+  mesh::BoundingBox merged(bb);
+  if (rank + power < size) {
+    std::vector<double> extraBounds;
+    communication.receive(extraBounds, rank + power);
+    merged.expandBy(mesh::BoundingBox(extraBounds));
+  }
+  for (int bit = 1; bit < power; bit *= 2) {
+    std::vector<double> partnerBounds;
+    exchange(communication, merged.dataVector(), partnerBounds, rank ^ bit, rank);
+    merged.expandBy(mesh::BoundingBox(partnerBounds));
+  }
+  if (rank + power < size) {
+    communication.send(merged.dataVector(), rank + power);
+  }
+  return merged;
+}
+
+/// Coarse grid of about one cell per rank, each cell is owned by a rank and collects the boxes overlapping it
+class RendezvousGrid {
+public:
+  RendezvousGrid(const mesh::BoundingBox &domain, int size)
+      : _min(domain.minCorner()),
+        _max(domain.maxCorner()),
+        _size(size)
+  {
+    PRECICE_ASSERT(not domain.empty());
+    _cellsPerAxis = std::max(1, static_cast<int>(std::lround(std::pow(size, 1.0 / _min.size()))));
+  }
+
+  /// Returns the indices of the cells along all axes which contain the point, points outside are clamped
+  std::vector<int> cellOf(const Eigen::VectorXd &point) const
+  {
+    std::vector<int> cell(_min.size(), 0);
+    for (int d = 0; d < _min.size(); ++d) {
+      if (_max[d] > _min[d]) {
+        const int index = static_cast<int>(std::floor((point[d] - _min[d]) / (_max[d] - _min[d]) * _cellsPerAxis));
+        cell[d]         = std::min(std::max(index, 0), _cellsPerAxis - 1);
+      }
+    }
+    return cell;
+  }
+
+  int linearIndex(const std::vector<int> &cell) const
+  {
+    int index = 0;
+    for (auto axis = cell.rbegin(); axis != cell.rend(); ++axis) {
+      index = index * _cellsPerAxis + *axis;
+    }
+    return index;
+  }
+
+  Rank ownerOf(int cell) const
+  {
+    return cell % _size;
+  }
+
+  /// Returns the linear indices of all cells which overlap the box
+  std::vector<int> cellsOf(const mesh::BoundingBox &bb) const
+  {
+    const auto       lower = cellOf(bb.minCorner());
+    const auto       upper = cellOf(bb.maxCorner());
+    std::vector<int> cell  = lower;
+    std::vector<int> cells;
+    while (true) {
+      cells.push_back(linearIndex(cell));
+      int d = 0;
+      for (; d < static_cast<int>(cell.size()); ++d) {
+        if (cell[d] < upper[d]) {
+          ++cell[d];
+          break;
+        }
+        cell[d] = lower[d];
+      }
+      if (d == static_cast<int>(cell.size())) {
+        return cells;
+      }
+    }
+  }
+
+private:
+  Eigen::VectorXd _min;
+  Eigen::VectorXd _max;
+  int             _size;
+  int             _cellsPerAxis;
+};
+
+/// Box of a rank of either group, routed to the owners of the cells it overlaps
+struct RankBox {
+  int               rank;
+  int               group;
+  mesh::BoundingBox bb;
+};
+
+/**
+ * Finds the overlapping boxes of two groups without gathering them on a single rank.
+ *
+ * The boxes are routed to the owners of the cells of a rendezvous grid over the domain.
+ * Each owner compares the boxes of its cells with an R-tree. A pair of boxes is reported by the
+ * cell which contains the lower corner of their intersection only, and sent to the rank of the
+ * box of group 0.
+ *
+ * @param[in] boxes Boxes contributed by this rank, empty boxes never overlap
+ * @param[in] symmetric Whether boxes of group 0 are compared with each other instead of with group 1
+ *
+ * @returns the rank and box of each box overlapping a box of this rank of group 0
+ */
+std::vector<RankBox> findOverlappingBoxes(Communication &communication, const std::vector<RankBox> &boxes, const mesh::BoundingBox &domain, bool symmetric, Rank rank, int size)
+{
+  const RendezvousGrid grid(domain, size);
+  const int            otherGroup = symmetric ? 0 : 1;
+
+  std::vector<double> messages;
+  for (const RankBox &box : boxes) {
+    if (box.bb.empty()) {
+      continue;
+    }
+    for (int cell : grid.cellsOf(box.bb)) {
+      std::vector<double> payload{static_cast<double>(cell), static_cast<double>(box.rank), static_cast<double>(box.group)};
+      const auto          bounds = box.bb.dataVector();
+      payload.insert(payload.end(), bounds.begin(), bounds.end());
+      appendMessage(messages, grid.ownerOf(cell), payload);
+    }
+  }
+
+  std::map<int, std::vector<RankBox>> cells;
+  forEachMessage(routeMessages(communication, std::move(messages), rank, size),
+                 [&](Rank, std::vector<double>::const_iterator begin, std::vector<double>::const_iterator end) {
+                   cells[static_cast<int>(begin[0])].push_back({static_cast<int>(begin[1]), static_cast<int>(begin[2]), mesh::BoundingBox(std::vector<double>(begin + 3, end))});
+                 });
+
+  std::vector<double> results;
+  for (const auto &cell : cells) {
+    const std::vector<RankBox> &cellBoxes = cell.second;
+    std::vector<mesh::BoundingBox> bbs;
+    for (const RankBox &box : cellBoxes) {
+      bbs.push_back(box.bb);
+    }
+    const auto overlaps = query::getOverlappingBoxes(bbs);
+    for (std::size_t i = 0; i < cellBoxes.size(); ++i) {
+      const RankBox &box = cellBoxes[i];
+      if (box.group != 0) {
+        continue;
+      }
+      for (int j : overlaps[i]) {
+        const RankBox &other = cellBoxes[j];
+        if (other.group != otherGroup || (other.group == box.group && other.rank == box.rank)) {
+          continue;
+        }
+        const Eigen::VectorXd lowerCorner = box.bb.minCorner().cwiseMax(other.bb.minCorner());
+        if (grid.linearIndex(grid.cellOf(lowerCorner)) != cell.first) {
+          continue;
+        }
+        std::vector<double> payload{static_cast<double>(other.rank)};
+        const auto          bounds = other.bb.dataVector();
+        payload.insert(payload.end(), bounds.begin(), bounds.end());
+        appendMessage(results, box.rank, payload);
+      }
+    }
+  }
+
+  std::vector<RankBox> found;
+  forEachMessage(routeMessages(communication, std::move(results), rank, size),
+                 [&](Rank, std::vector<double>::const_iterator begin, std::vector<double>::const_iterator end) {
+                   found.push_back({static_cast<int>(begin[0]), otherGroup, mesh::BoundingBox(std::vector<double>(begin + 1, end))});
+                 });
+  return found;
+}
+
+} // namespace
+
 CommunicateBoundingBox::CommunicateBoundingBox(
     com::PtrCommunication communication)
     : _communication(std::move(communication))
@@ -43,9 +345,8 @@ void CommunicateBoundingBox::sendBoundingBoxMap(
 
   PRECICE_TRACE(rankReceiver);
   _communication->send(static_cast<int>(bbm.size()), rankReceiver);
-
-  for (const auto &bb : bbm) {
-    sendBoundingBox(bb.second, rankReceiver);
+  if (not bbm.empty()) {
+    _communication->send(packBoundingBoxMap(bbm), rankReceiver);
   }
 }
 
@@ -59,8 +360,10 @@ void CommunicateBoundingBox::receiveBoundingBoxMap(
 
   PRECICE_ASSERT(sizeOfReceivingMap == (int) bbm.size(), "Incoming size of map is not compatible");
 
-  for (auto &bb : bbm) {
-    receiveBoundingBox(bb.second, rankSender);
+  if (not bbm.empty()) {
+    std::vector<double> receivedData;
+    _communication->receive(receivedData, rankSender);
+    unpackBoundingBoxMap(receivedData, bbm);
   }
 }
 
@@ -103,9 +406,8 @@ void CommunicateBoundingBox::broadcastSendBoundingBoxMap(
 {
   PRECICE_TRACE();
   _communication->broadcast(static_cast<int>(bbm.size()));
-
-  for (const auto &rank : bbm) {
-    _communication->broadcast(rank.second.dataVector());
+  if (not bbm.empty()) {
+    _communication->broadcast(packBoundingBoxMap(bbm));
   }
 }
 
@@ -117,12 +419,10 @@ void CommunicateBoundingBox::broadcastReceiveBoundingBoxMap(
   _communication->broadcast(sizeOfReceivingMap, 0);
   PRECICE_ASSERT(sizeOfReceivingMap == (int) bbm.size());
 
-  std::vector<double> receivedData;
-
-  for (int i = 0; i < sizeOfReceivingMap; ++i) {
+  if (not bbm.empty()) {
+    std::vector<double> receivedData;
     _communication->broadcast(receivedData, 0);
-    mesh::BoundingBox tempBB(receivedData);
-    bbm.at(i) = std::move(tempBB);
+    unpackBoundingBoxMap(receivedData, bbm);
   }
 }
 
@@ -150,5 +450,73 @@ void CommunicateBoundingBox::broadcastReceiveConnectionMap(
   }
 }
 
+
+mesh::Mesh::BoundingBoxMap CommunicateBoundingBox::exchangeOverlappingBoundingBoxes(
+    const mesh::BoundingBox &bb,
+    Rank                     rank,
+    int                      size)
+{
+  PRECICE_TRACE(rank, size);
+  const mesh::BoundingBox    domain = mergeBoundingBoxes(*_communication, bb, rank, size);
+  mesh::Mesh::BoundingBoxMap overlapping;
+  if (domain.empty()) {
+    return overlapping;
+  }
+  for (const RankBox &box : findOverlappingBoxes(*_communication, {{rank, 0, bb}}, domain, true, rank, size)) {
+    overlapping.emplace(box.rank, box.bb);
+  }
+  return overlapping;
+}
+
+std::vector<int> CommunicateBoundingBox::findOverlappingBoundingBoxes(
+    const mesh::BoundingBox &         bb,
+    const mesh::Mesh::BoundingBoxMap &remoteBBs,
+    Rank                              rank,
+    int                               size)
+{
+  PRECICE_TRACE(rank, size, remoteBBs.size());
+  PRECICE_ASSERT(rank == 0 || remoteBBs.empty(), rank, remoteBBs.size());
+  mesh::BoundingBox domain = mergeBoundingBoxes(*_communication, bb, rank, size);
+  if (domain.empty()) {
+    return {};
+  }
+
+  // Remote boxes outside of all local boxes are never routed
+  std::vector<RankBox> boxes{{rank, 0, bb}};
+  for (const auto &remoteBB : remoteBBs) {
+    if (domain.overlapping(remoteBB.second)) {
+      boxes.push_back({remoteBB.first, 1, remoteBB.second});
+    }
+  }
+
+  std::set<int> overlapping;
+  for (const RankBox &box : findOverlappingBoxes(*_communication, boxes, domain, false, rank, size)) {
+    overlapping.insert(box.rank);
+  }
+  return std::vector<int>(overlapping.begin(), overlapping.end());
+}
+
+std::map<int, std::vector<int>> CommunicateBoundingBox::gatherConnectionMap(
+    const std::vector<int> &connectedRanks,
+    Rank                    rank,
+    int                     size)
+{
+  PRECICE_TRACE(rank, size, connectedRanks.size());
+  std::vector<double> messages;
+  if (not connectedRanks.empty()) {
+    std::vector<double> payload{static_cast<double>(rank)};
+    payload.insert(payload.end(), connectedRanks.begin(), connectedRanks.end());
+    appendMessage(messages, 0, payload);
+  }
+
+  std::map<int, std::vector<int>> connectionMap;
+  forEachMessage(routeMessages(*_communication, std::move(messages), rank, size),
+                 [&](Rank, std::vector<double>::const_iterator begin, std::vector<double>::const_iterator end) {
+                   connectionMap.emplace(static_cast<int>(begin[0]), std::vector<int>(begin + 1, end));
+                 });
+  PRECICE_ASSERT(rank == 0 || connectionMap.empty(), rank);
+  return connectionMap;
+}
+
 } // namespace com
 } // namespace precice
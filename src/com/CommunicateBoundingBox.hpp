@@ -5,6 +5,7 @@
 #include "com/SharedPointer.hpp"
 #include "logging/Logger.hpp"
 #include "mesh/Mesh.hpp"
+#include "precice/types.hpp"
 
 namespace precice {
 namespace mesh {
@@ -58,6 +59,40 @@ public:
   void broadcastReceiveConnectionMap(
       std::map<int, std::vector<int>> &fbm);
 
+  /**
+   * @brief Finds the ranks whose bounding boxes overlap the one of this rank.
+   *
+   * All ranks of the communication call this method. The boxes are routed along a hypercube to
+   * the owners of the cells of a coarse grid, which compare the boxes of their cells only. No rank
+   * gathers all boxes and no rank communicates with more than log(size) + 1 others.
+   *
+   * @returns the overlapping boxes of the other ranks
+   */
+  mesh::Mesh::BoundingBoxMap exchangeOverlappingBoundingBoxes(
+      const mesh::BoundingBox &bb,
+      Rank                     rank,
+      int                      size);
+
+  /**
+   * @brief Finds the remote bounding boxes which overlap the one of this rank.
+   *
+   * Works like exchangeOverlappingBoundingBoxes(), but compares the boxes of this communication
+   * with the remote boxes, which only rank 0 passes.
+   *
+   * @returns the sorted ranks of the overlapping remote boxes
+   */
+  std::vector<int> findOverlappingBoundingBoxes(
+      const mesh::BoundingBox &         bb,
+      const mesh::Mesh::BoundingBoxMap &remoteBBs,
+      Rank                              rank,
+      int                               size);
+
+  /// Gathers the non-empty connected ranks of all ranks on rank 0 along a hypercube, the other ranks get an empty map.
+  std::map<int, std::vector<int>> gatherConnectionMap(
+      const std::vector<int> &connectedRanks,
+      Rank                    rank,
+      int                     size);
+
 private:
   logging::Logger _log{"com::CommunicateBoundingBox"};
 
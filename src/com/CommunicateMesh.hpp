@@ -11,8 +11,9 @@ class Mesh;
 } // namespace mesh
 
 namespace com {
+class SerializedMesh;
 
-/// Copies a Mesh object from a sender to a receiver.
+/// Copies a Mesh object from a sender to a receiver, the mesh is sent as a single SerializedMesh.
 class CommunicateMesh {
 public:
   /// Constructor, takes communication to be used in transfer.
@@ -24,6 +25,11 @@ public:
       const mesh::Mesh &mesh,
       int               rankReceiver);
 
+  /// Sends an already serialized mesh, which allows to serialize once for many receivers.
+  void sendMesh(
+      const SerializedMesh &serialized,
+      int                   rankReceiver);
+
   /// Receives a mesh from the sender with given rank. Adds received mesh to mesh.
   void receiveMesh(
       mesh::Mesh &mesh,
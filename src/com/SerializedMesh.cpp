@@ -0,0 +1,189 @@
+#include "com/SerializedMesh.hpp"
+#include <Eigen/Core>
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Utils.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace com {
+
+namespace {
+
+static_assert(sizeof(double) == 2 * sizeof(int), "The coordinates are stored in the bytes of two ints each.");
+
+constexpr int INTS_PER_DOUBLE = 2;
+
+/// Returns the position of the ID in the ascending IDs
+int positionOf(const std::vector<int> &ids, int id)
+{
+  const auto position = std::lower_bound(ids.begin(), ids.end(), id);
+  PRECICE_ASSERT(position != ids.end() && *position == id, id);
+  return std::distance(ids.begin(), position);
+}
+
+/// Offsets of the entries of the header
+enum Header : int {
+  VERSION_ENTRY = 0,
+  DIMENSIONS_ENTRY,
+  VERTICES_ENTRY,
+  EDGES_ENTRY,
+  TRIANGLES_ENTRY,
+  HEADER_SIZE
+};
+
+} // namespace
+
+constexpr int SerializedMesh::VERSION;
+
+SerializedMesh SerializedMesh::serialize(const mesh::Mesh &mesh)
+{
+  const int dim       = mesh.getDimensions();
+  const int vertices  = mesh.vertices().size();
+  const int edges     = mesh.edges().size();
+  const int triangles = mesh.triangles().size();
+
+  SerializedMesh serialized;
+  auto &         content = serialized._content;
+  content.reserve(HEADER_SIZE + vertices * (dim * INTS_PER_DOUBLE + 1) + 2 * edges + 3 * triangles);
+  content.insert(content.end(), {VERSION, dim, vertices, edges, triangles});
+
+  const auto coords = mesh::packedCoordinates(mesh);
+  PRECICE_ASSERT(coords.size() == static_cast<std::size_t>(vertices * dim), coords.size(), vertices, dim);
+  content.resize(content.size() + coords.size() * INTS_PER_DOUBLE);
+  if (not coords.empty()) {
+    std::memcpy(content.data() + HEADER_SIZE, coords.data(), coords.size() * sizeof(double));
+  }
+
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    content.push_back(vertex.getGlobalIndex());
+  }
+
+  // The IDs of vertices and edges are their positions in the mesh
+  for (const mesh::Edge &edge : mesh.edges()) {
+    PRECICE_ASSERT(edge.vertex(0).getID() < vertices && edge.vertex(1).getID() < vertices);
+    content.push_back(edge.vertex(0).getID());
+    content.push_back(edge.vertex(1).getID());
+  }
+  for (const mesh::Triangle &triangle : mesh.triangles()) {
+    for (int i = 0; i < 3; ++i) {
+      PRECICE_ASSERT(triangle.edge(i).getID() < edges);
+      content.push_back(triangle.edge(i).getID());
+    }
+  }
+  return serialized;
+}
+
+SerializedMesh SerializedMesh::serialize(const mesh::Mesh &            mesh,
+                                         const std::vector<VertexID> & vertices,
+                                         const std::vector<EdgeID> &   edges,
+                                         const std::vector<TriangleID> &triangles)
+{
+  PRECICE_ASSERT(std::is_sorted(vertices.begin(), vertices.end()));
+  PRECICE_ASSERT(std::is_sorted(edges.begin(), edges.end()));
+  PRECICE_ASSERT(std::is_sorted(triangles.begin(), triangles.end()));
+  const int dim = mesh.getDimensions();
+
+  SerializedMesh serialized;
+  auto &         content = serialized._content;
+  content.reserve(HEADER_SIZE + vertices.size() * (dim * INTS_PER_DOUBLE + 1) + 2 * edges.size() + 3 * triangles.size());
+  content.insert(content.end(), {VERSION, dim, static_cast<int>(vertices.size()), static_cast<int>(edges.size()), static_cast<int>(triangles.size())});
+
+  content.resize(content.size() + vertices.size() * dim * INTS_PER_DOUBLE);
+  int *coordsBegin = content.data() + HEADER_SIZE;
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    std::memcpy(coordsBegin + i * dim * INTS_PER_DOUBLE, mesh.vertices()[vertices[i]].rawCoords().data(), dim * sizeof(double));
+  }
+
+  for (VertexID id : vertices) {
+    content.push_back(mesh.vertices()[id].getGlobalIndex());
+  }
+
+  for (EdgeID id : edges) {
+    const mesh::Edge &edge = mesh.edges()[id];
+    content.push_back(positionOf(vertices, edge.vertex(0).getID()));
+    content.push_back(positionOf(vertices, edge.vertex(1).getID()));
+  }
+  for (TriangleID id : triangles) {
+    const mesh::Triangle &triangle = mesh.triangles()[id];
+    for (int i = 0; i < 3; ++i) {
+      content.push_back(positionOf(edges, triangle.edge(i).getID()));
+    }
+  }
+  return serialized;
+}
+
+SerializedMesh SerializedMesh::fromContent(std::vector<int> &&content)
+{
+  SerializedMesh serialized;
+  serialized._content = std::move(content);
+  return serialized;
+}
+
+int SerializedMesh::vertexCount() const
+{
+  PRECICE_ASSERT(_content.size() >= HEADER_SIZE, _content.size());
+  return _content[VERTICES_ENTRY];
+}
+
+void SerializedMesh::addToMesh(mesh::Mesh &mesh) const
+{
+  PRECICE_TRACE(mesh.getName(), _content.size());
+  PRECICE_ASSERT(_content.size() >= HEADER_SIZE, _content.size());
+  PRECICE_CHECK(_content[VERSION_ENTRY] == VERSION,
+                "The received mesh \"{}\" uses version {} of the mesh serialization, but version {} is expected. "
+                "Please make sure that all participants use the same preCICE version.",
+                mesh.getName(), _content[VERSION_ENTRY], VERSION);
+
+  const int dim       = _content[DIMENSIONS_ENTRY];
+  const int vertices  = _content[VERTICES_ENTRY];
+  const int edges     = _content[EDGES_ENTRY];
+  const int triangles = _content[TRIANGLES_ENTRY];
+  PRECICE_ASSERT(dim == mesh.getDimensions(), dim, mesh.getDimensions());
+  PRECICE_ASSERT(_content.size() == static_cast<std::size_t>(HEADER_SIZE + vertices * (dim * INTS_PER_DOUBLE + 1) + 2 * edges + 3 * triangles),
+                 _content.size(), vertices, edges, triangles);
+  PRECICE_DEBUG("Adding {} vertices, {} edges, and {} triangles", vertices, edges, triangles);
+
+  const int *coordsBegin    = _content.data() + HEADER_SIZE;
+  const int *globalBegin    = coordsBegin + vertices * dim * INTS_PER_DOUBLE;
+  const int *edgesBegin     = globalBegin + vertices;
+  const int *trianglesBegin = edgesBegin + 2 * edges;
+
+  // Delta meshes are appended, the positions in the buffer are relative to the first new vertex and edge
+  const std::size_t vertexOffset = mesh.vertices().size();
+  const std::size_t edgeOffset   = mesh.edges().size();
+
+  Eigen::VectorXd coords(dim);
+  for (int i = 0; i < vertices; ++i) {
+    std::memcpy(coords.data(), coordsBegin + i * dim * INTS_PER_DOUBLE, dim * sizeof(double));
+    mesh::Vertex &v = mesh.createVertex(coords);
+    v.setGlobalIndex(globalBegin[i]);
+  }
+
+  auto &meshVertices = mesh.vertices();
+  for (int i = 0; i < edges; ++i) {
+    const int a = edgesBegin[2 * i];
+    const int b = edgesBegin[2 * i + 1];
+    PRECICE_ASSERT(a >= 0 && a < vertices && b >= 0 && b < vertices && a != b, a, b, vertices);
+    mesh.createEdge(meshVertices[vertexOffset + a], meshVertices[vertexOffset + b]);
+  }
+
+  auto &meshEdges = mesh.edges();
+  for (int i = 0; i < triangles; ++i) {
+    const int *ids = trianglesBegin + 3 * i;
+    PRECICE_ASSERT(ids[0] != ids[1] && ids[1] != ids[2] && ids[2] != ids[0], ids[0], ids[1], ids[2]);
+    PRECICE_ASSERT(ids[0] < edges && ids[1] < edges && ids[2] < edges, ids[0], ids[1], ids[2], edges);
+    mesh.createTriangle(meshEdges[edgeOffset + ids[0]], meshEdges[edgeOffset + ids[1]], meshEdges[edgeOffset + ids[2]]);
+  }
+}
+
+} // namespace com
+} // namespace precice
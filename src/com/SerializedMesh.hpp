@@ -0,0 +1,70 @@
+#pragma once
+
+#include <vector>
+#include "logging/Logger.hpp"
+#include "precice/types.hpp"
+
+namespace precice {
+namespace mesh {
+class Mesh;
+} // namespace mesh
+
+namespace com {
+
+/**
+ * @brief A mesh serialized into a single contiguous buffer, which is sent in one message.
+ *
+ * The buffer consists of ints and is laid out as follows:
+ * - the header: format version, dimensions, number of vertices, edges, and triangles
+ * - the coordinates of the vertices, each double stored in the bytes of two ints
+ * - the global indices of the vertices
+ * - the edges as pairs of vertex positions in the buffer
+ * - the triangles as triples of edge positions in the buffer
+ *
+ * As the connectivity refers to positions in the buffer, the serialization can be added to a mesh
+ * which already contains vertices, edges, and triangles (delta meshes).
+ */
+class SerializedMesh {
+public:
+  /// The version of the format, which is checked when adding the content to a mesh
+  static constexpr int VERSION = 1;
+
+  /// Serializes the vertices, edges, and triangles of the mesh
+  static SerializedMesh serialize(const mesh::Mesh &mesh);
+
+  /**
+   * @brief Serializes a part of the mesh, which is equivalent to serializing a filtered copy of it.
+   *
+   * @param[in] mesh the mesh to serialize a part of
+   * @param[in] vertices ascending IDs of the vertices to serialize
+   * @param[in] edges ascending IDs of the edges to serialize, which only connect serialized vertices
+   * @param[in] triangles ascending IDs of the triangles to serialize, which only consist of serialized edges
+   */
+  static SerializedMesh serialize(const mesh::Mesh &            mesh,
+                                  const std::vector<VertexID> & vertices,
+                                  const std::vector<EdgeID> &   edges,
+                                  const std::vector<TriangleID> &triangles);
+
+  /// Wraps received content, which is moved into the serialization
+  static SerializedMesh fromContent(std::vector<int> &&content);
+
+  /// Adds the serialized vertices, edges, and triangles to the mesh
+  void addToMesh(mesh::Mesh &mesh) const;
+
+  /// Returns the buffer to be communicated
+  const std::vector<int> &content() const
+  {
+    return _content;
+  }
+
+  /// Returns the number of serialized vertices
+  int vertexCount() const;
+
+private:
+  mutable logging::Logger _log{"com::SerializedMesh"};
+
+  std::vector<int> _content;
+};
+
+} // namespace com
+} // namespace precice
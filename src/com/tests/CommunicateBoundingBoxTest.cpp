@@ -20,6 +20,45 @@ BOOST_AUTO_TEST_SUITE(CommunicationTests)
 
 BOOST_AUTO_TEST_SUITE(CommunicateBoundingBoxTests)
 
+namespace {
+/// Boxes of all ranks along a diagonal, neighbors overlap, the box of rank 2 is empty
+mesh::BoundingBox createDiagonalBox(Rank rank, int dimension)
+{
+  if (rank == 2) {
+    return mesh::BoundingBox(dimension);
+  }
+  std::vector<double> bounds;
+  for (int d = 0; d < dimension; d++) {
+    bounds.push_back(0.8 * rank);
+    bounds.push_back(0.8 * rank + 1.0);
+  }
+  return mesh::BoundingBox(bounds);
+}
+
+/// Checks exchangeOverlappingBoundingBoxes() against comparing all pairs of boxes
+void testExchangeOverlappingBoundingBoxes(const testing::TestContext &context)
+{
+  for (int dim = 2; dim <= 3; dim++) {
+    mesh::BoundingBox bb = createDiagonalBox(context.rank, dim);
+    CommunicateBoundingBox comBB(utils::MasterSlave::_communication);
+    const auto             overlapping = comBB.exchangeOverlappingBoundingBoxes(bb, context.rank, context.size);
+
+    mesh::Mesh::BoundingBoxMap expected;
+    for (Rank rank = 0; rank < context.size; rank++) {
+      const auto other = createDiagonalBox(rank, dim);
+      if (rank != context.rank && not bb.empty() && not other.empty() && bb.overlapping(other)) {
+        expected.emplace(rank, other);
+      }
+    }
+    BOOST_TEST(overlapping.size() == expected.size());
+    for (const auto &other : expected) {
+      BOOST_TEST_REQUIRE(overlapping.count(other.first) == 1);
+      BOOST_TEST(overlapping.at(other.first) == other.second);
+    }
+  }
+}
+} // namespace
+
 BOOST_AUTO_TEST_CASE(SendAndReceiveBoundingBox)
 {
   PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
@@ -123,6 +162,80 @@ BOOST_AUTO_TEST_CASE(BroadcastSendAndReceiveBoundingBoxMap)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ExchangeOverlappingBoundingBoxes)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves(), Require::Events);
+  testExchangeOverlappingBoundingBoxes(context);
+}
+
+BOOST_AUTO_TEST_CASE(ExchangeOverlappingBoundingBoxesThreeRanks)
+{
+  // The last rank is not part of the hypercube of two ranks
+  PRECICE_TEST(""_on(3_ranks).setupMasterSlaves(), Require::Events);
+  testExchangeOverlappingBoundingBoxes(context);
+}
+
+BOOST_AUTO_TEST_CASE(FindOverlappingBoundingBoxes)
+{
+  PRECICE_TEST(""_on(3_ranks).setupMasterSlaves(), Require::Events);
+
+  // Local boxes [0, 1], [1.5, 2.5], and an empty one along x
+  mesh::BoundingBox bb(2);
+  if (context.rank < 2) {
+    bb = mesh::BoundingBox(std::vector<double>{1.5 * context.rank, 1.5 * context.rank + 1.0, 0.0, 1.0});
+  }
+
+  // Remote boxes [0.5k, 0.5k + 0.2] along x, only the master passes them
+  mesh::Mesh::BoundingBoxMap remoteBBs;
+  if (context.isMaster()) {
+    for (Rank remoteRank = 0; remoteRank < 8; remoteRank++) {
+      remoteBBs.emplace(remoteRank, mesh::BoundingBox(std::vector<double>{0.5 * remoteRank, 0.5 * remoteRank + 0.2, 0.5, 2.0}));
+    }
+  }
+
+  CommunicateBoundingBox comBB(utils::MasterSlave::_communication);
+  const auto             connectedRanks = comBB.findOverlappingBoundingBoxes(bb, remoteBBs, context.rank, context.size);
+  if (context.isRank(0)) {
+    BOOST_TEST(connectedRanks == std::vector<int>({0, 1, 2}), boost::test_tools::per_element());
+  } else if (context.isRank(1)) {
+    BOOST_TEST(connectedRanks == std::vector<int>({3, 4, 5}), boost::test_tools::per_element());
+  } else {
+    BOOST_TEST(connectedRanks.empty());
+  }
+
+  const auto connectionMap = comBB.gatherConnectionMap(connectedRanks, context.rank, context.size);
+  if (context.isMaster()) {
+    BOOST_TEST(connectionMap.size() == 2);
+    BOOST_TEST(connectionMap.at(0) == std::vector<int>({0, 1, 2}), boost::test_tools::per_element());
+    BOOST_TEST(connectionMap.at(1) == std::vector<int>({3, 4, 5}), boost::test_tools::per_element());
+  } else {
+    BOOST_TEST(connectionMap.empty());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(GatherConnectionMap)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves(), Require::Events);
+
+  // Rank 1 has no connections
+  std::vector<int> connectedRanks;
+  if (not context.isRank(1)) {
+    connectedRanks = {context.rank, context.rank + 10};
+  }
+
+  CommunicateBoundingBox comBB(utils::MasterSlave::_communication);
+  const auto             connectionMap = comBB.gatherConnectionMap(connectedRanks, context.rank, context.size);
+  if (context.isMaster()) {
+    BOOST_TEST(connectionMap.size() == 3);
+    BOOST_TEST(connectionMap.count(1) == 0);
+    for (Rank rank : {0, 2, 3}) {
+      BOOST_TEST(connectionMap.at(rank) == std::vector<int>({rank, rank + 10}), boost::test_tools::per_element());
+    }
+  } else {
+    BOOST_TEST(connectionMap.empty());
+  }
+}
+
 BOOST_AUTO_TEST_CASE(SendAndReceiveConnectionMap)
 {
   PRECICE_TEST("A"_on(1_rank), "B"_on(1_rank), Require::Events);
@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <memory>
 #include "com/CommunicateMesh.hpp"
+#include "com/SerializedMesh.hpp"
 #include "com/SharedPointer.hpp"
 #include "m2n/M2N.hpp"
 #include "mesh/Mesh.hpp"
@@ -135,6 +136,74 @@ BOOST_AUTO_TEST_CASE(BroadcastVertexEdgeTriangleMesh)
   }
 }
 
+BOOST_AUTO_TEST_CASE(SerializedDeltaMesh)
+{
+  PRECICE_TEST(1_rank);
+
+  int             dim = 3;
+  mesh::Mesh      sendMesh("Sent Mesh", dim, testing::nextMeshID());
+  mesh::Vertex &  v0 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 0));
+  mesh::Vertex &  v1 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+  mesh::Vertex &  v2 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 2));
+  mesh::Edge &    e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &    e1 = sendMesh.createEdge(v1, v2);
+  mesh::Edge &    e2 = sendMesh.createEdge(v2, v0);
+  mesh::Triangle &t0 = sendMesh.createTriangle(e0, e1, e2);
+  v1.setGlobalIndex(11);
+
+  const auto serialized = SerializedMesh::serialize(sendMesh);
+  BOOST_TEST(serialized.vertexCount() == 3);
+  BOOST_TEST(serialized.content().front() == SerializedMesh::VERSION);
+
+  // The connectivity refers to the added vertices and edges
+  mesh::Mesh recvMesh("Received Mesh", dim, testing::nextMeshID());
+  serialized.addToMesh(recvMesh);
+  serialized.addToMesh(recvMesh);
+  BOOST_TEST(recvMesh.vertices().size() == 6);
+  BOOST_TEST(recvMesh.edges().size() == 6);
+  BOOST_TEST(recvMesh.triangles().size() == 2);
+  BOOST_TEST(recvMesh.vertices().at(4) == v1);
+  BOOST_TEST(recvMesh.vertices().at(4).getGlobalIndex() == 11);
+  BOOST_TEST(recvMesh.vertices().at(3).getGlobalIndex() == -1);
+  BOOST_TEST(recvMesh.edges().at(4).vertex(0).getID() == 4);
+  BOOST_TEST(recvMesh.edges().at(4).vertex(1).getID() == 5);
+  BOOST_TEST(recvMesh.triangles().at(1) == t0);
+  BOOST_TEST(recvMesh.triangles().at(1).edge(0).getID() == 3);
+}
+
+BOOST_AUTO_TEST_CASE(SerializedSubMesh)
+{
+  PRECICE_TEST(1_rank);
+
+  int             dim = 3;
+  mesh::Mesh      sendMesh("Sent Mesh", dim, testing::nextMeshID());
+  mesh::Vertex &  v0 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 0));
+  mesh::Vertex &  v1 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 1));
+  mesh::Vertex &  v2 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 2));
+  mesh::Vertex &  v3 = sendMesh.createVertex(Eigen::VectorXd::Constant(dim, 3));
+  mesh::Edge &    e0 = sendMesh.createEdge(v0, v1);
+  mesh::Edge &    e1 = sendMesh.createEdge(v2, v3);
+  mesh::Edge &    e2 = sendMesh.createEdge(v3, v1);
+  mesh::Edge &    e3 = sendMesh.createEdge(v1, v2);
+  mesh::Triangle &t0 = sendMesh.createTriangle(e1, e2, e3);
+  v3.setGlobalIndex(13);
+
+  // Vertex 0 and edge 0 are left out, the positions of the connectivity are shifted
+  const auto serialized = SerializedMesh::serialize(sendMesh, {1, 2, 3}, {1, 2, 3}, {0});
+  BOOST_TEST(serialized.vertexCount() == 3);
+
+  mesh::Mesh recvMesh("Received Mesh", dim, testing::nextMeshID());
+  serialized.addToMesh(recvMesh);
+  BOOST_TEST(recvMesh.vertices().size() == 3);
+  BOOST_TEST(recvMesh.edges().size() == 3);
+  BOOST_TEST(recvMesh.triangles().size() == 1);
+  BOOST_TEST(recvMesh.vertices().at(2) == v3);
+  BOOST_TEST(recvMesh.vertices().at(2).getGlobalIndex() == 13);
+  BOOST_TEST(recvMesh.edges().at(0) == e1);
+  BOOST_TEST(recvMesh.edges().at(2) == e3);
+  BOOST_TEST(recvMesh.triangles().at(0) == t0);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Mesh
 BOOST_AUTO_TEST_SUITE_END() // Communication
 
@@ -2,8 +2,10 @@
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <set>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "BaseCouplingScheme.hpp"
 #include "acceleration/Acceleration.hpp"
@@ -17,6 +19,7 @@
 #include "math/differences.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Utils.hpp"
 #include "precice/types.hpp"
 #include "utils/EigenHelperFunctions.hpp"
 #include "utils/MasterSlave.hpp"
@@ -85,7 +88,14 @@ void BaseCouplingScheme::sendData(const m2n::PtrM2N &m2n, const DataMap &sendDat
   PRECICE_ASSERT(m2n.get() != nullptr);
   PRECICE_ASSERT(m2n->isConnected());
 
+  std::set<int> sentMeshIDs;
   for (const DataMap::value_type &pair : sendData) {
+    // The coordinates of a moving mesh precede its first data set, such that the receiver maps to the current positions
+    mesh::Mesh &mesh = pair.second->getMesh();
+    if (mesh.isMoving() && sentMeshIDs.insert(mesh.getID()).second) {
+      sendCoordinates(m2n, mesh);
+    }
+
     // Data is actually only send if size>0, which is checked in the derived classes implementaiton
     m2n->send(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
 
@@ -100,7 +110,13 @@ void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &rece
   std::vector<int> receivedDataIDs;
   PRECICE_ASSERT(m2n.get());
   PRECICE_ASSERT(m2n->isConnected());
+  std::set<int> receivedMeshIDs;
   for (const DataMap::value_type &pair : receiveData) {
+    mesh::Mesh &mesh = pair.second->getMesh();
+    if (mesh.isMoving() && receivedMeshIDs.insert(mesh.getID()).second) {
+      receiveCoordinates(m2n, mesh);
+    }
+
     // Data is only received on ranks with size>0, which is checked in the derived class implementation
     m2n->receive(pair.second->values(), pair.second->getMeshID(), pair.second->getDimensions());
 
@@ -109,6 +125,43 @@ void BaseCouplingScheme::receiveData(const m2n::PtrM2N &m2n, const DataMap &rece
   PRECICE_DEBUG("Number of received data sets = {}", receivedDataIDs.size());
 }
 
+void BaseCouplingScheme::sendCoordinates(const m2n::PtrM2N &m2n, const mesh::Mesh &mesh)
+{
+  PRECICE_TRACE(mesh.getName());
+  // The move count is equal on all ranks, hence they all agree on sending the coordinates
+  int &      sentMoveCount = _sentMoveCounts[std::make_pair(m2n.get(), mesh.getID())];
+  const bool moved         = sentMoveCount != mesh.getMoveCount();
+  m2n->send(moved);
+  if (not moved) {
+    return;
+  }
+  // Every rank only sends the coordinates of the vertices the remote ranks received in initialize()
+  m2n->send(mesh::packedCoordinates(mesh), mesh.getID(), mesh.getDimensions());
+  sentMoveCount = mesh.getMoveCount();
+}
+
+void BaseCouplingScheme::receiveCoordinates(const m2n::PtrM2N &m2n, mesh::Mesh &mesh)
+{
+  PRECICE_TRACE(mesh.getName());
+  bool moved = false;
+  m2n->receive(moved);
+  if (not moved) {
+    return;
+  }
+  const int           dimensions = mesh.getDimensions();
+  std::vector<double> coordinates(mesh.vertices().size() * dimensions);
+  m2n->receive(coordinates, mesh.getID(), dimensions);
+
+  PRECICE_DEBUG("Vertices of mesh \"{}\" moved", mesh.getName());
+  for (std::size_t i = 0; i < mesh.vertices().size(); ++i) {
+    mesh.vertices()[i].setCoords(Eigen::Map<const Eigen::VectorXd>(&coordinates[i * dimensions], dimensions));
+  }
+  mesh.computeBoundingBox();
+  // All ranks received the movement, the mappings recompute everything derived from the old positions
+  mesh.countMove();
+  mesh.meshChanged(mesh);
+}
+
 void BaseCouplingScheme::setTimeWindowSize(double timeWindowSize)
 {
   _timeWindowSize = timeWindowSize;
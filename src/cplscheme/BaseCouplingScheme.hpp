@@ -6,6 +6,7 @@
 #include <memory>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 #include "Constants.hpp"
 #include "CouplingData.hpp"
@@ -250,6 +251,12 @@ protected:
   /// Receives data receiveDataIDs given in mapCouplingData with communication.
   void receiveData(const m2n::PtrM2N &m2n, const DataMap &receiveData);
 
+  /// Sends the coordinates of a moving mesh, if its vertices moved since they were last sent with this m2n.
+  void sendCoordinates(const m2n::PtrM2N &m2n, const mesh::Mesh &mesh);
+
+  /// Receives the coordinates of a moving mesh and moves its vertices, if they moved.
+  void receiveCoordinates(const m2n::PtrM2N &m2n, mesh::Mesh &mesh);
+
   /**
    * @brief Function to determine whether coupling scheme is an explicit coupling scheme
    * @returns true, if coupling scheme is explicit
@@ -460,6 +467,9 @@ private:
   /// Local participant name.
   std::string _localParticipant = "unknown";
 
+  /// Move count of each moving mesh, when its coordinates were last sent with an m2n
+  std::map<std::pair<const m2n::M2N *, int>, int> _sentMoveCounts;
+
   /// Smallest number, taking validDigits into account: eps = std::pow(10.0, -1 * validDigits)
   const double _eps;
 
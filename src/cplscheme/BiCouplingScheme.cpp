@@ -107,6 +107,11 @@ std::vector<std::string> BiCouplingScheme::getCouplingPartners() const
   return partnerNames;
 }
 
+bool BiCouplingScheme::receivesDataOn(MeshID meshID) const
+{
+  return std::any_of(_receiveData.cbegin(), _receiveData.cend(), [meshID](const auto &pair) { return pair.second->getMeshID() == meshID; });
+}
+
 CouplingData *BiCouplingScheme::getSendData(
     DataID dataID)
 {
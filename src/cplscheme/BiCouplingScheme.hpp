@@ -55,6 +55,8 @@ public:
   /// returns list of all coupling partners
   std::vector<std::string> getCouplingPartners() const override final;
 
+  bool receivesDataOn(MeshID meshID) const override final;
+
   /**
    * @returns true, if coupling scheme has any sendData
    */
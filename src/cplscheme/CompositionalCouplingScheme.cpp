@@ -123,6 +123,11 @@ std::vector<std::string> CompositionalCouplingScheme::getCouplingPartners() cons
   return partners;
 }
 
+bool CompositionalCouplingScheme::receivesDataOn(MeshID meshID) const
+{
+  return std::any_of(_couplingSchemes.cbegin(), _couplingSchemes.cend(), [meshID](const Scheme &scheme) { return scheme.scheme->receivesDataOn(meshID); });
+}
+
 bool CompositionalCouplingScheme::willDataBeExchanged(double lastSolverTimestepLength) const
 {
   PRECICE_TRACE(lastSolverTimestepLength);
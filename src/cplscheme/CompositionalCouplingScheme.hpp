@@ -115,6 +115,9 @@ public:
   /// Returns list of all coupling partners
   std::vector<std::string> getCouplingPartners() const final override;
 
+  /// Returns true, if any coupling scheme in the composition receives data on the mesh.
+  bool receivesDataOn(MeshID meshID) const final override;
+
   /**
    * @brief Returns true, if data will be exchanged when calling advance().
    *
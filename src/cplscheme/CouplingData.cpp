@@ -58,6 +58,11 @@ int CouplingData::getMeshID()
   return _mesh->getID();
 }
 
+mesh::Mesh &CouplingData::getMesh()
+{
+  return *_mesh;
+}
+
 int CouplingData::getDataID()
 {
   return _data->getID();
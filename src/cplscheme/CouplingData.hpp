@@ -35,6 +35,9 @@ public:
   /// get ID of this CouplingData's mesh. See Mesh::getID().
   int getMeshID();
 
+  /// get this CouplingData's mesh.
+  mesh::Mesh &getMesh();
+
   /// get ID of this CouplingData's data. See Data::getID().
   int getDataID();
 
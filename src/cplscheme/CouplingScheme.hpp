@@ -4,6 +4,7 @@
 #include <string>
 #include <vector>
 #include "com/SharedPointer.hpp"
+#include "precice/types.hpp"
 
 namespace precice {
 namespace cplscheme {
@@ -116,6 +117,9 @@ public:
   /// Returns list of all coupling partners.
   virtual std::vector<std::string> getCouplingPartners() const = 0;
 
+  /// Returns true, if data on the mesh with the given ID is received from a coupling partner.
+  virtual bool receivesDataOn(MeshID meshID) const = 0;
+
   /**
    * @brief Returns true, if data will be exchanged when calling advance().
    *
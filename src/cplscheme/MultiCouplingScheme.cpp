@@ -54,6 +54,18 @@ std::vector<std::string> MultiCouplingScheme::getCouplingPartners() const
   return partnerNames;
 }
 
+bool MultiCouplingScheme::receivesDataOn(MeshID meshID) const
+{
+  for (const auto &receiveExchange : _receiveDataVector) {
+    for (const auto &pair : receiveExchange.second) {
+      if (pair.second->getMeshID() == meshID) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
 void MultiCouplingScheme::initializeImplementation()
 {
   PRECICE_ASSERT(isImplicitCouplingScheme(), "MultiCouplingScheme is always Implicit.");
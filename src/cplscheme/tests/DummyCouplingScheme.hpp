@@ -107,6 +107,15 @@ public:
     return false;
   }
 
+  /**
+   * @brief Not implemented.
+   */
+  bool receivesDataOn(MeshID meshID) const override final
+  {
+    PRECICE_ASSERT(false);
+    return false;
+  }
+
   /**
    * @brief Not implemented.
    */
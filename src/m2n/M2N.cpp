@@ -18,11 +18,12 @@ extern bool syncMode;
 
 namespace m2n {
 
-M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom, bool useTwoLevelInit)
+M2N::M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom, bool useTwoLevelInit, std::string partitionCacheDirectory)
     : _masterCom(std::move(masterCom)),
       _distrFactory(std::move(distrFactory)),
       _useOnlyMasterCom(useOnlyMasterCom),
-      _useTwoLevelInit(useTwoLevelInit)
+      _useTwoLevelInit(useTwoLevelInit),
+      _partitionCacheDirectory(std::move(partitionCacheDirectory))
 {
 }
 
@@ -45,6 +46,7 @@ void M2N::acceptMasterConnection(
   PRECICE_TRACE(acceptorName, requesterName);
 
   Event e("m2n.acceptMasterConnection", precice::syncMode);
+  _localParticipantName = acceptorName;
 
   if (not utils::MasterSlave::isSlave()) {
     PRECICE_DEBUG("Accept master-master connection");
@@ -63,6 +65,7 @@ void M2N::requestMasterConnection(
   PRECICE_TRACE(acceptorName, requesterName);
 
   Event e("m2n.requestMasterConnection", precice::syncMode);
+  _localParticipantName = requesterName;
 
   if (not utils::MasterSlave::isSlave()) {
     PRECICE_ASSERT(_masterCom);
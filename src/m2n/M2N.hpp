@@ -30,7 +30,7 @@ struct WhiteboxAccessor;
  */
 class M2N {
 public:
-  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom = false, bool useTwoLevelInit = false);
+  M2N(com::PtrCommunication masterCom, DistributedComFactory::SharedPointer distrFactory, bool useOnlyMasterCom = false, bool useTwoLevelInit = false, std::string partitionCacheDirectory = "");
 
   /// Destructor, empty.
   ~M2N();
@@ -200,6 +200,18 @@ public:
     return _useTwoLevelInit;
   }
 
+  /// Directory to cache the partitions of the exchanged meshes in, empty if the partitions are not cached
+  const std::string &getPartitionCacheDirectory() const
+  {
+    return _partitionCacheDirectory;
+  }
+
+  /// Name of the calling participant, set when connecting the masters
+  const std::string &getLocalParticipantName() const
+  {
+    return _localParticipantName;
+  }
+
 private:
   logging::Logger _log{"m2n::M2N"};
 
@@ -228,6 +240,10 @@ private:
   /// use the two-level initialization concept
   bool _useTwoLevelInit = false;
 
+  std::string _partitionCacheDirectory;
+
+  std::string _localParticipantName;
+
   // @brief To allow access to _useOnlyMasterCom
   friend struct WhiteboxAccessor;
 };
@@ -9,13 +9,14 @@
 namespace precice {
 namespace m2n {
 
-PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory)
-    : _comFactory(std::move(comFactory)) {}
+PointToPointComFactory::PointToPointComFactory(com::PtrCommunicationFactory comFactory, std::string cacheDirectory)
+    : _comFactory(std::move(comFactory)),
+      _cacheDirectory(std::move(cacheDirectory)) {}
 
 DistributedCommunication::SharedPointer
 PointToPointComFactory::newDistributedCommunication(mesh::PtrMesh mesh)
 {
-  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh));
+  return DistributedCommunication::SharedPointer(new PointToPointCommunication(_comFactory, mesh, _cacheDirectory));
 }
 
 } // namespace m2n
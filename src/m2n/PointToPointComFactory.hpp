@@ -1,5 +1,6 @@
 #pragma once
 
+#include <string>
 #include "DistributedComFactory.hpp"
 #include "com/SharedPointer.hpp"
 #include "m2n/DistributedCommunication.hpp"
@@ -11,7 +12,8 @@ namespace m2n {
 class PointToPointComFactory : public DistributedComFactory {
 
 public:
-  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory);
+  /// Constructor, an empty cache directory disables caching the communication maps
+  explicit PointToPointComFactory(com::PtrCommunicationFactory comFactory, std::string cacheDirectory = "");
 
   DistributedCommunication::SharedPointer newDistributedCommunication(
       mesh::PtrMesh mesh);
@@ -19,6 +21,9 @@ public:
 private:
   /// communication factory for 1:M communications
   com::PtrCommunicationFactory _comFactory;
+
+  /// directory of the partition cache to store the communication maps in
+  std::string _cacheDirectory;
 };
 
 } // namespace m2n
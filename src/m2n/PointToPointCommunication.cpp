@@ -15,11 +15,15 @@
 #include "com/Communication.hpp"
 #include "com/CommunicationFactory.hpp"
 #include "com/Request.hpp"
+#include "com/SerializedMesh.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/DistributedCommunication.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "partition/PartitionCache.hpp"
 #include "precice/types.hpp"
 #include "utils/Event.hpp"
+#include "utils/Fingerprint.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
@@ -286,9 +290,11 @@ std::map<int, std::vector<int>> buildCommunicationMap(
 
 PointToPointCommunication::PointToPointCommunication(
     com::PtrCommunicationFactory communicationFactory,
-    mesh::PtrMesh                mesh)
+    mesh::PtrMesh                mesh,
+    std::string                  cacheDirectory)
     : DistributedCommunication(std::move(mesh)),
-      _communicationFactory(std::move(communicationFactory))
+      _communicationFactory(std::move(communicationFactory)),
+      _cacheDirectory(std::move(cacheDirectory))
 {
 }
 
@@ -309,28 +315,6 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   PRECICE_TRACE(acceptorName, requesterName);
   PRECICE_ASSERT(not isConnected(), "Already connected.");
 
-  mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
-  mesh::Mesh::VertexDistribution  requesterVertexDistribution;
-
-  if (not utils::MasterSlave::isSlave()) {
-    PRECICE_DEBUG("Exchange vertex distribution between both masters");
-    Event e0("m2n.exchangeVertexDistribution");
-    // Establish connection between participants' master processes.
-    auto c = _communicationFactory->newCommunication();
-
-    c->acceptConnection(acceptorName, requesterName, "TMP-MASTERCOM-" + _mesh->getName(), utils::MasterSlave::getRank());
-
-    // Exchange vertex distributions.
-    m2n::send(vertexDistribution, 0, c);
-    m2n::receive(requesterVertexDistribution, 0, c);
-  }
-
-  PRECICE_DEBUG("Broadcast vertex distributions");
-  Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(requesterVertexDistribution);
-  e1.stop();
-
   // Local (for process rank in the current participant) communication map that
   // defines a mapping from a process rank in the remote participant to an array
   // of local data indices, which define a subset of local (for process rank in
@@ -348,10 +332,7 @@ void PointToPointCommunication::acceptConnection(std::string const &acceptorName
   //   the remote process with rank 1;
   // - has to communicate (send/receive) data with local indices 0 and 2 with
   //   the remote process with rank 4.
-  Event                           e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      vertexDistribution, requesterVertexDistribution);
-  e2.stop();
+  std::map<int, std::vector<int>> communicationMap = computeCommunicationMap(acceptorName, requesterName, true);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -433,50 +414,8 @@ void PointToPointCommunication::requestConnection(std::string const &acceptorNam
   PRECICE_TRACE(acceptorName, requesterName);
   PRECICE_ASSERT(not isConnected(), "Already connected.");
 
-  mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
-  mesh::Mesh::VertexDistribution  acceptorVertexDistribution;
-
-  if (not utils::MasterSlave::isSlave()) {
-    PRECICE_DEBUG("Exchange vertex distribution between both masters");
-    Event e0("m2n.exchangeVertexDistribution");
-    // Establish connection between participants' master processes.
-    auto c = _communicationFactory->newCommunication();
-    c->requestConnection(acceptorName, requesterName,
-                         "TMP-MASTERCOM-" + _mesh->getName(),
-                         0, 1);
-
-    // Exchange vertex distributions.
-    m2n::receive(acceptorVertexDistribution, 0, c);
-    m2n::send(vertexDistribution, 0, c);
-  }
-
-  PRECICE_DEBUG("Broadcast vertex distributions");
-  Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
-  m2n::broadcast(vertexDistribution);
-  m2n::broadcast(acceptorVertexDistribution);
-  e1.stop();
-
-  // Local (for process rank in the current participant) communication map that
-  // defines a mapping from a process rank in the remote participant to an array
-  // of local data indices, which define a subset of local (for process rank in
-  // the current participant) data to be communicated between the current
-  // process rank and the remote process rank.
-  //
-  // Example. Assume that the current process rank is 3. Assume that its
-  // `communicationMap' is
-  //
-  //   1 -> {1, 3}
-  //   4 -> {0, 2}
-  //
-  // then it means that the current process (with rank 3)
-  // - has to communicate (send/receive) data with local indices 1 and 3 with
-  //   the remote process with rank 1;
-  // - has to communicate (send/receive) data with local indices 0 and 2 with
-  //   the remote process with rank 4.
-  Event                           e2("m2n.buildCommunicationMap", precice::syncMode);
-  std::map<int, std::vector<int>> communicationMap = m2n::buildCommunicationMap(
-      vertexDistribution, acceptorVertexDistribution);
-  e2.stop();
+  // Local communication map, see acceptConnection() for its meaning
+  std::map<int, std::vector<int>> communicationMap = computeCommunicationMap(acceptorName, requesterName, false);
 
 // Print `communicationMap'.
 #ifdef P2P_LCM_PRINT
@@ -556,6 +495,116 @@ void PointToPointCommunication::requestPreConnection(std::string const &acceptor
   _isConnected = true;
 }
 
+PointToPointCommunication::CommunicationMap PointToPointCommunication::computeCommunicationMap(std::string const &acceptorName,
+                                                                                              std::string const &requesterName,
+                                                                                              bool               isAcceptor)
+{
+  PRECICE_TRACE(acceptorName, requesterName, isAcceptor);
+  com::PtrCommunication masterCom;
+  if (not utils::MasterSlave::isSlave()) {
+    // Establish connection between participants' master processes.
+    masterCom = _communicationFactory->newCommunication();
+    if (isAcceptor) {
+      masterCom->acceptConnection(acceptorName, requesterName, "TMP-MASTERCOM-" + _mesh->getName(), utils::MasterSlave::getRank());
+    } else {
+      masterCom->requestConnection(acceptorName, requesterName, "TMP-MASTERCOM-" + _mesh->getName(), 0, 1);
+    }
+  }
+
+  const partition::PartitionCache cache(_cacheDirectory, isAcceptor ? acceptorName : requesterName);
+  utils::Fingerprint              key;
+  std::map<int, std::vector<int>> communicationMap;
+  if (cache.isEnabled() && loadCommunicationMap(masterCom, cache, isAcceptor, key, communicationMap)) {
+    PRECICE_DEBUG("Loaded the communication map of mesh {} from the cache", _mesh->getName());
+    return communicationMap;
+  }
+
+  mesh::Mesh::VertexDistribution &vertexDistribution = _mesh->getVertexDistribution();
+  mesh::Mesh::VertexDistribution  remoteVertexDistribution;
+
+  if (not utils::MasterSlave::isSlave()) {
+    PRECICE_DEBUG("Exchange vertex distribution between both masters");
+    Event e0("m2n.exchangeVertexDistribution");
+    if (isAcceptor) {
+      m2n::send(vertexDistribution, 0, masterCom);
+      m2n::receive(remoteVertexDistribution, 0, masterCom);
+    } else {
+      m2n::receive(remoteVertexDistribution, 0, masterCom);
+      m2n::send(vertexDistribution, 0, masterCom);
+    }
+  }
+
+  PRECICE_DEBUG("Broadcast vertex distributions");
+  Event e1("m2n.broadcastVertexDistributions", precice::syncMode);
+  m2n::broadcast(vertexDistribution);
+  m2n::broadcast(remoteVertexDistribution);
+  e1.stop();
+
+  Event e2("m2n.buildCommunicationMap", precice::syncMode);
+  communicationMap = m2n::buildCommunicationMap(vertexDistribution, remoteVertexDistribution);
+  e2.stop();
+
+  if (cache.isEnabled()) {
+    cache.storeCommunicationMap(key, _mesh->getName(), _mesh->vertices().size(), communicationMap);
+  }
+  return communicationMap;
+}
+
+bool PointToPointCommunication::loadCommunicationMap(const com::PtrCommunication &    masterCom,
+                                                     const partition::PartitionCache &cache,
+                                                     bool                             isAcceptor,
+                                                     utils::Fingerprint &             key,
+                                                     CommunicationMap &               communicationMap)
+{
+  PRECICE_TRACE(isAcceptor);
+  Event e("m2n.loadCommunicationMap", precice::syncMode);
+
+  // The vertices of this rank are kept in the key, the vertices of the other ranks and the remote
+  // vertex distribution only contribute their hashes. These cover the numbers of ranks as well.
+  key.add(isAcceptor);
+  key.add(_mesh->vertices().size());
+  for (const mesh::Vertex &vertex : _mesh->vertices()) {
+    key.add(vertex.getGlobalIndex());
+  }
+  const std::uint64_t local  = partition::combineFingerprints(key.value());
+  std::uint64_t       remote = 0;
+  if (not utils::MasterSlave::isSlave()) {
+    if (isAcceptor) {
+      partition::sendFingerprint(*masterCom, local, 0);
+      remote = partition::receiveFingerprint(*masterCom, 0);
+    } else {
+      remote = partition::receiveFingerprint(*masterCom, 0);
+      partition::sendFingerprint(*masterCom, local, 0);
+    }
+  }
+  partition::broadcastFingerprint(remote);
+  key.add(local);
+  key.add(remote);
+
+  int misses      = cache.loadCommunicationMap(key, _mesh->getName(), _mesh->vertices().size(), communicationMap) ? 0 : 1;
+  int totalMisses = 0;
+  utils::MasterSlave::allreduceSum(misses, totalMisses);
+
+  // Both participants have to skip the exchange of the vertex distributions
+  bool loaded = totalMisses == 0;
+  if (not utils::MasterSlave::isSlave()) {
+    bool remoteLoaded = false;
+    if (isAcceptor) {
+      masterCom->send(loaded, 0);
+      masterCom->receive(remoteLoaded, 0);
+    } else {
+      masterCom->receive(remoteLoaded, 0);
+      masterCom->send(loaded, 0);
+    }
+    loaded = loaded && remoteLoaded;
+  }
+  utils::MasterSlave::broadcast(loaded);
+  if (not loaded) {
+    communicationMap.clear();
+  }
+  return loaded;
+}
+
 void PointToPointCommunication::completeSlavesConnection()
 {
   mesh::Mesh::CommunicationMap localCommunicationMap = _mesh->getCommunicationMap();
@@ -646,8 +695,10 @@ void PointToPointCommunication::broadcastReceiveAll(std::vector<int> &itemToRece
 
 void PointToPointCommunication::broadcastSendMesh()
 {
+  // Serialize once for all connected ranks
+  const auto serialized = com::SerializedMesh::serialize(*_mesh);
   for (auto &connectionData : _connectionDataVector) {
-    com::CommunicateMesh(_communication).sendMesh(*_mesh, connectionData.remoteRank);
+    com::CommunicateMesh(_communication).sendMesh(serialized, connectionData.remoteRank);
   }
 }
 
@@ -16,6 +16,12 @@ namespace precice {
 namespace com {
 class Request;
 } // namespace com
+namespace partition {
+class PartitionCache;
+} // namespace partition
+namespace utils {
+class Fingerprint;
+} // namespace utils
 
 namespace m2n {
 /**
@@ -27,12 +33,18 @@ namespace m2n {
  * supplied via their corresponding instantiation factories
  * SocketCommunicationFactory and MPIPortsCommunicationFactory.
  *
+ * With a partition cache directory, the communication maps are stored in the partition cache.
+ * Restarts with identical vertex distributions load them and skip the exchange of the vertex
+ * distributions, only the connections themselves are established again.
+ *
  * For the detailed implementation documentation refer to PointToPointCommunication.cpp.
  */
 class PointToPointCommunication : public DistributedCommunication {
 public:
+  /// Constructor, an empty cache directory disables caching the communication maps
   PointToPointCommunication(com::PtrCommunicationFactory communicationFactory,
-                            mesh::PtrMesh                mesh);
+                            mesh::PtrMesh                mesh,
+                            std::string                  cacheDirectory = "");
 
   ~PointToPointCommunication() override;
 
@@ -131,8 +143,35 @@ private:
    */
   void checkBufferedRequests(bool blocking);
 
+  /**
+   * @brief Computes the communication map of this rank, collective over all ranks.
+   *
+   * The masters connect and exchange the vertex distributions, from which every rank builds its map.
+   * With an enabled cache, the maps are loaded instead if all ranks of both participants find theirs.
+   * Otherwise, the built maps are stored.
+   */
+  CommunicationMap computeCommunicationMap(std::string const &acceptorName,
+                                           std::string const &requesterName,
+                                           bool               isAcceptor);
+
+  /**
+   * @brief Loads the communication map of this rank from the cache, collective over all ranks.
+   *
+   * The key consists of the vertices of this rank and the hashes of both vertex distributions.
+   *
+   * @returns true if all ranks of both participants loaded their maps, otherwise the map is empty
+   */
+  bool loadCommunicationMap(const com::PtrCommunication &    masterCom,
+                            const partition::PartitionCache &cache,
+                            bool                             isAcceptor,
+                            utils::Fingerprint &             key,
+                            CommunicationMap &               communicationMap);
+
   com::PtrCommunicationFactory _communicationFactory;
 
+  /// Directory of the partition cache, empty if the communication maps are not cached
+  std::string _cacheDirectory;
+
   /// Communication class used for this PointToPointCommunication
   /**
    * A Communication object represents all connections to all ranks made by this P2P instance.
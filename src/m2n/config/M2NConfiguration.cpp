@@ -108,6 +108,14 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
   attrTwoLevel.setDocumentation("Use a two-level initialization scheme. "
                                 "Recommended for large parallel runs (>5000 MPI ranks).");
 
+  auto attrPartitionCache = makeXMLAttribute(ATTR_PARTITION_CACHE, "")
+                                .setDocumentation("Directory to store the partitions of the received meshes and the point-to-point communication maps in. "
+                                                  "A restart with identical meshes, numbers of ranks, and partitioning options loads the partitions "
+                                                  "instead of sending and re-partitioning the meshes, and loads the communication maps instead of "
+                                                  "exchanging the vertex distributions. Every participant and rank uses its own files, such that "
+                                                  "participants can share the directory. Not supported with two-level initialization. "
+                                                  "Leave empty to disable the cache.");
+
   auto attrFrom = XMLAttribute<std::string>("from")
                       .setDocumentation(
                           "First participant name involved in communication. For performance reasons, we recommend to use "
@@ -120,6 +128,7 @@ M2NConfiguration::M2NConfiguration(xml::XMLTag &parent)
     tag.addAttribute(attrTo);
     tag.addAttribute(attrEnforce);
     tag.addAttribute(attrTwoLevel);
+    tag.addAttribute(attrPartitionCache);
     parent.addSubtag(tag);
   }
 }
@@ -151,12 +160,16 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     std::string from = tag.getStringAttributeValue("from");
     std::string to   = tag.getStringAttributeValue("to");
     checkDuplicates(from, to);
-    bool enforceGatherScatter = tag.getBooleanAttributeValue(ATTR_ENFORCE_GATHER_SCATTER);
-    bool useTwoLevelInit      = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+    bool        enforceGatherScatter = tag.getBooleanAttributeValue(ATTR_ENFORCE_GATHER_SCATTER);
+    bool        useTwoLevelInit      = tag.getBooleanAttributeValue(ATTR_USE_TWO_LEVEL_INIT);
+    std::string partitionCache       = tag.getStringAttributeValue(ATTR_PARTITION_CACHE);
 
     if (enforceGatherScatter && useTwoLevelInit) {
       throw std::runtime_error{std::string{"A gather-scatter m2n communication cannot use two-level initialization. Please switch either "} + "\"" + ATTR_ENFORCE_GATHER_SCATTER + "\" or \"" + ATTR_USE_TWO_LEVEL_INIT + "\" off."};
     }
+    if (useTwoLevelInit && not partitionCache.empty()) {
+      throw std::runtime_error{std::string{"The partitions of an m2n communication with two-level initialization cannot be cached. Please remove either "} + "\"" + ATTR_PARTITION_CACHE + "\" or switch \"" + ATTR_USE_TWO_LEVEL_INIT + "\" off."};
+    }
     if (context.size == 1 && useTwoLevelInit) {
       throw std::runtime_error{"To use two-level initialization, both participants need to run in parallel. If you want to run in serial please switch two-level intialization off."};
     }
@@ -210,11 +223,11 @@ void M2NConfiguration::xmlTagCallback(const xml::ConfigurationContext &context,
     if (enforceGatherScatter) {
       distrFactory = std::make_shared<GatherScatterComFactory>(com);
     } else {
-      distrFactory = std::make_shared<PointToPointComFactory>(comFactory);
+      distrFactory = std::make_shared<PointToPointComFactory>(comFactory, partitionCache);
     }
     PRECICE_ASSERT(distrFactory.get() != nullptr);
 
-    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit);
+    auto m2n = std::make_shared<m2n::M2N>(com, distrFactory, false, useTwoLevelInit, partitionCache);
     _m2ns.emplace_back(m2n, from, to);
   }
 }
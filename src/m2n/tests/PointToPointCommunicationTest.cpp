@@ -2,8 +2,10 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/filesystem.hpp>
 #include <map>
 #include <memory>
+#include <string>
 #include <vector>
 #include "com/MPIPortsCommunicationFactory.hpp"
 #include "com/SharedPointer.hpp"
@@ -12,6 +14,7 @@
 #include "m2n/PointToPointCommunication.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
 #include "utils/MasterSlave.hpp"
@@ -499,6 +502,72 @@ void runP2PComLocalCommunicationMapTest(const TestContext &context, com::PtrComm
   }
 }
 
+/// same exchange as in runP2PComTest1, but the second connection loads the communication maps from the cache
+void runP2PComCacheTest(const TestContext &context, com::PtrCommunicationFactory cf)
+{
+  BOOST_TEST(context.hasSize(2));
+  const std::string directory = "p2p-cache-test-" + context.name;
+  if (context.isMaster()) {
+    boost::filesystem::remove_all(directory);
+  }
+
+  std::vector<int> globalIndices;
+  vector<double>   expectedData;
+  if (context.isNamed("A")) {
+    globalIndices = context.isMaster() ? std::vector<int>{0, 1, 3, 5, 7} : std::vector<int>{1, 2, 4, 5, 6};
+    expectedData  = context.isMaster() ? vector<double>{10 + 2, 4 * 20 + 3, 40 + 2, 4 * 60 + 3, 80 + 2} : vector<double>{4 * 20 + 3, 30 + 1, 50 + 2, 4 * 60 + 3, 70 + 1};
+  } else {
+    globalIndices = context.isMaster() ? std::vector<int>{1, 2, 5, 6} : std::vector<int>{0, 1, 3, 4, 5, 7};
+    expectedData  = context.isMaster() ? vector<double>{2 * 20, 30, 2 * 60, 70} : vector<double>{10, 2 * 20, 40, 50, 2 * 60, 80};
+  }
+
+  for (int run = 0; run < 2; ++run) {
+    mesh::PtrMesh mesh(new mesh::Mesh("Mesh", 2, testing::nextMeshID()));
+    for (int globalIndex : globalIndices) {
+      mesh->createVertex(Eigen::Vector2d(globalIndex, 0.0)).setGlobalIndex(globalIndex);
+    }
+    if (context.isMaster()) {
+      mesh->setGlobalNumberOfVertices(10);
+      if (context.isNamed("A")) {
+        mesh->getVertexDistribution()[0] = {0, 1, 3, 5, 7};
+        mesh->getVertexDistribution()[1] = {1, 2, 4, 5, 6};
+      } else {
+        mesh->getVertexDistribution()[0] = {1, 2, 5, 6};
+        mesh->getVertexDistribution()[1] = {0, 1, 3, 4, 5, 7};
+      }
+    }
+
+    m2n::PointToPointCommunication c(cf, mesh, directory);
+    vector<double>                 data;
+    if (context.isNamed("A")) {
+      data = context.isMaster() ? vector<double>{10, 20, 40, 60, 80} : vector<double>{20, 30, 50, 60, 70};
+      c.requestConnection("B", "A");
+      c.send(data);
+      c.receive(data);
+      BOOST_TEST(testing::equals(data, expectedData));
+    } else {
+      data.assign(globalIndices.size(), -1);
+      c.acceptConnection("B", "A");
+      c.receive(data);
+      BOOST_TEST(testing::equals(data, expectedData));
+      process(data);
+      c.send(data);
+    }
+    if (run == 0) {
+      BOOST_TEST(boost::filesystem::exists(directory + "/communication-" + context.name + "-Mesh-" + std::to_string(context.rank) + ".bin"));
+    }
+
+    // Loading the maps skips broadcasting the vertex distributions
+    if (not context.isMaster()) {
+      BOOST_TEST(mesh->getVertexDistribution().empty() == (run == 1));
+    }
+  }
+
+  if (context.isMaster()) {
+    boost::filesystem::remove_all(directory);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(Sockets)
 
 BOOST_AUTO_TEST_CASE(P2PComTest1)
@@ -550,6 +619,13 @@ BOOST_AUTO_TEST_CASE(P2PComLocalCommunicationMapTest)
   runP2PComLocalCommunicationMapTest(context, cf);
 }
 
+BOOST_AUTO_TEST_CASE(P2PComCacheTest)
+{
+  PRECICE_TEST("A"_on(2_ranks).setupMasterSlaves(), "B"_on(2_ranks).setupMasterSlaves(), Require::Events);
+  com::PtrCommunicationFactory cf(new com::SocketCommunicationFactory);
+  runP2PComCacheTest(context, cf);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Sockets
 
 BOOST_AUTO_TEST_SUITE(MPIPorts, *boost::unit_test::label("MPI_Ports"))
@@ -1,6 +1,9 @@
 #include "Mapping.hpp"
+#include <Eigen/Core>
+#include <algorithm>
 #include <boost/config.hpp>
 #include <ostream>
+#include "mesh/Data.hpp"
 #include "mesh/Utils.hpp"
 #include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
@@ -20,6 +23,13 @@ Mapping::Mapping(
 {
 }
 
+void Mapping::map(precice::span<const DataIDPair> dataIDs)
+{
+  for (const auto &ids : dataIDs) {
+    map(ids.first, ids.second);
+  }
+}
+
 void Mapping::setMeshes(
     const mesh::PtrMesh &input,
     const mesh::PtrMesh &output)
@@ -80,6 +90,84 @@ int Mapping::getDimensions() const
   return _dimensions;
 }
 
+void Mapping::setSparseOperator(SparseOperator sparseOperator)
+{
+  _sparseOperator = std::move(sparseOperator);
+  _sparseOperator.makeCompressed();
+}
+
+const Mapping::SparseOperator &Mapping::getSparseOperator() const
+{
+  return _sparseOperator;
+}
+
+void Mapping::clearSparseOperator()
+{
+  _sparseOperator = SparseOperator();
+}
+
+std::size_t Mapping::getSparseOperatorBytes() const
+{
+  using Index = SparseOperator::StorageIndex;
+  return _sparseOperator.nonZeros() * (sizeof(double) + sizeof(Index)) + (_sparseOperator.outerSize() + 1) * sizeof(Index);
+}
+
+int Mapping::getSparseOperatorBytesPerRow() const
+{
+  return getSparseOperatorBytes() / std::max<std::size_t>(1, _sparseOperator.rows());
+}
+
+void Mapping::mapWithSparseOperator(precice::span<const DataIDPair> dataIDs) const
+{
+  using RowMajorMatrix = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  const bool conservative = hasConstraint(CONSERVATIVE);
+  PRECICE_ASSERT(_sparseOperator.rows() == static_cast<Eigen::Index>((conservative ? input() : output())->vertices().size()),
+                 _sparseOperator.rows(), input()->vertices().size(), output()->vertices().size());
+  PRECICE_ASSERT(_sparseOperator.cols() == static_cast<Eigen::Index>((conservative ? output() : input())->vertices().size()),
+                 _sparseOperator.cols(), input()->vertices().size(), output()->vertices().size());
+
+  for (const auto &ids : dataIDs) {
+    const mesh::PtrData &inData     = input()->data(ids.first);
+    const mesh::PtrData &outData    = output()->data(ids.second);
+    const int            dimensions = inData->getDimensions();
+    PRECICE_ASSERT(dimensions == outData->getDimensions(), dimensions, outData->getDimensions());
+    PRECICE_ASSERT(inData->values().size() / dimensions == static_cast<Eigen::Index>(input()->vertices().size()),
+                   inData->values().size(), dimensions, input()->vertices().size());
+    PRECICE_ASSERT(outData->values().size() / dimensions == static_cast<Eigen::Index>(output()->vertices().size()),
+                   outData->values().size(), dimensions, output()->vertices().size());
+
+    // Rows of vertices and columns of components
+    Eigen::Map<const RowMajorMatrix> in(inData->values().data(), inData->values().size() / dimensions, dimensions);
+    Eigen::Map<RowMajorMatrix>       out(outData->values().data(), outData->values().size() / dimensions, dimensions);
+    if (conservative) {
+      out.noalias() += _sparseOperator.transpose() * in;
+    } else {
+      out.noalias() = _sparseOperator * in;
+    }
+  }
+}
+
+utils::ThreadPool *Mapping::getThreadPool()
+{
+  return nullptr;
+}
+
+std::vector<double> Mapping::getTaggingParameters() const
+{
+  return {};
+}
+
+std::vector<double> Mapping::getTaggingState() const
+{
+  return {};
+}
+
+void Mapping::setTaggingState(const std::vector<double> &state)
+{
+  PRECICE_ASSERT(state.empty(), state.size());
+}
+
 void Mapping::scaleConsistentMapping(int inputDataID, int outputDataID) const
 {
   // Only serial participant is supported for scale-consistent mapping
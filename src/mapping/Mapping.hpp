@@ -1,10 +1,20 @@
 #pragma once
 
+#include <Eigen/SparseCore>
+#include <cstddef>
 #include <iosfwd>
+#include <utility>
+#include <vector>
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "precice/types.hpp"
+#include "utils/span.hpp"
 
 namespace precice {
+namespace utils {
+class ThreadPool;
+}
+
 namespace mapping {
 
 /**
@@ -46,6 +56,12 @@ public:
     FULL = 2
   };
 
+  /// Pair of input and output data ID, which are mapped onto each other.
+  using DataIDPair = std::pair<DataID, DataID>;
+
+  /// Linear operator in compressed sparse row (CSR) format, which acts on all components of the values of a vertex alike.
+  using SparseOperator = Eigen::SparseMatrix<double, Eigen::RowMajor>;
+
   /// Constructor, takes mapping constraint.
   Mapping(Constraint constraint, int dimensions);
 
@@ -106,6 +122,18 @@ public:
       int inputDataID,
       int outputDataID) = 0;
 
+  /**
+   * @brief Maps several pairs of input and output data at once.
+   *
+   * All data use the same computed mapping. Mappings may override this to process
+   * all data in a single pass or to solve for them as multiple right-hand sides.
+   * The default implementation maps the pairs one after another.
+   *
+   * Pre-conditions:
+   * - hasComputedMapping() returns true
+   */
+  virtual void map(precice::span<const DataIDPair> dataIDs);
+
   /// Method used by partition. Tags vertices that could be owned by this rank.
   virtual void tagMeshFirstRound() = 0;
 
@@ -121,6 +149,22 @@ public:
    */
   virtual void scaleConsistentMapping(int inputDataID, int outputDataID) const;
 
+  /// Returns the threads which compute the mapping, nullptr if the mapping is computed serially.
+  virtual utils::ThreadPool *getThreadPool();
+
+  /// Returns the parameters besides the meshes which decide the vertices tagged by the mapping
+  virtual std::vector<double> getTaggingParameters() const;
+
+  /**
+   * @brief Returns what tagMeshFirstRound() computed besides the tags and computeMapping() relies on.
+   *
+   * Partitions loaded from a cache skip the tagging and restore this state with setTaggingState().
+   */
+  virtual std::vector<double> getTaggingState() const;
+
+  /// Restores a state returned by getTaggingState(), as if tagMeshFirstRound() had been called
+  virtual void setTaggingState(const std::vector<double> &state);
+
 protected:
   /// Returns pointer to input mesh.
   mesh::PtrMesh input() const;
@@ -136,6 +180,35 @@ protected:
 
   int getDimensions() const;
 
+  /**
+   * @brief Sets the computed operator of a linear mapping.
+   *
+   * The operator has a row per vertex of the mesh the mapping is computed from, i.e., the
+   * output mesh for consistent and the input mesh for conservative mappings, and a column per
+   * vertex of the other mesh.
+   */
+  void setSparseOperator(SparseOperator sparseOperator);
+
+  const SparseOperator &getSparseOperator() const;
+
+  /// Removes the computed operator
+  void clearSparseOperator();
+
+  /// Returns the memory used by the computed operator in bytes
+  std::size_t getSparseOperatorBytes() const;
+
+  /// Returns the average memory per row of the computed operator in bytes, which fits into the integer data of events
+  int getSparseOperatorBytesPerRow() const;
+
+  /**
+   * @brief Maps all pairs of data with the computed operator W.
+   *
+   * Consistent mappings compute output = W * input, conservative ones add W^T * input to the output.
+   * The values of all components of a vertex are contiguous, hence each data is a single
+   * sparse matrix product with a dense matrix of a column per component.
+   */
+  void mapWithSparseOperator(precice::span<const DataIDPair> dataIDs) const;
+
 private:
   /// Determines wether mapping is consistent or conservative.
   Constraint _constraint;
@@ -153,6 +226,9 @@ private:
   mesh::PtrMesh _output;
 
   int _dimensions;
+
+  /// Operator of linear mappings, see setSparseOperator()
+  SparseOperator _sparseOperator;
 };
 
 /** Defines an ordering for MeshRequirement in terms of specificality
@@ -1,13 +1,16 @@
 #include "NearestNeighborMapping.hpp"
 
 #include <Eigen/Core>
+#include <algorithm>
 #include <boost/container/flat_set.hpp>
 #include <functional>
 #include <memory>
+#include <vector>
 #include "logging/LogMacros.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
 #include "query/Index.hpp"
 #include "utils/Event.hpp"
@@ -21,8 +24,10 @@ namespace mapping {
 
 NearestNeighborMapping::NearestNeighborMapping(
     Constraint constraint,
-    int        dimensions)
-    : Mapping(constraint, dimensions)
+    int        dimensions,
+    int        threads)
+    : Mapping(constraint, dimensions),
+      _pool(threads)
 {
   if (hasConstraint(SCALEDCONSISTENT)) {
     setInputRequirement(Mapping::MeshRequirement::FULL);
@@ -59,18 +64,28 @@ void NearestNeighborMapping::computeMapping()
   query::Index          indexTree(searchSpace);
   e2.stop();
 
-  const size_t verticesSize   = origins->vertices().size();
-  const auto & sourceVertices = origins->vertices();
+  const size_t          verticesSize = origins->vertices().size();
+  const auto            coords       = mesh::packedCoordinates(*origins);
+  const Eigen::MatrixXd locations    = Eigen::Map<const Eigen::MatrixXd>(coords.data(), getDimensions(), verticesSize);
 
-  _vertexIndices.resize(verticesSize);
-  utils::statistics::DistanceAccumulator distanceStatistics;
+  precice::utils::Event e3(baseEvent + ".queryVertices", precice::syncMode);
+  const auto            matches = indexTree.getClosestVerticesBatched(locations, 1, &_pool);
+  e3.stop();
 
+  // Every origin takes the value of its nearest neighbor
+  std::vector<Eigen::Triplet<double>>    entries;
+  utils::statistics::DistanceAccumulator distanceStatistics;
+  entries.reserve(verticesSize);
   for (size_t i = 0; i < verticesSize; ++i) {
-    auto matchedVertex = indexTree.getClosestVertex(sourceVertices[i].getCoords());
-    _vertexIndices[i]  = matchedVertex.index;
-    distanceStatistics(matchedVertex.distance);
+    entries.emplace_back(i, matches[i].index, 1.0);
+    distanceStatistics(matches[i].distance);
   }
 
+  SparseOperator sparseOperator(verticesSize, searchSpace->vertices().size());
+  sparseOperator.setFromTriplets(entries.begin(), entries.end());
+  setSparseOperator(std::move(sparseOperator));
+  e.addData("OperatorBytesPerRow", getSparseOperatorBytesPerRow());
+
   if (distanceStatistics.empty()) {
     PRECICE_INFO("Mapping distance not available due to empty partition.");
   } else {
@@ -89,7 +104,7 @@ bool NearestNeighborMapping::hasComputedMapping() const
 void NearestNeighborMapping::clear()
 {
   PRECICE_TRACE();
-  _vertexIndices.clear();
+  clearSparseOperator();
   _hasComputedMapping = false;
   if (getConstraint() == CONSISTENT) {
     query::clearCache(input()->getID());
@@ -102,41 +117,21 @@ void NearestNeighborMapping::map(
     int inputDataID,
     int outputDataID)
 {
-  PRECICE_TRACE(inputDataID, outputDataID);
+  const DataIDPair dataIDs[] = {{inputDataID, outputDataID}};
+  map(dataIDs);
+}
+
+void NearestNeighborMapping::map(precice::span<const DataIDPair> dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
 
   precice::utils::Event e("map.nn.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
-  const Eigen::VectorXd &inputValues  = input()->data(inputDataID)->values();
-  Eigen::VectorXd &      outputValues = output()->data(outputDataID)->values();
-  //assign(outputValues) = 0.0;
-  int valueDimensions = input()->data(inputDataID)->getDimensions();
-  PRECICE_ASSERT(valueDimensions == output()->data(outputDataID)->getDimensions(),
-                 valueDimensions, output()->data(outputDataID)->getDimensions());
-  PRECICE_ASSERT(inputValues.size() / valueDimensions == (int) input()->vertices().size(),
-                 inputValues.size(), valueDimensions, input()->vertices().size());
-  PRECICE_ASSERT(outputValues.size() / valueDimensions == (int) output()->vertices().size(),
-                 outputValues.size(), valueDimensions, output()->vertices().size());
-
-  if (hasConstraint(CONSERVATIVE)) {
-    PRECICE_DEBUG("Map conservative");
-    size_t const inSize = input()->vertices().size();
-    for (size_t i = 0; i < inSize; i++) {
-      int const outputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues(outputIndex + dim) += inputValues((i * valueDimensions) + dim);
-      }
-    }
-  } else {
-    PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
-    size_t const outSize = output()->vertices().size();
-    for (size_t i = 0; i < outSize; i++) {
-      int inputIndex = _vertexIndices[i] * valueDimensions;
-      for (int dim = 0; dim < valueDimensions; dim++) {
-        outputValues((i * valueDimensions) + dim) = inputValues(inputIndex + dim);
-      }
-    }
-    if (hasConstraint(SCALEDCONSISTENT)) {
-      scaleConsistentMapping(inputDataID, outputDataID);
+  PRECICE_DEBUG((hasConstraint(CONSERVATIVE) ? "Map conservative" : (hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent")));
+  mapWithSparseOperator(dataIDs);
+  if (hasConstraint(SCALEDCONSISTENT)) {
+    for (const auto &ids : dataIDs) {
+      scaleConsistentMapping(ids.first, ids.second);
     }
   }
 }
@@ -149,7 +144,8 @@ void NearestNeighborMapping::tagMeshFirstRound()
   computeMapping();
 
   // Lookup table of all indices used in the mapping
-  const boost::container::flat_set<int> indexSet(_vertexIndices.begin(), _vertexIndices.end());
+  const SparseOperator &                sparseOperator = getSparseOperator();
+  const boost::container::flat_set<int> indexSet(sparseOperator.innerIndexPtr(), sparseOperator.innerIndexPtr() + sparseOperator.nonZeros());
 
   // Get the source mesh depending on the constraint
   const mesh::PtrMesh &source = hasConstraint(CONSERVATIVE) ? output() : input();
@@ -170,5 +166,10 @@ void NearestNeighborMapping::tagMeshSecondRound()
   // for NN mapping no operation needed here
 }
 
+utils::ThreadPool *NearestNeighborMapping::getThreadPool()
+{
+  return &_pool;
+}
+
 } // namespace mapping
 } // namespace precice
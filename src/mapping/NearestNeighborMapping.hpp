@@ -1,9 +1,8 @@
 #pragma once
 
-#include <string>
-#include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 namespace mapping {
@@ -16,8 +15,9 @@ public:
    *
    * @param[in] constraint Specifies mapping to be consistent or conservative.
    * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] threads Number of threads used to query the index, 0 uses all hardware threads
    */
-  NearestNeighborMapping(Constraint constraint, int dimensions);
+  NearestNeighborMapping(Constraint constraint, int dimensions, int threads = 1);
 
   /// Destructor, empty.
   virtual ~NearestNeighborMapping() {}
@@ -36,17 +36,22 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Maps several data at once with the computed operator.
+  virtual void map(precice::span<const DataIDPair> dataIDs) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
+  virtual utils::ThreadPool *getThreadPool() override;
+
 private:
   mutable logging::Logger _log{"mapping::NearestNeighborMapping"};
 
   /// Flag to indicate whether computeMapping() has been called.
   bool _hasComputedMapping = false;
 
-  /// Computed output vertex indices to map data from input vertices to.
-  std::vector<int> _vertexIndices;
+  /// Threads used to find the nearest neighbors
+  utils::ThreadPool _pool;
 };
 
 } // namespace mapping
@@ -15,6 +15,7 @@
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
+#include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
 #include "query/Index.hpp"
 #include "utils/Event.hpp"
@@ -102,17 +103,28 @@ void NearestProjectionMapping::computeMapping()
   query::Index                           indexTree(searchSpace);
   utils::statistics::DistanceAccumulator distanceStatistics;
 
-  _interpolations.clear();
-  _interpolations.reserve(fVertices.size());
+  // Every origin is interpolated from at most three vertices
+  std::vector<Eigen::Triplet<double>> entries;
+  entries.reserve(3 * fVertices.size());
 
-  for (const auto &fVertex : fVertices) {
-    // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
-    // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
-    auto match = indexTree.findNearestProjection(fVertex.getCoords(), nnearest);
-    _interpolations.push_back(std::move(match.polation));
+  const std::vector<double> locations = mesh::packedCoordinates(*origins);
+
+  // Nearest projection element is edge for 2d if exists, if not, it is the nearest vertex
+  // Nearest projection element is triangle for 3d if exists, if not the edge and at the worst case it is the nearest vertex
+  const auto matches = indexTree.findNearestProjectionBatched(locations, nnearest);
+  for (size_t i = 0; i < fVertices.size(); ++i) {
+    const auto &match = matches[i];
+    for (const auto &elem : match.polation.getWeightedElements()) {
+      entries.emplace_back(i, elem.vertexID, elem.weight);
+    }
     distanceStatistics(match.distance);
   }
 
+  SparseOperator sparseOperator(fVertices.size(), searchSpace->vertices().size());
+  sparseOperator.setFromTriplets(entries.begin(), entries.end());
+  setSparseOperator(std::move(sparseOperator));
+  e.addData("OperatorBytesPerRow", getSparseOperatorBytesPerRow());
+
   if (distanceStatistics.empty()) {
     PRECICE_INFO("Mapping distance not available due to empty partition.");
   } else {
@@ -130,7 +142,7 @@ bool NearestProjectionMapping::hasComputedMapping() const
 void NearestProjectionMapping::clear()
 {
   PRECICE_TRACE();
-  _interpolations.clear();
+  clearSparseOperator();
   _hasComputedMapping = false;
 }
 
@@ -138,53 +150,21 @@ void NearestProjectionMapping::map(
     int inputDataID,
     int outputDataID)
 {
-  PRECICE_TRACE(inputDataID, outputDataID);
+  const DataIDPair dataIDs[] = {{inputDataID, outputDataID}};
+  map(dataIDs);
+}
 
-  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+void NearestProjectionMapping::map(precice::span<const DataIDPair> dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
 
-  mesh::PtrData          inData    = input()->data(inputDataID);
-  mesh::PtrData          outData   = output()->data(outputDataID);
-  const Eigen::VectorXd &inValues  = inData->values();
-  Eigen::VectorXd &      outValues = outData->values();
-  //assign(outValues) = 0.0;
-  int dimensions = inData->getDimensions();
-  PRECICE_ASSERT(dimensions == outData->getDimensions());
+  precice::utils::Event e("map.np.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
-  if (hasConstraint(CONSERVATIVE)) {
-    PRECICE_ASSERT(getConstraint() == CONSERVATIVE, getConstraint());
-    PRECICE_DEBUG("Map conservative");
-    PRECICE_ASSERT(_interpolations.size() == input()->vertices().size(),
-                   _interpolations.size(), input()->vertices().size());
-    for (size_t i = 0; i < input()->vertices().size(); i++) {
-      size_t      inOffset = i * dimensions;
-      const auto &elems    = _interpolations[i].getWeightedElements();
-      for (const auto &elem : elems) {
-        size_t outOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
-  } else {
-    PRECICE_DEBUG("Map consistent");
-    PRECICE_ASSERT(_interpolations.size() == output()->vertices().size(),
-                   _interpolations.size(), output()->vertices().size());
-    for (size_t i = 0; i < output()->vertices().size(); i++) {
-      const auto &elems     = _interpolations[i].getWeightedElements();
-      size_t      outOffset = i * dimensions;
-      for (const auto &elem : elems) {
-        size_t inOffset = static_cast<size_t>(elem.vertexID) * dimensions;
-        for (int dim = 0; dim < dimensions; dim++) {
-          PRECICE_ASSERT(outOffset + dim < (size_t) outValues.size());
-          PRECICE_ASSERT(inOffset + dim < (size_t) inValues.size());
-          outValues(outOffset + dim) += elem.weight * inValues(inOffset + dim);
-        }
-      }
-    }
-    if (hasConstraint(SCALEDCONSISTENT)) {
-      scaleConsistentMapping(inputDataID, outputDataID);
+  PRECICE_DEBUG((hasConstraint(CONSERVATIVE) ? "Map conservative" : "Map consistent"));
+  mapWithSparseOperator(dataIDs);
+  if (hasConstraint(SCALEDCONSISTENT)) {
+    for (const auto &ids : dataIDs) {
+      scaleConsistentMapping(ids.first, ids.second);
     }
   }
 }
@@ -211,10 +191,11 @@ void NearestProjectionMapping::tagMeshFirstRound()
   std::unordered_set<int> tagged;
   const std::size_t       max_count = origins->vertices().size();
 
-  for (const Polation &interpolation : _interpolations) {
-    for (const auto &elem : interpolation.getWeightedElements()) {
-      if (!math::equals(elem.weight, 0.0)) {
-        tagged.insert(elem.vertexID);
+  const SparseOperator &sparseOperator = getSparseOperator();
+  for (Eigen::Index row = 0; row < sparseOperator.outerSize(); ++row) {
+    for (SparseOperator::InnerIterator elem(sparseOperator, row); elem; ++elem) {
+      if (!math::equals(elem.value(), 0.0)) {
+        tagged.insert(elem.col());
       }
     }
     // Shortcut if all vertices are tagged
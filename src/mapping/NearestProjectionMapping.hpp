@@ -1,11 +1,7 @@
 #pragma once
 
-#include <list>
-#include <string>
-#include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
-#include "mapping/Polation.hpp"
 
 namespace precice {
 namespace mapping {
@@ -43,14 +39,15 @@ public:
       int inputDataID,
       int outputDataID) override;
 
+  /// Maps several data at once with the computed operator.
+  virtual void map(precice::span<const DataIDPair> dataIDs) override;
+
   virtual void tagMeshFirstRound() override;
   virtual void tagMeshSecondRound() override;
 
 private:
   logging::Logger _log{"mapping::NearestProjectionMapping"};
 
-  std::vector<Polation> _interpolations;
-
   bool _hasComputedMapping = false;
 };
 
@@ -0,0 +1,753 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include <algorithm>
+#include <array>
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "impl/BasisFunctions.hpp"
+#include "impl/RBFAssembly.hpp"
+#include "logging/LogMacros.hpp"
+#include "math/differences.hpp"
+#include "mapping/Mapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "precice/types.hpp"
+#include "query/Index.hpp"
+#include "com/Communication.hpp"
+#include "utils/Event.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Partition of unity mapping with radial basis functions.
+ *
+ * The output mesh is covered by overlapping spherical clusters. For each cluster,
+ * a small RBF interpolant (including a linear polynomial) is built from the
+ * input vertices inside the cluster. The local interpolants are blended at the
+ * output vertices using Wendland C2 weights, which are normalized to form a
+ * partition of unity.
+ *
+ * Each rank only builds and factorizes its own local systems from the vertices
+ * it holds, thus no global mesh is gathered on the master rank. The required
+ * input vertices are determined while tagging the received mesh. The grid of
+ * the cluster centers is agreed on by all ranks, such that the result does not
+ * depend on the partitioning of the meshes.
+ *
+ * The radial basis function type has to be given as template parameter.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class PartitionOfUnityMapping : public Mapping {
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for mapping.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] verticesPerCluster Target number of input vertices in each cluster
+   * @param[in] relativeOverlap Overlap of neighboring clusters in (0, 1)
+   * @param[in] threads Number of threads computing the local systems, 0 uses all hardware threads
+   */
+  PartitionOfUnityMapping(
+      Constraint              constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      bool                    xDead,
+      bool                    yDead,
+      bool                    zDead,
+      int                     verticesPerCluster,
+      double                  relativeOverlap,
+      int                     threads = 1);
+
+  /// Computes the mapping coefficients from the in- and output mesh, needs to be called by all ranks.
+  void computeMapping() override;
+
+  /// Returns true, if computeMapping() has been called.
+  bool hasComputedMapping() const override;
+
+  /// Removes a computed mapping, keeps the cluster grid as long as neither mesh moved.
+  void clear() override;
+
+  /// Maps input data to output data from input mesh to output mesh.
+  void map(int inputDataID, int outputDataID) override;
+
+  /// Maps several data fields at once, applying each cluster once for all of them.
+  void map(precice::span<const DataIDPair> dataIDs) override;
+
+  /// Tags all vertices of the remote mesh which are part of a local cluster, needs to be called by all ranks.
+  void tagMeshFirstRound() override;
+
+  /// No operation, all required vertices are tagged in the first round.
+  void tagMeshSecondRound() override;
+
+  /// Returns the threads which compute the clusters.
+  utils::ThreadPool *getThreadPool() override;
+
+  /// Returns the parameters of the clusters, the support radius, and the dead axes
+  std::vector<double> getTaggingParameters() const override;
+
+  /// Returns the cluster grid computed while tagging, empty if there is none
+  std::vector<double> getTaggingState() const override;
+
+  /// Restores the cluster grid, which the filtered received mesh would not reproduce
+  void setTaggingState(const std::vector<double> &state) override;
+
+  /// Returns the number of clusters of the computed mapping.
+  size_t getNumberOfClusters() const
+  {
+    return _clusters.size();
+  }
+
+private:
+  precice::logging::Logger _log{"mapping::PartitionOfUnityMapping"};
+
+  /// A single cluster and its blended local evaluation operator
+  struct Cluster {
+    /// IDs of the vertices the local interpolant is built from
+    std::vector<VertexID> inIDs;
+
+    /// IDs of the vertices the local interpolant is evaluated at
+    std::vector<VertexID> outIDs;
+
+    /// Partition of unity weight of each vertex in outIDs
+    std::vector<double> weights;
+
+    /// Weighted evaluation operator of size outIDs x inIDs
+    Eigen::MatrixXd evaluationOperator;
+  };
+
+  /// Number of vertices sampled to estimate the cluster radius
+  static constexpr size_t CLUSTER_RADIUS_SAMPLES = 100;
+
+  /// Regular grid of the cluster centers, which is identical on all ranks
+  struct ClusterGrid {
+    /// Radius of the clusters
+    double radius;
+
+    /// Distance of neighboring cluster centers along each axis
+    double spacing;
+
+    /// Minimal corner of the output vertices of all ranks
+    Eigen::VectorXd origin;
+  };
+
+  bool _hasComputedMapping = false;
+
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// true if the mapping along some axis should be ignored
+  std::array<bool, 3> _deadAxis{};
+
+  int _verticesPerCluster;
+
+  double _relativeOverlap;
+
+  std::vector<Cluster> _clusters;
+
+  /// Grid of the cluster centers, computed while tagging the received mesh
+  ClusterGrid _clusterGrid;
+
+  /// true if _clusterGrid has been computed
+  bool _hasClusterGrid = false;
+
+  /// Move counts of the input and output mesh when _clusterGrid was computed, see mesh::Mesh::getMoveCount()
+  std::pair<int, int> _clusterGridMoveCounts{0, 0};
+
+  /// Threads computing the evaluation operators of the clusters
+  utils::ThreadPool _pool;
+
+  /// Number of linear polynomial terms of the local interpolants
+  int getPolynomialParameters() const;
+
+  /// Returns the current move counts of the input and output mesh
+  std::pair<int, int> getMoveCounts() const;
+
+  /**
+   * @brief Returns whether _clusterGrid belongs to the current vertex positions.
+   *
+   * The grid is computed while tagging, before the received mesh is filtered, as the filtered
+   * mesh would yield a different grid. It stays valid until a mesh moves, computeMapping() then
+   * computes the grid of the new positions.
+   */
+  bool hasValidClusterGrid() const;
+
+  /**
+   * @brief Samples the distances to the _verticesPerCluster-th nearest neighbor on a subset of the vertices.
+   *
+   * @returns the key of the vertex, the number of found neighbors, and the distance for every sample
+   */
+  std::vector<double> sampleClusterRadii(const mesh::PtrMesh &inMesh) const;
+
+  /**
+   * @brief Computes the grid of the cluster centers from the vertex positions on all ranks.
+   *
+   * The radius is the median of the sampled cluster radii of all ranks, the origin the minimal
+   * corner of the output vertices of all ranks. Both do not depend on the partitioning, as long
+   * as the ranks hold the input vertices around their output vertices. Needs to be called by all ranks.
+   */
+  ClusterGrid computeClusterGrid(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh);
+
+  /**
+   * @brief Creates the clusters and their weights from the vertex positions of both meshes.
+   *
+   * @param[in] inMesh Mesh containing the centers of the local interpolants
+   * @param[in] outMesh Mesh on which the local interpolants are evaluated
+   * @param[in] grid Grid of the cluster centers, see computeClusterGrid()
+   */
+  std::vector<Cluster> createClusters(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh, const ClusterGrid &grid);
+
+  /// Computes the weighted evaluation operator of a cluster
+  void computeEvaluationOperator(Cluster &cluster, const mesh::Mesh &inMesh, const mesh::Mesh &outMesh) const;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+constexpr size_t PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::CLUSTER_RADIUS_SAMPLES;
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::PartitionOfUnityMapping(
+    Constraint              constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead,
+    int                     verticesPerCluster,
+    double                  relativeOverlap,
+    int                     threads)
+    : Mapping(constraint, dimensions),
+      _basisFunction(function),
+      _verticesPerCluster(verticesPerCluster),
+      _relativeOverlap(relativeOverlap),
+      _pool(threads)
+{
+  if (constraint == SCALEDCONSISTENT) {
+    setInputRequirement(Mapping::MeshRequirement::FULL);
+    setOutputRequirement(Mapping::MeshRequirement::FULL);
+  } else {
+    setInputRequirement(Mapping::MeshRequirement::VERTEX);
+    setOutputRequirement(Mapping::MeshRequirement::VERTEX);
+  }
+  _deadAxis = {xDead, yDead, (dimensions == 3) && zDead};
+  PRECICE_CHECK(not(_deadAxis[0] && _deadAxis[1] && (dimensions == 2 || _deadAxis[2])),
+                "You cannot choose all axes to be dead for a RBF mapping");
+  PRECICE_CHECK(_verticesPerCluster > 0,
+                "The number of vertices per cluster of a partition of unity RBF mapping has to be larger than zero. "
+                "Please update the \"vertices-per-cluster\" attribute.");
+  // Without overlap, vertices at the corners of the grid cells are not covered by any cluster
+  PRECICE_CHECK(_relativeOverlap > 0.0 && _relativeOverlap < 1.0,
+                "The relative overlap of a partition of unity RBF mapping has to be in (0, 1). "
+                "Please update the \"relative-overlap\" attribute.");
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+int PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::getPolynomialParameters() const
+{
+  int polyparams = 1;
+  for (int d = 0; d < getDimensions(); ++d) {
+    if (not _deadAxis[d]) {
+      ++polyparams;
+    }
+  }
+  return polyparams;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::pair<int, int> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::getMoveCounts() const
+{
+  return {input()->getMoveCount(), output()->getMoveCount()};
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::hasValidClusterGrid() const
+{
+  return _hasClusterGrid && _clusterGridMoveCounts == getMoveCounts();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<double> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::sampleClusterRadii(const mesh::PtrMesh &inMesh) const
+{
+  PRECICE_ASSERT(not inMesh->vertices().empty());
+  const int dim = getDimensions();
+
+  // Sample the vertices with the smallest hashes of their coordinates. All ranks holding
+  // a vertex agree on its hash, thus the samples do not depend on the partitioning.
+  std::vector<std::pair<double, VertexID>> keys;
+  keys.reserve(inMesh->vertices().size());
+  for (const mesh::Vertex &v : inMesh->vertices()) {
+    std::size_t hash = 0;
+    for (int d = 0; d < dim; ++d) {
+      boost::hash_combine(hash, v.rawCoords()[d]);
+    }
+    // Keys of 53 bits are exactly representable as double
+    keys.emplace_back(static_cast<double>(static_cast<std::uint64_t>(hash) >> 11), v.getID());
+  }
+  const size_t samples = std::min(CLUSTER_RADIUS_SAMPLES, keys.size());
+  std::partial_sort(keys.begin(), keys.begin() + samples, keys.end());
+
+  // The distance to the k-th nearest neighbor only becomes larger if a rank lacks some of the neighbors
+  const int                       k = std::min<int>(_verticesPerCluster, inMesh->vertices().size());
+  query::Index                    index(inMesh);
+  std::vector<query::VertexMatch> matches(k);
+  std::vector<double>             triples;
+  triples.reserve(3 * samples);
+  for (size_t i = 0; i < samples; ++i) {
+    const int found = index.getClosestVertices(inMesh->vertices()[keys[i].second].rawCoords(), matches);
+    triples.push_back(keys[i].first);
+    triples.push_back(found);
+    triples.push_back(matches[found - 1].distance);
+  }
+  return triples;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::ClusterGrid
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeClusterGrid(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh)
+{
+  PRECICE_TRACE();
+  const int dim = getDimensions();
+
+  // Ranks without output vertices do not form clusters and thus do not contribute
+  std::vector<double> triples;
+  Eigen::VectorXd     origin = Eigen::VectorXd::Constant(dim, std::numeric_limits<double>::max());
+  if (not outMesh->vertices().empty()) {
+    for (const mesh::Vertex &v : outMesh->vertices()) {
+      origin = origin.cwiseMin(v.getCoords());
+    }
+    if (not inMesh->vertices().empty()) {
+      triples = sampleClusterRadii(inMesh);
+    }
+  }
+
+  if (utils::MasterSlave::isSlave()) {
+    utils::MasterSlave::_communication->send(triples, 0);
+    utils::MasterSlave::_communication->send(precice::span<const double>{origin.data(), static_cast<size_t>(dim)}, 0);
+  } else if (utils::MasterSlave::isMaster()) {
+    for (Rank rankSlave : utils::MasterSlave::allSlaves()) {
+      std::vector<double> slaveTriples;
+      utils::MasterSlave::_communication->receive(slaveTriples, rankSlave);
+      triples.insert(triples.end(), slaveTriples.begin(), slaveTriples.end());
+      Eigen::VectorXd slaveOrigin(dim);
+      utils::MasterSlave::_communication->receive(precice::span<double>{slaveOrigin.data(), static_cast<size_t>(dim)}, rankSlave);
+      origin = origin.cwiseMin(slaveOrigin);
+    }
+  }
+
+  // Vertices held by several ranks are sampled once, using the rank which found most and closest neighbors
+  std::map<double, std::pair<double, double>> samples;
+  for (size_t i = 0; i < triples.size(); i += 3) {
+    const std::pair<double, double> sample{-triples[i + 1], triples[i + 2]};
+    auto                            inserted = samples.emplace(triples[i], sample);
+    if (not inserted.second) {
+      inserted.first->second = std::min(inserted.first->second, sample);
+    }
+  }
+  std::vector<double> distances;
+  for (const auto &sample : samples) {
+    if (distances.size() == CLUSTER_RADIUS_SAMPLES) {
+      break;
+    }
+    distances.push_back(sample.second.second);
+  }
+
+  ClusterGrid grid;
+  grid.radius = math::NUMERICAL_ZERO_DIFFERENCE;
+  if (not distances.empty()) {
+    // The median is robust against vertices at the boundary of the partitions
+    auto median = distances.begin() + distances.size() / 2;
+    std::nth_element(distances.begin(), median, distances.end());
+    grid.radius = std::max(*median, math::NUMERICAL_ZERO_DIFFERENCE);
+  }
+  utils::MasterSlave::broadcast(grid.radius);
+  utils::MasterSlave::broadcast(precice::span<double>{origin.data(), static_cast<size_t>(dim)});
+  grid.origin = origin;
+
+  // The cluster centers form a regular grid. A vertex inside a grid cell is at
+  // most (1 - relativeOverlap) * radius away from the cell center.
+  grid.spacing = 2.0 * grid.radius * (1.0 - _relativeOverlap) / std::sqrt(static_cast<double>(dim));
+  PRECICE_DEBUG("Cluster radius {} and cluster spacing {}", grid.radius, grid.spacing);
+  return grid;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<typename PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::Cluster>
+PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::createClusters(const mesh::PtrMesh &inMesh, const mesh::PtrMesh &outMesh, const ClusterGrid &grid)
+{
+  PRECICE_TRACE();
+  std::vector<Cluster> clusters;
+  if (outMesh->vertices().empty()) {
+    return clusters;
+  }
+
+  const int minimalClusterSize = getPolynomialParameters() + 1;
+  PRECICE_CHECK(inMesh->vertices().size() >= static_cast<size_t>(minimalClusterSize),
+                "The partition of unity RBF mapping from mesh {} to mesh {} requires at least {} vertices on mesh {} on this rank, but only {} are available. "
+                "Please check your partitioning or increase the safety-factor of the received mesh.",
+                input()->getName(), output()->getName(), minimalClusterSize, inMesh->getName(), inMesh->vertices().size());
+
+  const double           radius  = grid.radius;
+  const double           spacing = grid.spacing;
+  const Eigen::VectorXd &origin  = grid.origin;
+  const int              dim     = getDimensions();
+
+  auto cellOf = [&](const mesh::Vertex &v) {
+    std::array<long, 3> cell{0, 0, 0};
+    for (int d = 0; d < dim; ++d) {
+      cell[d] = static_cast<long>(std::floor((v.rawCoords()[d] - origin[d]) / spacing));
+    }
+    return cell;
+  };
+
+  // Cells containing input vertices form clusters. All ranks hold the input vertices around their output
+  // vertices, thus the clusters covering an output vertex do not depend on the partitioning. Cells containing
+  // only output vertices are added to cover extrapolated vertices, these depend on the partitioning.
+  std::set<std::array<long, 3>> occupied;
+  for (const mesh::Vertex &v : inMesh->vertices()) {
+    occupied.insert(cellOf(v));
+  }
+  for (const mesh::Vertex &v : outMesh->vertices()) {
+    occupied.insert(cellOf(v));
+  }
+
+  // Only the occupied cells within the cluster radius of a local output vertex are required
+  std::set<std::array<long, 3>> cells;
+  for (const mesh::Vertex &v : outMesh->vertices()) {
+    std::array<long, 3> lower{0, 0, 0};
+    std::array<long, 3> upper{0, 0, 0};
+    for (int d = 0; d < dim; ++d) {
+      lower[d] = static_cast<long>(std::floor((v.rawCoords()[d] - radius - origin[d]) / spacing));
+      upper[d] = static_cast<long>(std::floor((v.rawCoords()[d] + radius - origin[d]) / spacing));
+    }
+    for (long i = lower[0]; i <= upper[0]; ++i) {
+      for (long j = lower[1]; j <= upper[1]; ++j) {
+        for (long k = lower[2]; k <= upper[2]; ++k) {
+          const std::array<long, 3> cell{i, j, k};
+          if (occupied.count(cell) > 0) {
+            cells.insert(cell);
+          }
+        }
+      }
+    }
+  }
+
+  query::Index inIndex(inMesh);
+  query::Index outIndex(outMesh);
+
+  Eigen::VectorXd weightSums = Eigen::VectorXd::Zero(outMesh->vertices().size());
+  for (const auto &cell : cells) {
+    Eigen::VectorXd center(dim);
+    for (int d = 0; d < dim; ++d) {
+      center[d] = origin[d] + (cell[d] + 0.5) * spacing;
+    }
+    const mesh::Vertex centerVertex(center, -1);
+
+    Cluster cluster;
+    for (VertexID outID : outIndex.getVerticesInsideBox(centerVertex, radius)) {
+      const auto   coords = outMesh->vertices()[outID].getCoords();
+      const double rho    = (coords - center).norm() / radius;
+      if (rho >= 1.0) {
+        continue;
+      }
+      // Wendland C2 function
+      const double weight = std::pow(1.0 - rho, 4) * (4.0 * rho + 1.0);
+      cluster.outIDs.push_back(outID);
+      cluster.weights.push_back(weight);
+      weightSums[outID] += weight;
+    }
+    if (cluster.outIDs.empty()) {
+      continue;
+    }
+
+    cluster.inIDs = inIndex.getVerticesInsideBox(centerVertex, radius);
+    // Enlarge the input of sparsely populated clusters to guarantee a well-posed local problem.
+    // The weights keep their support, such that the cells covering a vertex do not change.
+    if (cluster.inIDs.size() < static_cast<size_t>(minimalClusterSize)) {
+      auto         matches     = inIndex.getClosestVertices(center, minimalClusterSize);
+      const double inputRadius = std::max(radius, matches.back().distance * (1.0 + 1e-6));
+      cluster.inIDs            = inIndex.getVerticesInsideBox(centerVertex, inputRadius);
+    }
+    std::sort(cluster.inIDs.begin(), cluster.inIDs.end());
+    clusters.push_back(std::move(cluster));
+  }
+
+  for (const mesh::Vertex &v : outMesh->vertices()) {
+    PRECICE_CHECK(weightSums[v.getID()] > 0.0,
+                  "The vertex {} of mesh {} is not covered by any cluster of the partition of unity RBF mapping from mesh {} to mesh {}. "
+                  "Please increase the \"relative-overlap\" attribute.",
+                  v.getCoords(), outMesh->getName(), input()->getName(), output()->getName());
+  }
+
+  // Normalize the weights to form a partition of unity
+  for (Cluster &cluster : clusters) {
+    for (size_t i = 0; i < cluster.outIDs.size(); ++i) {
+      cluster.weights[i] /= weightSums[cluster.outIDs[i]];
+    }
+  }
+  return clusters;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeEvaluationOperator(Cluster &cluster, const mesh::Mesh &inMesh, const mesh::Mesh &outMesh) const
+{
+  const int inSize  = cluster.inIDs.size();
+  const int outSize = cluster.outIDs.size();
+
+  Eigen::MatrixXd matrixC;
+  Eigen::MatrixXd matrixA;
+  impl::dispatchAxes(getDimensions(), impl::deadAxisMask(_deadAxis, getDimensions()), [&](auto axes) {
+    using AXES     = decltype(axes);
+    const auto in  = impl::gatherCoordinates<AXES>(inMesh, cluster.inIDs);
+    const auto out = impl::gatherCoordinates<AXES>(outMesh, cluster.outIDs);
+    matrixC        = impl::assembleSystemMatrix(_basisFunction, in);
+    matrixA        = impl::assembleEvaluationMatrix(_basisFunction, in, out);
+  });
+
+  // As C is symmetric, (A C^-1)^T = C^-1 A^T. Local systems of nearly planar
+  // clusters may be rank-deficient in the polynomial part. They are, however,
+  // consistent and the column-pivoting QR yields a valid solution.
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> qr(matrixC);
+  Eigen::MatrixXd                             operatorT = qr.solve(matrixA.transpose());
+
+  Eigen::Map<const Eigen::VectorXd> weights(cluster.weights.data(), outSize);
+  cluster.evaluationOperator = weights.asDiagonal() * operatorT.topRows(inSize).transpose();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.pou.computeMapping.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(input()->getDimensions() == output()->getDimensions(),
+                 input()->getDimensions(), output()->getDimensions());
+  PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
+                 getDimensions(), output()->getDimensions());
+
+  mesh::PtrMesh inMesh;
+  mesh::PtrMesh outMesh;
+  if (hasConstraint(CONSERVATIVE)) {
+    inMesh  = output();
+    outMesh = input();
+  } else { // Consistent or scaled consistent
+    inMesh  = input();
+    outMesh = output();
+  }
+
+  // The received mesh has been filtered after tagging, a grid computed from it would require input
+  // vertices which have been filtered out. Meshes which have not been tagged are complete.
+  if (not hasValidClusterGrid()) {
+    _clusterGrid           = computeClusterGrid(inMesh, outMesh);
+    _hasClusterGrid        = true;
+    _clusterGridMoveCounts = getMoveCounts();
+  }
+  _clusters = createClusters(inMesh, outMesh, _clusterGrid);
+  // The clusters are independent, computeEvaluationOperator only reads the meshes
+  _pool.parallelFor(0, _clusters.size(), 1, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t i = begin; i < end; ++i) {
+      computeEvaluationOperator(_clusters[i], *inMesh, *outMesh);
+    }
+  });
+  e.addData("clusters", static_cast<int>(_clusters.size()));
+
+  PRECICE_DEBUG("Computed {} clusters", _clusters.size());
+  _hasComputedMapping = true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
+{
+  return _hasComputedMapping;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::clear()
+{
+  PRECICE_TRACE();
+  _clusters.clear();
+  _hasComputedMapping = false;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::map(
+    int inputDataID,
+    int outputDataID)
+{
+  const DataIDPair dataIDs[] = {{inputDataID, outputDataID}};
+  map(dataIDs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::map(precice::span<const DataIDPair> dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
+  precice::utils::Event e("map.pou.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  PRECICE_ASSERT(_hasComputedMapping);
+
+  // Views on all data values, with one column per vertex. The data are stacked on top of each other
+  // in the local matrices of the clusters, such that each cluster is applied once for all data.
+  std::vector<Eigen::Map<const Eigen::MatrixXd>> in;
+  std::vector<Eigen::Map<Eigen::MatrixXd>>       out;
+  int                                            components = 0;
+  for (const auto &ids : dataIDs) {
+    const int valueDim = input()->data(ids.first)->getDimensions();
+    PRECICE_ASSERT(valueDim == output()->data(ids.second)->getDimensions(),
+                   valueDim, output()->data(ids.second)->getDimensions());
+
+    const Eigen::VectorXd &inValues  = input()->data(ids.first)->values();
+    Eigen::VectorXd &      outValues = output()->data(ids.second)->values();
+    outValues.setZero();
+
+    in.emplace_back(inValues.data(), valueDim, inValues.size() / valueDim);
+    out.emplace_back(outValues.data(), valueDim, outValues.size() / valueDim);
+    components += valueDim;
+  }
+
+  auto gather = [&](const std::vector<VertexID> &vertexIDs) {
+    Eigen::MatrixXd local(components, vertexIDs.size());
+    int             row = 0;
+    for (const auto &values : in) {
+      for (size_t i = 0; i < vertexIDs.size(); ++i) {
+        local.col(i).segment(row, values.rows()) = values.col(vertexIDs[i]);
+      }
+      row += values.rows();
+    }
+    return local;
+  };
+
+  auto scatter = [&](const Eigen::MatrixXd &result, const std::vector<VertexID> &vertexIDs) {
+    int row = 0;
+    for (auto &values : out) {
+      for (size_t i = 0; i < vertexIDs.size(); ++i) {
+        values.col(vertexIDs[i]) += result.col(i).segment(row, values.rows());
+      }
+      row += values.rows();
+    }
+  };
+
+  if (hasConstraint(CONSERVATIVE)) {
+    PRECICE_DEBUG("Map conservative");
+    // The clusters map from the output to the input mesh, thus the transposed operator is applied
+    for (const Cluster &cluster : _clusters) {
+      scatter(gather(cluster.outIDs) * cluster.evaluationOperator, cluster.inIDs);
+    }
+  } else {
+    PRECICE_DEBUG((hasConstraint(CONSISTENT) ? "Map consistent" : "Map scaled-consistent"));
+    for (const Cluster &cluster : _clusters) {
+      scatter(gather(cluster.inIDs) * cluster.evaluationOperator.transpose(), cluster.outIDs);
+    }
+    if (hasConstraint(SCALEDCONSISTENT)) {
+      for (const auto &ids : dataIDs) {
+        scaleConsistentMapping(ids.first, ids.second);
+      }
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshFirstRound()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.pou.tagMeshFirstRound.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  mesh::PtrMesh filterMesh, otherMesh;
+  if (hasConstraint(CONSERVATIVE)) {
+    filterMesh = output(); // remote
+    otherMesh  = input();  // local
+  } else {
+    filterMesh = input();  // remote
+    otherMesh  = output(); // local
+  }
+
+  // The grid is kept for computeMapping(), which only sees the filtered mesh
+  _clusterGrid           = computeClusterGrid(filterMesh, otherMesh);
+  _hasClusterGrid        = true;
+  _clusterGridMoveCounts = getMoveCounts();
+
+  if (otherMesh->vertices().empty()) {
+    return; // Ranks not at the interface should never hold interface vertices
+  }
+
+  // Too few vertices to form a single cluster, keep all of them
+  if (filterMesh->vertices().size() <= static_cast<size_t>(getPolynomialParameters())) {
+    filterMesh->tagAll();
+    return;
+  }
+
+  // Tag all vertices which take part in a local interpolant
+  for (const Cluster &cluster : createClusters(filterMesh, otherMesh, _clusterGrid)) {
+    for (VertexID id : cluster.inIDs) {
+      filterMesh->vertices()[id].tag();
+    }
+  }
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
+{
+  PRECICE_TRACE();
+  // for partition of unity mapping no operation needed here
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+utils::ThreadPool *PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::getThreadPool()
+{
+  return &_pool;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<double> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::getTaggingParameters() const
+{
+  // The cluster radius follows from the number of vertices per cluster
+  std::vector<double> parameters{static_cast<double>(_verticesPerCluster), _relativeOverlap, _basisFunction.getSupportRadius()};
+  parameters.insert(parameters.end(), _deadAxis.begin(), _deadAxis.end());
+  return parameters;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<double> PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::getTaggingState() const
+{
+  if (not hasValidClusterGrid()) {
+    return {};
+  }
+  std::vector<double> state{_clusterGrid.radius, _clusterGrid.spacing};
+  state.insert(state.end(), _clusterGrid.origin.data(), _clusterGrid.origin.data() + _clusterGrid.origin.size());
+  return state;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void PartitionOfUnityMapping<RADIAL_BASIS_FUNCTION_T>::setTaggingState(const std::vector<double> &state)
+{
+  PRECICE_TRACE(state.size());
+  if (state.empty()) {
+    return;
+  }
+  PRECICE_ASSERT(state.size() == static_cast<size_t>(2 + getDimensions()), state.size(), getDimensions());
+  _clusterGrid.radius    = state[0];
+  _clusterGrid.spacing   = state[1];
+  _clusterGrid.origin    = Eigen::Map<const Eigen::VectorXd>(state.data() + 2, getDimensions());
+  _hasClusterGrid        = true;
+  _clusterGridMoveCounts = getMoveCounts();
+}
+
+} // namespace mapping
+} // namespace precice
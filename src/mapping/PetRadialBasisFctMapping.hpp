@@ -87,12 +87,18 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps several data one after another, each as a separate KSP solve.
+  using Mapping::map;
+
   friend struct MappingTests::PetRadialBasisFunctionMapping::Serial::SolutionCaching;
 
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
 
+  /// Returns the support radius and the dead axes
+  virtual std::vector<double> getTaggingParameters() const override;
+
 private:
   /// Stores col -> value for each row. Used to return the already computed values from the preconditioning
   using VertexData = std::vector<std::vector<std::pair<int, double>>>;
@@ -956,6 +962,14 @@ void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
   std::for_each(vertices.begin(), vertices.end(), [&mesh](size_t v) { mesh->vertices()[v].tag(); });
 }
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::vector<double> PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getTaggingParameters() const
+{
+  std::vector<double> parameters{_basisFunction.getSupportRadius()};
+  parameters.insert(parameters.end(), _deadAxis.begin(), _deadAxis.end());
+  return parameters;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 void PetRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::printMappingInfo(int inputDataID, int dim) const
 {
@@ -1,18 +1,27 @@
 #pragma once
 
 #include <Eigen/Core>
-#include <Eigen/QR>
+#include <algorithm>
+#include <string>
+#include <typeinfo>
+#include <utility>
 
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
 #include "impl/BasisFunctions.hpp"
+#include "impl/DenseAlgebra.hpp"
+#include "impl/InterpolationSolver.hpp"
+#include "impl/OperatorCache.hpp"
+#include "impl/RBFAssembly.hpp"
 #include "mapping/Mapping.hpp"
 #include "mesh/Filter.hpp"
+#include "mesh/Utils.hpp"
 #include "precice/types.hpp"
 #include "query/Index.hpp"
-#include "utils/EigenHelperFunctions.hpp"
 #include "utils/Event.hpp"
+#include "utils/Fingerprint.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -40,6 +49,9 @@ public:
    * @param[in] dimensions Dimensionality of the meshes
    * @param[in] function Radial basis function used for mapping.
    * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] precomputeOperator Forms the evaluation operator A * C^-1 in computeMapping()
+   * @param[in] threads Number of threads used within the rank, 0 uses all hardware threads
+   * @param[in] cacheDirectory Directory to store and load evaluation operators, implies precomputeOperator. Empty disables the cache.
    */
   RadialBasisFctMapping(
       Constraint              constraint,
@@ -47,7 +59,10 @@ public:
       RADIAL_BASIS_FUNCTION_T function,
       bool                    xDead,
       bool                    yDead,
-      bool                    zDead);
+      bool                    zDead,
+      bool                    precomputeOperator = false,
+      int                     threads            = 1,
+      std::string             cacheDirectory     = "");
 
   /// Computes the mapping coefficients from the in- and output mesh.
   virtual void computeMapping() override;
@@ -61,27 +76,85 @@ public:
   /// Maps input data to output data from input mesh to output mesh.
   virtual void map(int inputDataID, int outputDataID) override;
 
+  /// Maps several data fields at once, solving for all of them as multiple right-hand sides.
+  virtual void map(precice::span<const DataIDPair> dataIDs) override;
+
   virtual void tagMeshFirstRound() override;
 
   virtual void tagMeshSecondRound() override;
 
+  virtual utils::ThreadPool *getThreadPool() override;
+
+  /// Returns the support radius and the dead axes
+  virtual std::vector<double> getTaggingParameters() const override;
+
+protected:
+  /// Radial basis function type used in interpolation.
+  RADIAL_BASIS_FUNCTION_T _basisFunction;
+
+  /// true if the mapping along some axis should be ignored
+  std::vector<bool> _deadAxis;
+
+  /// Threads used for the assembly, the decomposition, and the evaluation on the master or in serial
+  utils::ThreadPool _pool;
+
+  /**
+   * @brief Assembles and decomposes the interpolation system of the gathered meshes.
+   *
+   * Only called on the master or in serial.
+   *
+   * @returns false if the interpolation matrix is singular
+   */
+  virtual bool computeInterpolation(const mesh::PtrMesh &globalInMesh, const mesh::PtrMesh &globalOutMesh);
+
+  /// Returns A * C^-1 * in for the gathered input data in, every column is one data component
+  virtual Eigen::MatrixXd evaluateConsistent(const Eigen::MatrixXd &in);
+
+  /// Returns C^-1 * A^T * in for the gathered input data in, every column is one data component
+  virtual Eigen::MatrixXd evaluateConservative(const Eigen::MatrixXd &in);
+
+  /// Releases the interpolation system
+  virtual void clearInterpolation();
+
 private:
   precice::logging::Logger _log{"mapping::RadialBasisFctMapping"};
 
   bool _hasComputedMapping = false;
 
-  /// Radial basis function type used in interpolation.
-  RADIAL_BASIS_FUNCTION_T _basisFunction;
+  /// Number of vertices of the gathered input mesh, i.e., the columns of A without the polynomial
+  Eigen::Index _globalInputSize = 0;
+
+  /// Number of vertices of the gathered output mesh, i.e., the rows of A
+  Eigen::Index _globalOutputSize = 0;
 
   Eigen::MatrixXd _matrixA;
 
-  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
+  /// Decomposition of the interpolation matrix C
+  impl::InterpolationSolver _solver;
 
-  /// true if the mapping along some axis should be ignored
-  std::vector<bool> _deadAxis;
+  /**
+   * @brief true if _matrixA is replaced by the evaluation operator A * C^-1 in computeMapping().
+   *
+   * Every map() is then a single matrix product over all data components,
+   * instead of a solve with _solver and a product with _matrixA per component.
+   * This pays off for stationary meshes, which are mapped many times.
+   */
+  bool _precomputeOperator;
+
+  /// Evaluation operators of previous runs, indexed by operatorFingerprint()
+  impl::OperatorCache _operatorCache;
+
+  /// Upper bound of the temporary memory used to form the evaluation operator
+  static constexpr size_t OPERATOR_BLOCK_BYTES = 64 * 1024 * 1024;
 
-  void mapConservative(int inputDataID, int outputDataID, int polyparams);
-  void mapConsistent(int inputDataID, int outputDataID, int polyparams);
+  void mapConservative(precice::span<const DataIDPair> dataIDs, int polyparams);
+  void mapConsistent(precice::span<const DataIDPair> dataIDs, int polyparams);
+
+  /// Replaces _matrixA by A * C^-1 and releases the decomposition _solver.
+  void computeEvaluationOperator();
+
+  /// Hashes the gathered meshes and the configuration, which determine the evaluation operator
+  utils::Fingerprint operatorFingerprint(const mesh::Mesh &globalInMesh, const mesh::Mesh &globalOutMesh) const;
 
   void setDeadAxis(bool xDead, bool yDead, bool zDead)
   {
@@ -112,9 +185,15 @@ RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::RadialBasisFctMapping(
     RADIAL_BASIS_FUNCTION_T function,
     bool                    xDead,
     bool                    yDead,
-    bool                    zDead)
+    bool                    zDead,
+    bool                    precomputeOperator,
+    int                     threads,
+    std::string             cacheDirectory)
     : Mapping(constraint, dimensions),
-      _basisFunction(function)
+      _basisFunction(function),
+      _pool(threads),
+      _precomputeOperator(precomputeOperator || not cacheDirectory.empty()),
+      _operatorCache(std::move(cacheDirectory))
 {
   if (constraint == SCALEDCONSISTENT) {
     setInputRequirement(Mapping::MeshRequirement::FULL);
@@ -161,38 +240,39 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
 
   } else { // Parallel Master or Serial
 
-    mesh::Mesh globalInMesh("globalInMesh", inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
-    mesh::Mesh globalOutMesh("globalOutMesh", outMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
+    mesh::PtrMesh globalInMesh(new mesh::Mesh("globalInMesh", inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED));
+    mesh::PtrMesh globalOutMesh(new mesh::Mesh("globalOutMesh", outMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED));
 
     if (utils::MasterSlave::isMaster()) {
       {
         // Input mesh may have overlaps
         mesh::Mesh filteredInMesh("filteredInMesh", inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
         mesh::filterMesh(filteredInMesh, *inMesh, [&](const mesh::Vertex &v) { return v.isOwner(); });
-        globalInMesh.addMesh(filteredInMesh);
-        globalOutMesh.addMesh(*outMesh);
+        globalInMesh->addMesh(filteredInMesh);
+        globalOutMesh->addMesh(*outMesh);
       }
 
       // Receive mesh
       for (Rank rankSlave : utils::MasterSlave::allSlaves()) {
         mesh::Mesh slaveInMesh(inMesh->getName(), inMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
         com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(slaveInMesh, rankSlave);
-        globalInMesh.addMesh(slaveInMesh);
+        globalInMesh->addMesh(slaveInMesh);
 
         mesh::Mesh slaveOutMesh(outMesh->getName(), outMesh->getDimensions(), mesh::Mesh::MESH_ID_UNDEFINED);
         com::CommunicateMesh(utils::MasterSlave::_communication).receiveMesh(slaveOutMesh, rankSlave);
-        globalOutMesh.addMesh(slaveOutMesh);
+        globalOutMesh->addMesh(slaveOutMesh);
       }
 
     } else { // Serial
-      globalInMesh.addMesh(*inMesh);
-      globalOutMesh.addMesh(*outMesh);
+      globalInMesh->addMesh(*inMesh);
+      globalOutMesh->addMesh(*outMesh);
     }
 
-    _matrixA = buildMatrixA(_basisFunction, globalInMesh, globalOutMesh, _deadAxis);
-    _qr      = buildMatrixCLU(_basisFunction, globalInMesh, _deadAxis).colPivHouseholderQr();
+    _globalInputSize  = globalInMesh->vertices().size();
+    _globalOutputSize = globalOutMesh->vertices().size();
 
-    PRECICE_CHECK(_qr.isInvertible(),
+    const bool invertible = computeInterpolation(globalInMesh, globalOutMesh);
+    PRECICE_CHECK(invertible,
                   "The interpolation matrix of the RBF mapping from mesh {} to mesh {} is not invertable. "
                   "This means that the mapping problem is not well-posed. "
                   "Please check if your coupling meshes are correct. Maybe you need to fix axis-aligned mapping setups "
@@ -203,6 +283,109 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeMapping()
   PRECICE_DEBUG("Compute Mapping is Completed.");
 } // namespace mapping
 
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeInterpolation(const mesh::PtrMesh &globalInMesh, const mesh::PtrMesh &globalOutMesh)
+{
+  PRECICE_TRACE();
+  const int         polyparams = 1 + getDimensions() - std::count(_deadAxis.begin(), _deadAxis.end(), true);
+  utils::Fingerprint fingerprint;
+  if (_operatorCache.isEnabled()) {
+    fingerprint = operatorFingerprint(*globalInMesh, *globalOutMesh);
+    if (_operatorCache.load(fingerprint, _globalOutputSize, _globalInputSize + polyparams, _matrixA)) {
+      PRECICE_INFO("Loaded the evaluation operator of the mapping from mesh {} to mesh {} from {}",
+                   input()->getName(), output()->getName(), _operatorCache.filename(fingerprint.value()));
+      return true;
+    }
+  }
+
+  _matrixA = buildMatrixA(_basisFunction, *globalInMesh, *globalOutMesh, _deadAxis, &_pool);
+  {
+    precice::utils::Event eDecomposition("map.rbf.decomposeMatrix.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+    _solver.compute(buildMatrixCLU(_basisFunction, *globalInMesh, _deadAxis, &_pool), polyparams,
+                    RADIAL_BASIS_FUNCTION_T::isStrictlyPositiveDefinite(), _pool);
+    PRECICE_DEBUG("Decomposed the interpolation matrix using {} with {} threads",
+                  _solver.usesCholesky() ? "Cholesky" : "QR", _pool.size());
+  }
+
+  if (not _solver.isInvertible()) {
+    return false;
+  }
+  if (_precomputeOperator) {
+    computeEvaluationOperator();
+    if (_operatorCache.isEnabled()) {
+      _operatorCache.store(fingerprint, _matrixA);
+    }
+  }
+  return true;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateConsistent(const Eigen::MatrixXd &in)
+{
+  Eigen::MatrixXd out;
+  if (_precomputeOperator) {
+    impl::multiply(_matrixA, in, out, _pool);
+  } else {
+    impl::multiply(_matrixA, _solver.solve(in, _pool), out, _pool);
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateConservative(const Eigen::MatrixXd &in)
+{
+  Eigen::MatrixXd out;
+  impl::multiplyTransposed(_matrixA, in, out, _pool);
+  if (not _precomputeOperator) {
+    out = _solver.solve(out, _pool);
+  }
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clearInterpolation()
+{
+  _matrixA = Eigen::MatrixXd();
+  _solver.clear();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeEvaluationOperator()
+{
+  PRECICE_TRACE();
+  precice::utils::Event e("map.rbf.computeEvaluationOperator.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
+
+  // C is symmetric, hence the rows of A * C^-1 are the columns of C^-1 * A^T.
+  // Every row only depends on the same row of A, which allows to overwrite A
+  // block by block. The block size bounds the temporary memory for large output meshes.
+  const Eigen::Index n         = _matrixA.cols();
+  const Eigen::Index blockSize = std::max<Eigen::Index>(1, OPERATOR_BLOCK_BYTES / (n * sizeof(double)));
+  for (Eigen::Index begin = 0; begin < _matrixA.rows(); begin += blockSize) {
+    const Eigen::Index rows  = std::min(blockSize, _matrixA.rows() - begin);
+    Eigen::MatrixXd    block = _solver.solve(_matrixA.middleRows(begin, rows).transpose(), _pool);
+    _matrixA.middleRows(begin, rows) = block.transpose();
+  }
+  _solver.clear();
+  PRECICE_DEBUG("Computed evaluation operator of size {}x{}", _matrixA.rows(), _matrixA.cols());
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+utils::Fingerprint RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::operatorFingerprint(const mesh::Mesh &globalInMesh, const mesh::Mesh &globalOutMesh) const
+{
+  utils::Fingerprint fingerprint;
+  fingerprint.add(std::string(typeid(RADIAL_BASIS_FUNCTION_T).name()));
+  for (double parameter : _basisFunction.getParameters()) {
+    fingerprint.add(parameter);
+  }
+  fingerprint.add(getConstraint());
+  for (bool dead : _deadAxis) {
+    fingerprint.add(dead);
+  }
+  mesh::addToFingerprint(fingerprint, globalInMesh);
+  mesh::addToFingerprint(fingerprint, globalOutMesh);
+  return fingerprint;
+}
+
 template <typename RADIAL_BASIS_FUNCTION_T>
 bool RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::hasComputedMapping() const
 {
@@ -213,8 +396,7 @@ template <typename RADIAL_BASIS_FUNCTION_T>
 void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clear()
 {
   PRECICE_TRACE();
-  _matrixA            = Eigen::MatrixXd();
-  _qr                 = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  clearInterpolation();
   _hasComputedMapping = false;
 }
 
@@ -223,7 +405,14 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
     int inputDataID,
     int outputDataID)
 {
-  PRECICE_TRACE(inputDataID, outputDataID);
+  const DataIDPair dataIDs[] = {{inputDataID, outputDataID}};
+  map(dataIDs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(precice::span<const DataIDPair> dataIDs)
+{
+  PRECICE_TRACE(dataIDs.size());
 
   precice::utils::Event e("map.rbf.mapData.From" + input()->getName() + "To" + output()->getName(), precice::syncMode);
 
@@ -232,10 +421,10 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
                  input()->getDimensions(), output()->getDimensions());
   PRECICE_ASSERT(getDimensions() == output()->getDimensions(),
                  getDimensions(), output()->getDimensions());
-  {
-    int valueDim = input()->data(inputDataID)->getDimensions();
-    PRECICE_ASSERT(valueDim == output()->data(outputDataID)->getDimensions(),
-                   valueDim, output()->data(outputDataID)->getDimensions());
+  for (const auto &ids : dataIDs) {
+    int valueDim = input()->data(ids.first)->getDimensions();
+    PRECICE_ASSERT(valueDim == output()->data(ids.second)->getDimensions(),
+                   valueDim, output()->data(ids.second)->getDimensions());
   }
   int deadDimensions = 0;
   for (int d = 0; d < getDimensions(); d++) {
@@ -245,42 +434,23 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::map(
   int polyparams = 1 + getDimensions() - deadDimensions;
 
   if (hasConstraint(CONSERVATIVE)) {
-    mapConservative(inputDataID, outputDataID, polyparams);
+    mapConservative(dataIDs, polyparams);
   } else {
-    mapConsistent(inputDataID, outputDataID, polyparams);
+    mapConsistent(dataIDs, polyparams);
   }
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDataID, int outputDataID, int polyparams)
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(precice::span<const DataIDPair> dataIDs, int polyparams)
 {
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
+  PRECICE_TRACE(dataIDs.size(), polyparams);
 
   // Gather input data
   if (utils::MasterSlave::isSlave()) {
 
-    const auto &localInData = input()->data(inputDataID)->values();
-
-    int localOutputSize = 0;
-    for (const auto &vertex : output()->vertices()) {
-      if (vertex.isOwner()) {
-        ++localOutputSize;
-      }
-    }
-
-    localOutputSize *= output()->data(outputDataID)->getDimensions();
-
-    utils::MasterSlave::_communication->send(localInData, 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
-
-  } else { // Parallel Master or Serial case
-
-    std::vector<double> globalInValues;
-    std::vector<double> outputValueSizes;
-    {
-      const auto &localInData = input()->data(inputDataID)->values();
-      globalInValues.insert(globalInValues.begin(), localInData.data(), localInData.data() + localInData.size());
+    for (const auto &ids : dataIDs) {
+      const auto &localInData = input()->data(ids.first)->values();
 
       int localOutputSize = 0;
       for (const auto &vertex : output()->vertices()) {
@@ -289,85 +459,124 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDa
         }
       }
 
-      localOutputSize *= output()->data(outputDataID)->getDimensions();
+      localOutputSize *= output()->data(ids.second)->getDimensions();
 
-      outputValueSizes.push_back(localOutputSize);
+      utils::MasterSlave::_communication->send(localInData, 0);
+      utils::MasterSlave::_communication->send(localOutputSize, 0);
     }
 
-    {
-      std::vector<double> slaveBuffer;
-      int                 slaveOutputValueSize;
-      for (Rank rank : utils::MasterSlave::allSlaves()) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        globalInValues.insert(globalInValues.end(), slaveBuffer.begin(), slaveBuffer.end());
+  } else { // Parallel Master or Serial case
 
-        utils::MasterSlave::_communication->receive(slaveOutputValueSize, rank);
-        outputValueSizes.push_back(slaveOutputValueSize);
-      }
+    // Every component of every data field forms one column of the right-hand side
+    int components = 0;
+    for (const auto &ids : dataIDs) {
+      components += output()->data(ids.second)->getDimensions();
     }
+    Eigen::MatrixXd               in(_globalOutputSize, components);
+    std::vector<std::vector<int>> outputValueSizes(dataIDs.size());
+
+    int column = 0;
+    for (size_t field = 0; field < dataIDs.size(); ++field) {
+      const int inputDataID  = dataIDs[field].first;
+      const int outputDataID = dataIDs[field].second;
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
+      std::vector<double> globalInValues;
+      {
+        const auto &localInData = input()->data(inputDataID)->values();
+        globalInValues.insert(globalInValues.begin(), localInData.data(), localInData.data() + localInData.size());
 
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
-    Eigen::VectorXd             outputValues((_matrixA.cols() - polyparams) * valueDim);
-    outputValues.setZero();
+        int localOutputSize = 0;
+        for (const auto &vertex : output()->vertices()) {
+          if (vertex.isOwner()) {
+            ++localOutputSize;
+          }
+        }
 
-    Eigen::VectorXd Au(_matrixA.cols());  // rows == n
-    Eigen::VectorXd in(_matrixA.rows());  // rows == outputSize
-    Eigen::VectorXd out(_matrixA.cols()); // rows == n
+        localOutputSize *= output()->data(outputDataID)->getDimensions();
 
-    for (int dim = 0; dim < valueDim; dim++) {
-      for (int i = 0; i < in.size(); i++) { // Fill input data values
-        in[i] = inputValues(i * valueDim + dim);
+        outputValueSizes[field].push_back(localOutputSize);
       }
 
-      Au  = _matrixA.transpose() * in;
-      out = _qr.solve(Au);
+      {
+        std::vector<double> slaveBuffer;
+        int                 slaveOutputValueSize;
+        for (Rank rank : utils::MasterSlave::allSlaves()) {
+          utils::MasterSlave::_communication->receive(slaveBuffer, rank);
+          globalInValues.insert(globalInValues.end(), slaveBuffer.begin(), slaveBuffer.end());
+
+          utils::MasterSlave::_communication->receive(slaveOutputValueSize, rank);
+          outputValueSizes[field].push_back(slaveOutputValueSize);
+        }
+      }
 
-      // Copy mapped data to output data values
-      for (int i = 0; i < out.size() - polyparams; i++) {
-        outputValues[i * valueDim + dim] = out[i];
+      int valueDim = output()->data(outputDataID)->getDimensions();
+
+      // Fill input data values
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < in.rows(); i++) {
+          in(i, column + dim) = globalInValues[i * valueDim + dim];
+        }
       }
+      column += valueDim;
     }
 
-    // Data scattering to slaves
-    if (utils::MasterSlave::isMaster()) {
+    // Solve for all components at once, the polynomial entries of the result are dropped
+    const Eigen::MatrixXd out = evaluateConservative(in); // rows == n
 
-      // Filter data
-      int outputCounter = 0;
-      for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
-        if (output()->vertices()[i].isOwner()) {
-          for (int dim = 0; dim < valueDim; ++dim) {
-            output()->data(outputDataID)->values()[i * valueDim + dim] = outputValues(outputCounter);
-            ++outputCounter;
-          }
+    column = 0;
+    for (size_t field = 0; field < dataIDs.size(); ++field) {
+      const int outputDataID = dataIDs[field].second;
+      const int valueDim     = output()->data(outputDataID)->getDimensions();
+
+      // Copy mapped data to output data values
+      Eigen::VectorXd outputValues(_globalInputSize * valueDim);
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < out.rows() - polyparams; i++) {
+          outputValues[i * valueDim + dim] = out(i, column + dim);
         }
       }
+      column += valueDim;
 
       // Data scattering to slaves
-      int beginPoint = outputValueSizes.at(0);
-      for (Rank rank : utils::MasterSlave::allSlaves()) {
-        precice::span<const double> toSend{outputValues.data() + beginPoint, static_cast<size_t>(outputValueSizes.at(rank))};
-        utils::MasterSlave::_communication->send(toSend, rank);
-        beginPoint += outputValueSizes.at(rank);
+      if (utils::MasterSlave::isMaster()) {
+
+        // Filter data
+        int outputCounter = 0;
+        for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
+          if (output()->vertices()[i].isOwner()) {
+            for (int dim = 0; dim < valueDim; ++dim) {
+              output()->data(outputDataID)->values()[i * valueDim + dim] = outputValues(outputCounter);
+              ++outputCounter;
+            }
+          }
+        }
+
+        // Data scattering to slaves
+        int beginPoint = outputValueSizes[field].at(0);
+        for (Rank rank : utils::MasterSlave::allSlaves()) {
+          precice::span<const double> toSend{outputValues.data() + beginPoint, static_cast<size_t>(outputValueSizes[field].at(rank))};
+          utils::MasterSlave::_communication->send(toSend, rank);
+          beginPoint += outputValueSizes[field].at(rank);
+        }
+      } else { // Serial
+        output()->data(outputDataID)->values() = outputValues;
       }
-    } else { // Serial
-      output()->data(outputDataID)->values() = outputValues;
     }
   }
   if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
+    for (const auto &ids : dataIDs) {
+      std::vector<double> receivedValues;
+      utils::MasterSlave::_communication->receive(receivedValues, 0);
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
+      int valueDim = output()->data(ids.second)->getDimensions();
 
-    int outputCounter = 0;
-    for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
-      if (output()->vertices()[i].isOwner()) {
-        for (int dim = 0; dim < valueDim; ++dim) {
-          output()->data(outputDataID)->values()[i * valueDim + dim] = receivedValues.at(outputCounter);
-          ++outputCounter;
+      int outputCounter = 0;
+      for (int i = 0; i < static_cast<int>(output()->vertices().size()); ++i) {
+        if (output()->vertices()[i].isOwner()) {
+          for (int dim = 0; dim < valueDim; ++dim) {
+            output()->data(ids.second)->values()[i * valueDim + dim] = receivedValues.at(outputCounter);
+            ++outputCounter;
+          }
         }
       }
     }
@@ -375,102 +584,122 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConservative(int inputDa
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(int inputDataID, int outputDataID, int polyparams)
+void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::mapConsistent(precice::span<const DataIDPair> dataIDs, int polyparams)
 {
 
-  PRECICE_TRACE(inputDataID, outputDataID, polyparams);
+  PRECICE_TRACE(dataIDs.size(), polyparams);
 
   // Gather input data
   if (utils::MasterSlave::isSlave()) {
-    // Input data is filtered
-    auto localInDataFiltered = input()->getOwnedVertexData(inputDataID);
-    int  localOutputSize     = output()->data(outputDataID)->values().size();
-
-    // Send data and output size
-    utils::MasterSlave::_communication->send(localInDataFiltered, 0);
-    utils::MasterSlave::_communication->send(localOutputSize, 0);
+    for (const auto &ids : dataIDs) {
+      // Input data is filtered
+      auto localInDataFiltered = input()->getOwnedVertexData(ids.first);
+      int  localOutputSize     = output()->data(ids.second)->values().size();
+
+      // Send data and output size
+      utils::MasterSlave::_communication->send(localInDataFiltered, 0);
+      utils::MasterSlave::_communication->send(localOutputSize, 0);
+    }
 
   } else { // Master or Serial case
 
-    int valueDim = output()->data(outputDataID)->getDimensions();
-
-    std::vector<double> globalInValues((_matrixA.cols() - polyparams) * valueDim, 0.0);
-    std::vector<int>    outValuesSize;
-
-    if (utils::MasterSlave::isMaster()) { // Parallel case
+    // Every component of every data field forms one column of the right-hand side
+    int components = 0;
+    for (const auto &ids : dataIDs) {
+      components += output()->data(ids.second)->getDimensions();
+    }
+    Eigen::MatrixXd in(_globalInputSize + polyparams, components); // rows == n
+    in.setZero();
+    std::vector<std::vector<int>> outValuesSizes(dataIDs.size());
 
-      // Filter input data
-      const auto &localInData = input()->getOwnedVertexData(inputDataID);
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
+    int column = 0;
+    for (size_t field = 0; field < dataIDs.size(); ++field) {
+      const int inputDataID   = dataIDs[field].first;
+      const int outputDataID  = dataIDs[field].second;
+      const int valueDim      = output()->data(outputDataID)->getDimensions();
+      auto &    outValuesSize = outValuesSizes[field];
 
-      int inputSizeCounter = localInData.size();
-      int slaveOutDataSize{0};
+      std::vector<double> globalInValues(_globalInputSize * valueDim, 0.0);
 
-      std::vector<double> slaveBuffer;
+      if (utils::MasterSlave::isMaster()) { // Parallel case
 
-      for (Rank rank : utils::MasterSlave::allSlaves()) {
-        utils::MasterSlave::_communication->receive(slaveBuffer, rank);
-        std::copy(slaveBuffer.begin(), slaveBuffer.end(), globalInValues.begin() + inputSizeCounter);
-        inputSizeCounter += slaveBuffer.size();
+        // Filter input data
+        const auto &localInData = input()->getOwnedVertexData(inputDataID);
+        std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
+        outValuesSize.push_back(output()->data(outputDataID)->values().size());
 
-        utils::MasterSlave::_communication->receive(slaveOutDataSize, rank);
-        outValuesSize.push_back(slaveOutDataSize);
-      }
+        int inputSizeCounter = localInData.size();
+        int slaveOutDataSize{0};
 
-    } else { // Serial case
-      const auto &localInData = input()->data(inputDataID)->values();
-      std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
-      outValuesSize.push_back(output()->data(outputDataID)->values().size());
-    }
+        std::vector<double> slaveBuffer;
 
-    Eigen::VectorXd p(_matrixA.cols());   // rows == n
-    Eigen::VectorXd in(_matrixA.cols());  // rows == n
-    Eigen::VectorXd out(_matrixA.rows()); // rows == outputSize
-    in.setZero();
+        for (Rank rank : utils::MasterSlave::allSlaves()) {
+          utils::MasterSlave::_communication->receive(slaveBuffer, rank);
+          std::copy(slaveBuffer.begin(), slaveBuffer.end(), globalInValues.begin() + inputSizeCounter);
+          inputSizeCounter += slaveBuffer.size();
 
-    // Construct Eigen vectors
-    Eigen::Map<Eigen::VectorXd> inputValues(globalInValues.data(), globalInValues.size());
+          utils::MasterSlave::_communication->receive(slaveOutDataSize, rank);
+          outValuesSize.push_back(slaveOutDataSize);
+        }
 
-    Eigen::VectorXd outputValues((_matrixA.rows()) * valueDim);
-    outputValues.setZero();
+      } else { // Serial case
+        const auto &localInData = input()->data(inputDataID)->values();
+        std::copy(localInData.data(), localInData.data() + localInData.size(), globalInValues.begin());
+        outValuesSize.push_back(output()->data(outputDataID)->values().size());
+      }
 
-    // For every data dimension, perform mapping
-    for (int dim = 0; dim < valueDim; dim++) {
       // Fill input from input data values (last polyparams entries remain zero)
-      for (int i = 0; i < in.size() - polyparams; i++) {
-        in[i] = inputValues[i * valueDim + dim];
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < in.rows() - polyparams; i++) {
+          in(i, column + dim) = globalInValues[i * valueDim + dim];
+        }
       }
+      column += valueDim;
+    }
+
+    // Solve and evaluate for all components at once
+    const Eigen::MatrixXd out = evaluateConsistent(in); // rows == outputSize
 
-      p   = _qr.solve(in);
-      out = _matrixA * p;
+    column = 0;
+    for (size_t field = 0; field < dataIDs.size(); ++field) {
+      const int   outputDataID  = dataIDs[field].second;
+      const int   valueDim      = output()->data(outputDataID)->getDimensions();
+      const auto &outValuesSize = outValuesSizes[field];
 
-      // Copy mapped data to ouptut data values
-      for (int i = 0; i < out.size(); i++) {
-        outputValues[i * valueDim + dim] = out[i];
+      // Copy mapped data to output data values
+      Eigen::VectorXd outputValues(_globalOutputSize * valueDim);
+      for (int dim = 0; dim < valueDim; dim++) {
+        for (int i = 0; i < out.rows(); i++) {
+          outputValues[i * valueDim + dim] = out(i, column + dim);
+        }
       }
-    }
+      column += valueDim;
 
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
+      output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(outputValues.data(), outValuesSize.at(0));
 
-    // Data scattering to slaves
-    int beginPoint = outValuesSize.at(0);
+      // Data scattering to slaves
+      int beginPoint = outValuesSize.at(0);
 
-    if (utils::MasterSlave::isMaster()) {
-      for (Rank rank : utils::MasterSlave::allSlaves()) {
-        precice::span<const double> toSend{outputValues.data() + beginPoint, static_cast<size_t>(outValuesSize.at(rank))};
-        utils::MasterSlave::_communication->send(toSend, rank);
-        beginPoint += outValuesSize.at(rank);
+      if (utils::MasterSlave::isMaster()) {
+        for (Rank rank : utils::MasterSlave::allSlaves()) {
+          precice::span<const double> toSend{outputValues.data() + beginPoint, static_cast<size_t>(outValuesSize.at(rank))};
+          utils::MasterSlave::_communication->send(toSend, rank);
+          beginPoint += outValuesSize.at(rank);
+        }
       }
     }
   }
   if (utils::MasterSlave::isSlave()) {
-    std::vector<double> receivedValues;
-    utils::MasterSlave::_communication->receive(receivedValues, 0);
-    output()->data(outputDataID)->values() = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
+    for (const auto &ids : dataIDs) {
+      std::vector<double> receivedValues;
+      utils::MasterSlave::_communication->receive(receivedValues, 0);
+      output()->data(ids.second)->values() = Eigen::Map<Eigen::VectorXd>(receivedValues.data(), receivedValues.size());
+    }
   }
   if (hasConstraint(SCALEDCONSISTENT)) {
-    scaleConsistentMapping(inputDataID, outputDataID);
+    for (const auto &ids : dataIDs) {
+      scaleConsistentMapping(ids.first, ids.second);
+    }
   }
 }
 
@@ -536,83 +765,46 @@ void RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::tagMeshSecondRound()
   std::for_each(vertices.begin(), vertices.end(), [&mesh](size_t v) { mesh->vertices()[v].tag(); });
 }
 
-// ------- Non-Member Functions ---------
-
 template <typename RADIAL_BASIS_FUNCTION_T>
-Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, std::vector<bool> deadAxis)
+utils::ThreadPool *RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getThreadPool()
 {
-  int inputSize  = inputMesh.vertices().size();
-  int dimensions = inputMesh.getDimensions();
-
-  int deadDimensions = 0;
-  for (int d = 0; d < dimensions; d++) {
-    if (deadAxis[d])
-      deadDimensions += 1;
-  }
-
-  int polyparams = 1 + dimensions - deadDimensions;
-  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
-  int n = inputSize + polyparams; // Add linear polynom degrees
-
-  Eigen::MatrixXd matrixCLU(n, n);
-  matrixCLU.setZero();
-
-  for (int i = 0; i < inputSize; ++i) {
-    for (int j = i; j < inputSize; ++j) {
-      const auto &u   = inputMesh.vertices()[i].getCoords();
-      const auto &v   = inputMesh.vertices()[j].getCoords();
-      matrixCLU(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
-    }
-
-    const auto reduced = utils::reduceVector(inputMesh.vertices()[i].getCoords(), deadAxis);
-
-    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixCLU(i, inputSize + 1 + dim) = reduced[dim];
-    }
-    matrixCLU(i, inputSize) = 1.0;
-  }
-
-  matrixCLU.triangularView<Eigen::Lower>() = matrixCLU.transpose();
-
-  return matrixCLU;
+  return &_pool;
 }
 
 template <typename RADIAL_BASIS_FUNCTION_T>
-Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const mesh::Mesh &outputMesh, std::vector<bool> deadAxis)
+std::vector<double> RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::getTaggingParameters() const
 {
-  int inputSize  = inputMesh.vertices().size();
-  int outputSize = outputMesh.vertices().size();
-  int dimensions = inputMesh.getDimensions();
-
-  int deadDimensions = 0;
-  for (int d = 0; d < dimensions; d++) {
-    if (deadAxis[d])
-      deadDimensions += 1;
-  }
-
-  int polyparams = 1 + dimensions - deadDimensions;
-  PRECICE_ASSERT(inputSize >= 1 + polyparams, inputSize);
-  int n = inputSize + polyparams; // Add linear polynom degrees
-
-  Eigen::MatrixXd matrixA(outputSize, n);
-  matrixA.setZero();
+  std::vector<double> parameters{_basisFunction.getSupportRadius()};
+  parameters.insert(parameters.end(), _deadAxis.begin(), _deadAxis.end());
+  return parameters;
+}
 
-  // Fill _matrixA with values
-  for (int i = 0; i < outputSize; ++i) {
-    for (int j = 0; j < inputSize; ++j) {
-      const auto &u = outputMesh.vertices()[i].getCoords();
-      const auto &v = inputMesh.vertices()[j].getCoords();
-      matrixA(i, j) = basisFunction.evaluate(utils::reduceVector((u - v), deadAxis).norm());
-    }
+// ------- Non-Member Functions ---------
 
-    const auto reduced = utils::reduceVector(outputMesh.vertices()[i].getCoords(), deadAxis);
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd buildMatrixCLU(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, std::vector<bool> deadAxis, utils::ThreadPool *pool = nullptr)
+{
+  const int dimensions = inputMesh.getDimensions();
+  const int polyparams = 1 + dimensions - std::count(deadAxis.begin(), deadAxis.end(), true);
+  PRECICE_ASSERT(static_cast<int>(inputMesh.vertices().size()) >= 1 + polyparams, inputMesh.vertices().size());
+
+  return impl::dispatchAxes(dimensions, impl::deadAxisMask(deadAxis, dimensions), [&](auto axes) {
+    using AXES = decltype(axes);
+    return impl::assembleSystemMatrix(basisFunction, impl::gatherCoordinates<AXES>(inputMesh), pool);
+  });
+}
 
-    for (int dim = 0; dim < dimensions - deadDimensions; dim++) {
-      matrixA(i, inputSize + 1 + dim) = reduced[dim];
-    }
-    matrixA(i, inputSize) = 1.0;
-  }
-  return matrixA;
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd buildMatrixA(RADIAL_BASIS_FUNCTION_T basisFunction, const mesh::Mesh &inputMesh, const mesh::Mesh &outputMesh, std::vector<bool> deadAxis, utils::ThreadPool *pool = nullptr)
+{
+  const int dimensions = inputMesh.getDimensions();
+  const int polyparams = 1 + dimensions - std::count(deadAxis.begin(), deadAxis.end(), true);
+  PRECICE_ASSERT(static_cast<int>(inputMesh.vertices().size()) >= 1 + polyparams, inputMesh.vertices().size());
+
+  return impl::dispatchAxes(dimensions, impl::deadAxisMask(deadAxis, dimensions), [&](auto axes) {
+    using AXES = decltype(axes);
+    return impl::assembleEvaluationMatrix(basisFunction, impl::gatherCoordinates<AXES>(inputMesh), impl::gatherCoordinates<AXES>(outputMesh), pool);
+  });
 }
 
 } // namespace mapping
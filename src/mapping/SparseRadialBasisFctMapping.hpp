@@ -0,0 +1,243 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include "impl/RBFAssembly.hpp"
+#include "impl/SparseInterpolationSolver.hpp"
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mesh/BoundingBox.hpp"
+#include "query/Index.hpp"
+#include "utils/Event.hpp"
+
+namespace precice {
+extern bool syncMode;
+
+namespace mapping {
+
+/**
+ * @brief Mapping with radial basis functions of compact support, based on sparse matrices.
+ *
+ * Gathers the meshes and data on the master like RadialBasisFctMapping, but only evaluates
+ * the basis function for pairs of vertices within the support radius, found by a spatial
+ * index. The interpolation system is solved by a sparse Cholesky decomposition or a
+ * preconditioned conjugate gradient method, see impl::SparseInterpolationSolver.
+ * In contrast to PetRadialBasisFctMapping, this does not require PETSc.
+ */
+template <typename RADIAL_BASIS_FUNCTION_T>
+class SparseRadialBasisFctMapping : public RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> {
+  static_assert(RADIAL_BASIS_FUNCTION_T::hasCompactSupport(), "Sparse RBF mappings require basis functions with compact support.");
+
+public:
+  using Method = impl::SparseInterpolationSolver::Method;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] constraint Specifies mapping to be consistent or conservative.
+   * @param[in] dimensions Dimensionality of the meshes
+   * @param[in] function Radial basis function used for mapping.
+   * @param[in] xDead, yDead, zDead Deactivates mapping along an axis
+   * @param[in] method Solver of the sparse interpolation system
+   * @param[in] solverRtol Relative tolerance of the conjugate gradient solver
+   * @param[in] recycledSolutions Number of previous solutions the conjugate gradient solver starts from, 0 disables it
+   */
+  SparseRadialBasisFctMapping(
+      Mapping::Constraint     constraint,
+      int                     dimensions,
+      RADIAL_BASIS_FUNCTION_T function,
+      bool                    xDead,
+      bool                    yDead,
+      bool                    zDead,
+      Method                  method            = Method::Cholesky,
+      double                  solverRtol        = 1e-9,
+      int                     recycledSolutions = 0);
+
+protected:
+  bool computeInterpolation(const mesh::PtrMesh &globalInMesh, const mesh::PtrMesh &globalOutMesh) override;
+
+  Eigen::MatrixXd evaluateConsistent(const Eigen::MatrixXd &in) override;
+
+  Eigen::MatrixXd evaluateConservative(const Eigen::MatrixXd &in) override;
+
+  void clearInterpolation() override;
+
+private:
+  precice::logging::Logger _log{"mapping::SparseRadialBasisFctMapping"};
+
+  /// Basis function part of the evaluation matrix A
+  Eigen::SparseMatrix<double, Eigen::RowMajor> _kernelA;
+
+  /// Polynomial part of the evaluation matrix A
+  Eigen::MatrixXd _polynomialA;
+
+  impl::SparseInterpolationSolver _sparseSolver;
+
+  /// Returns the box around coords which contains the support of a basis function, unbounded along dead axes
+  std::pair<mesh::Vertex::RawCoords, mesh::Vertex::RawCoords> supportBox(const mesh::Vertex::RawCoords &coords) const;
+
+  /**
+   * @brief Evaluates the basis function between the points and all centers within its support.
+   *
+   * @param[in] pointsMesh, points the mesh and the active coordinates of the rows
+   * @param[in] index, centers the index and the active coordinates of the mesh of the columns
+   * @param[in] includeEntry filters the entries (row, column) to be stored
+   */
+  template <typename AXES, typename Filter>
+  std::vector<Eigen::Triplet<double>> collectEntries(const mesh::Mesh &pointsMesh, const impl::Coordinates<AXES::activeDimensions> &points,
+                                                     query::Index &index, const impl::Coordinates<AXES::activeDimensions> &centers,
+                                                     Filter &&includeEntry) const;
+};
+
+// --------------------------------------------------- HEADER IMPLEMENTATIONS
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::SparseRadialBasisFctMapping(
+    Mapping::Constraint     constraint,
+    int                     dimensions,
+    RADIAL_BASIS_FUNCTION_T function,
+    bool                    xDead,
+    bool                    yDead,
+    bool                    zDead,
+    Method                  method,
+    double                  solverRtol,
+    int                     recycledSolutions)
+    : RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>(constraint, dimensions, function, xDead, yDead, zDead),
+      _sparseSolver(method, solverRtol, recycledSolutions)
+{
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+bool SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::computeInterpolation(const mesh::PtrMesh &globalInMesh, const mesh::PtrMesh &globalOutMesh)
+{
+  PRECICE_TRACE(globalInMesh->vertices().size(), globalOutMesh->vertices().size());
+  const int dimensions = this->getDimensions();
+  const int polyparams = 1 + dimensions - std::count(this->_deadAxis.begin(), this->_deadAxis.end(), true);
+  PRECICE_ASSERT(static_cast<int>(globalInMesh->vertices().size()) >= 1 + polyparams, globalInMesh->vertices().size());
+
+  // The gathered meshes have no ID, hence make sure no index of another such mesh is reused
+  query::clearCache(*globalInMesh);
+  query::Index index(globalInMesh);
+
+  const Eigen::Index inputSize  = globalInMesh->vertices().size();
+  const Eigen::Index outputSize = globalOutMesh->vertices().size();
+
+  impl::SparseInterpolationSolver::SparseMatrix matrixK(inputSize, inputSize);
+  Eigen::MatrixXd                               polynomialK(inputSize, polyparams);
+  _kernelA.resize(outputSize, inputSize);
+  _polynomialA.resize(outputSize, polyparams);
+
+  impl::dispatchAxes(dimensions, impl::deadAxisMask(this->_deadAxis, dimensions), [&](auto axes) {
+    using AXES              = decltype(axes);
+    const auto inputCoords  = impl::gatherCoordinates<AXES>(*globalInMesh);
+    const auto outputCoords = impl::gatherCoordinates<AXES>(*globalOutMesh);
+
+    // Only the lower triangle of the symmetric K is stored
+    const auto lowerEntries = collectEntries<AXES>(*globalInMesh, inputCoords, index, inputCoords,
+                                                   [](Eigen::Index row, Eigen::Index column) { return column <= row; });
+    matrixK.setFromTriplets(lowerEntries.begin(), lowerEntries.end());
+    polynomialK.col(0).setOnes();
+    polynomialK.rightCols(polyparams - 1) = inputCoords;
+
+    const auto entriesA = collectEntries<AXES>(*globalOutMesh, outputCoords, index, inputCoords,
+                                               [](Eigen::Index, Eigen::Index) { return true; });
+    _kernelA.setFromTriplets(entriesA.begin(), entriesA.end());
+    _polynomialA.col(0).setOnes();
+    _polynomialA.rightCols(polyparams - 1) = outputCoords;
+  });
+  PRECICE_DEBUG("Assembled sparse interpolation matrix with {} and evaluation matrix with {} non-zeros",
+                matrixK.nonZeros(), _kernelA.nonZeros());
+
+  precice::utils::Event eDecomposition("map.rbf.decomposeMatrix.From" + this->input()->getName() + "To" + this->output()->getName(), precice::syncMode);
+  _sparseSolver.compute(std::move(matrixK), std::move(polynomialK));
+  return _sparseSolver.isInvertible();
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+std::pair<mesh::Vertex::RawCoords, mesh::Vertex::RawCoords> SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::supportBox(const mesh::Vertex::RawCoords &coords) const
+{
+  const double            radius = this->_basisFunction.getSupportRadius();
+  mesh::Vertex::RawCoords min{}, max{};
+  for (int d = 0; d < this->getDimensions(); ++d) {
+    if (this->_deadAxis[d]) {
+      min[d] = std::numeric_limits<double>::lowest();
+      max[d] = std::numeric_limits<double>::max();
+    } else {
+      min[d] = coords[d] - radius;
+      max[d] = coords[d] + radius;
+    }
+  }
+  return {min, max};
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+template <typename AXES, typename Filter>
+std::vector<Eigen::Triplet<double>> SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::collectEntries(
+    const mesh::Mesh &pointsMesh, const impl::Coordinates<AXES::activeDimensions> &points,
+    query::Index &index, const impl::Coordinates<AXES::activeDimensions> &centers,
+    Filter &&includeEntry) const
+{
+  const double                        radius = this->_basisFunction.getSupportRadius();
+  std::vector<Eigen::Triplet<double>> entries;
+  std::vector<Eigen::Index>           columns;
+  std::vector<double>                 values;
+  std::vector<VertexID>               candidates;
+
+  for (Eigen::Index row = 0; row < points.rows(); ++row) {
+    columns.clear();
+    values.clear();
+    const auto box = supportBox(pointsMesh.vertices()[row].rawCoords());
+    index.getVerticesInsideBox(box.first, box.second, candidates);
+    for (VertexID candidate : candidates) {
+      if (not includeEntry(row, candidate)) {
+        continue;
+      }
+      const double distance = (centers.row(candidate) - points.row(row)).norm();
+      if (distance < radius) {
+        columns.push_back(candidate);
+        values.push_back(distance);
+      }
+    }
+
+    this->_basisFunction.evaluateInPlace(Eigen::Map<Eigen::VectorXd>(values.data(), values.size()));
+    for (size_t i = 0; i < columns.size(); ++i) {
+      entries.emplace_back(row, columns[i], values[i]);
+    }
+  }
+  return entries;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateConsistent(const Eigen::MatrixXd &in)
+{
+  const Eigen::MatrixXd coefficients = _sparseSolver.solve(in);
+  const Eigen::Index    inputSize    = _kernelA.cols();
+
+  Eigen::MatrixXd out = _kernelA * coefficients.topRows(inputSize);
+  out.noalias() += _polynomialA * coefficients.bottomRows(_polynomialA.cols());
+  return out;
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::MatrixXd SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::evaluateConservative(const Eigen::MatrixXd &in)
+{
+  Eigen::MatrixXd rhs(_kernelA.cols() + _polynomialA.cols(), in.cols());
+  rhs.topRows(_kernelA.cols())        = _kernelA.transpose() * in;
+  rhs.bottomRows(_polynomialA.cols()) = _polynomialA.transpose() * in;
+  return _sparseSolver.solve(rhs);
+}
+
+template <typename RADIAL_BASIS_FUNCTION_T>
+void SparseRadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T>::clearInterpolation()
+{
+  _kernelA     = Eigen::SparseMatrix<double, Eigen::RowMajor>();
+  _polynomialA = Eigen::MatrixXd();
+  _sparseSolver.clear();
+}
+
+} // namespace mapping
+} // namespace precice
@@ -10,8 +10,10 @@
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/SparseRadialBasisFctMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
@@ -40,6 +42,11 @@ MappingConfiguration::MappingConfiguration(
                                .setDocumentation("Support radius of each RBF basis function (global choice).");
   auto attrSolverRtol = makeXMLAttribute(ATTR_SOLVER_RTOL, 1e-9)
                             .setDocumentation("Solver relative tolerance for convergence");
+  auto attrRecycledSolutions = makeXMLAttribute(ATTR_RECYCLING, 0)
+                                   .setDocumentation("Number of previous solutions the conjugate gradient solver of the sparse RBF system keeps across mappings of data. "
+                                                     "The initial guess of every solve is their best approximation of the solution, which saves iterations "
+                                                     "if the data changes little between iterations and time windows. "
+                                                     "Only supported with use-sparse-matrix=\"true\" and sparse-solver=\"cg\". Set to 0 to disable.");
   auto attrXDead = makeXMLAttribute(ATTR_X_DEAD, false)
                        .setDocumentation("If set to true, the x axis will be ignored for the mapping");
   auto attrYDead = makeXMLAttribute(ATTR_Y_DEAD, false)
@@ -54,6 +61,33 @@ MappingConfiguration::MappingConfiguration(
                                .setOptions({"estimate", "compute", "off", "save", "tree"});
   auto attrUseLU = makeXMLAttribute(ATTR_USE_QR, false)
                        .setDocumentation("If set to true, QR decomposition is used to solve the RBF system");
+  auto attrUsePartitionOfUnity = makeXMLAttribute(ATTR_USE_POU, false)
+                                     .setDocumentation("If set to true, the RBF system is split into small overlapping clusters, which are solved locally on each rank "
+                                                       "and blended using a partition of unity. This does neither require PETSc nor gathering the mesh on the master rank.");
+  auto attrVerticesPerCluster = makeXMLAttribute(ATTR_CLUSTER_SIZE, 50)
+                                    .setDocumentation("Target number of input vertices in each cluster of the partition of unity RBF mapping.");
+  auto attrRelativeOverlap = makeXMLAttribute(ATTR_OVERLAP, 0.3)
+                                 .setDocumentation("Overlap of neighboring clusters of the partition of unity RBF mapping, relative to the cluster radius. Has to be in (0, 1).");
+  auto attrPrecomputeOperator = makeXMLAttribute(ATTR_PRECOMPUTE, false)
+                                    .setDocumentation("If set to true, the evaluation operator of the global RBF system is formed once when computing the mapping. "
+                                                      "Every mapping of data is then a single matrix product, which pays off for stationary meshes. "
+                                                      "Implies the Eigen-based implementation, i.e., disables PETSc.");
+  auto attrThreads = makeXMLAttribute(ATTR_THREADS, 1)
+                         .setDocumentation("Number of threads each rank uses to compute the mapping, i.e., to assemble, decompose, and evaluate the RBF system "
+                                           "or to find the nearest neighbors. Set to 0 to use all hardware threads. "
+                                           "Only supported by the nearest-neighbor mapping and the dense Eigen-based and the partition of unity RBF implementations, "
+                                           "the PETSc-based and the sparse RBF implementations reject values other than 1.");
+  auto attrUseSparseMatrix = makeXMLAttribute(ATTR_USE_SPARSE, false)
+                                 .setDocumentation("If set to true, the global RBF system is assembled as a sparse matrix, which only contains the entries within the support radius. "
+                                                   "Implies the Eigen-based implementation, i.e., disables PETSc.");
+  auto attrSparseSolver = makeXMLAttribute(ATTR_SPARSE_SOLVER, VALUE_SPARSE_CHOLESKY)
+                              .setDocumentation("Solver of the sparse RBF system: a sparse Cholesky decomposition or a diagonally preconditioned conjugate gradient method, "
+                                                "which needs less memory and converges to the solver-rtol.")
+                              .setOptions({VALUE_SPARSE_CHOLESKY, VALUE_SPARSE_CG});
+  auto attrCacheDirectory = makeXMLAttribute(ATTR_CACHE, "")
+                                .setDocumentation("Directory to store the evaluation operator of the global RBF system in. A restart with identical meshes, "
+                                                  "partitioning, and configuration loads the operator instead of computing it. "
+                                                  "Implies precompute-operator and thus the Eigen-based implementation. Leave empty to disable the cache.");
 
   XMLTag::Occurrence occ = XMLTag::OCCUR_ARBITRARY;
   std::list<XMLTag>  tags;
@@ -83,24 +117,36 @@ MappingConfiguration::MappingConfiguration(
     XMLTag tag(*this, VALUE_RBF_GAUSSIAN, occ, TAG);
     tag.setDocumentation("Local radial-basis-function mapping based on the Gaussian RBF with a cut-off threshold.");
     tag.addAttribute(attrShapeParam);
+    tag.addAttribute(attrUseSparseMatrix);
+    tag.addAttribute(attrSparseSolver);
+    tag.addAttribute(attrRecycledSolutions);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CTPS_C2, occ, TAG);
     tag.setDocumentation("Local radial-basis-function mapping based on the C2-polynomial RBF.");
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrUseSparseMatrix);
+    tag.addAttribute(attrSparseSolver);
+    tag.addAttribute(attrRecycledSolutions);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C0, occ, TAG);
     tag.setDocumentation("Local radial-basis-function mapping based on the C0-polynomial RBF.");
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrUseSparseMatrix);
+    tag.addAttribute(attrSparseSolver);
+    tag.addAttribute(attrRecycledSolutions);
     tags.push_back(tag);
   }
   {
     XMLTag tag(*this, VALUE_RBF_CPOLYNOMIAL_C6, occ, TAG);
     tag.setDocumentation("Local radial-basis-function mapping based on the C6-polynomial RBF.");
     tag.addAttribute(attrSupportRadius);
+    tag.addAttribute(attrUseSparseMatrix);
+    tag.addAttribute(attrSparseSolver);
+    tag.addAttribute(attrRecycledSolutions);
     tags.push_back(tag);
   }
   // Add tags that only, but all RBF mappings use
@@ -112,10 +158,17 @@ MappingConfiguration::MappingConfiguration(
     tag.addAttribute(attrYDead);
     tag.addAttribute(attrZDead);
     tag.addAttribute(attrUseLU);
+    tag.addAttribute(attrUsePartitionOfUnity);
+    tag.addAttribute(attrVerticesPerCluster);
+    tag.addAttribute(attrRelativeOverlap);
+    tag.addAttribute(attrPrecomputeOperator);
+    tag.addAttribute(attrThreads);
+    tag.addAttribute(attrCacheDirectory);
   }
   {
     XMLTag tag(*this, VALUE_NEAREST_NEIGHBOR, occ, TAG);
     tag.setDocumentation("Nearest-neighbour mapping which uses a rstar-spacial index tree to index meshes and run nearest-neighbour queries.");
+    tag.addAttribute(attrThreads);
     tags.push_back(tag);
   }
   {
@@ -173,6 +226,15 @@ void MappingConfiguration::xmlTagCallback(
     bool          useLU         = false;
     Polynomial    polynomial    = Polynomial::ON;
     Preallocation preallocation = Preallocation::TREE;
+    bool          usePOU             = false;
+    int           verticesPerCluster = 50;
+    double        relativeOverlap    = 0.3;
+    bool          precomputeOperator = false;
+    int           threads            = 1;
+    int           recycledSolutions  = 0;
+    bool          useSparseMatrix    = false;
+    bool          useCG              = false;
+    std::string   cacheDirectory;
 
     if (tag.hasAttribute(ATTR_SHAPE_PARAM)) {
       shapeParameter = tag.getDoubleAttributeValue(ATTR_SHAPE_PARAM);
@@ -183,6 +245,13 @@ void MappingConfiguration::xmlTagCallback(
     if (tag.hasAttribute(ATTR_SOLVER_RTOL)) {
       solverRtol = tag.getDoubleAttributeValue(ATTR_SOLVER_RTOL);
     }
+    if (tag.hasAttribute(ATTR_RECYCLING)) {
+      recycledSolutions = tag.getIntAttributeValue(ATTR_RECYCLING);
+      PRECICE_CHECK(recycledSolutions >= 0,
+                    "The number of recycled solutions of the mapping from mesh \"{}\" to mesh \"{}\" is {}, but it has to be non-negative. "
+                    "Please set recycled-solutions=\"0\" to disable recycling or a positive number.",
+                    fromMesh, toMesh, recycledSolutions);
+    }
     if (tag.hasAttribute(ATTR_X_DEAD)) {
       xDead = tag.getBooleanAttributeValue(ATTR_X_DEAD);
     }
@@ -195,6 +264,34 @@ void MappingConfiguration::xmlTagCallback(
     if (tag.hasAttribute(ATTR_USE_QR)) {
       useLU = tag.getBooleanAttributeValue(ATTR_USE_QR);
     }
+    if (tag.hasAttribute(ATTR_USE_POU)) {
+      usePOU = tag.getBooleanAttributeValue(ATTR_USE_POU);
+    }
+    if (tag.hasAttribute(ATTR_CLUSTER_SIZE)) {
+      verticesPerCluster = tag.getIntAttributeValue(ATTR_CLUSTER_SIZE);
+    }
+    if (tag.hasAttribute(ATTR_OVERLAP)) {
+      relativeOverlap = tag.getDoubleAttributeValue(ATTR_OVERLAP);
+    }
+    if (tag.hasAttribute(ATTR_PRECOMPUTE)) {
+      precomputeOperator = tag.getBooleanAttributeValue(ATTR_PRECOMPUTE);
+    }
+    if (tag.hasAttribute(ATTR_THREADS)) {
+      threads = tag.getIntAttributeValue(ATTR_THREADS);
+      PRECICE_CHECK(threads >= 0,
+                    "The number of threads of the mapping from mesh \"{}\" to mesh \"{}\" is {}, but it has to be non-negative. "
+                    "Please set threads=\"0\" to use all hardware threads or a positive number.",
+                    fromMesh, toMesh, threads);
+    }
+    if (tag.hasAttribute(ATTR_USE_SPARSE)) {
+      useSparseMatrix = tag.getBooleanAttributeValue(ATTR_USE_SPARSE);
+    }
+    if (tag.hasAttribute(ATTR_SPARSE_SOLVER)) {
+      useCG = tag.getStringAttributeValue(ATTR_SPARSE_SOLVER) == VALUE_SPARSE_CG;
+    }
+    if (tag.hasAttribute(ATTR_CACHE)) {
+      cacheDirectory = tag.getStringAttributeValue(ATTR_CACHE);
+    }
     if (tag.hasAttribute("polynomial")) {
       std::string strPolynomial = tag.getStringAttributeValue("polynomial");
       if (strPolynomial == "separate")
@@ -221,10 +318,13 @@ void MappingConfiguration::xmlTagCallback(
     ConfiguredMapping configuredMapping = createMapping(context,
                                                         dir, type, constraint,
                                                         fromMesh, toMesh, timing,
-                                                        shapeParameter, supportRadius, solverRtol,
+                                                        shapeParameter, supportRadius, solverRtol, recycledSolutions,
                                                         xDead, yDead, zDead,
                                                         useLU,
-                                                        polynomial, preallocation);
+                                                        polynomial, preallocation,
+                                                        usePOU, verticesPerCluster, relativeOverlap,
+                                                        precomputeOperator, threads,
+                                                        useSparseMatrix, useCG, cacheDirectory);
     checkDuplicates(configuredMapping);
     _mappings.push_back(configuredMapping);
   }
@@ -251,12 +351,21 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
     double                           shapeParameter,
     double                           supportRadius,
     double                           solverRtol,
+    int                              recycledSolutions,
     bool                             xDead,
     bool                             yDead,
     bool                             zDead,
     bool                             useLU,
     Polynomial                       polynomial,
-    Preallocation                    preallocation) const
+    Preallocation                    preallocation,
+    bool                             usePartitionOfUnity,
+    int                              verticesPerCluster,
+    double                           relativeOverlap,
+    bool                             precomputeOperator,
+    int                              threads,
+    bool                             useSparseMatrix,
+    bool                             useConjugateGradient,
+    const std::string &              cacheDirectory) const
 {
   PRECICE_TRACE(direction, type, timing, shapeParameter, supportRadius);
   using namespace mapping;
@@ -297,7 +406,7 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
 
   if (type == VALUE_NEAREST_NEIGHBOR) {
     configuredMapping.mapping = PtrMapping(
-        new NearestNeighborMapping(constraintValue, dimensions));
+        new NearestNeighborMapping(constraintValue, dimensions, threads));
     configuredMapping.isRBF = false;
     return configuredMapping;
   } else if (type == VALUE_NEAREST_PROJECTION) {
@@ -324,44 +433,141 @@ MappingConfiguration::ConfiguredMapping MappingConfiguration::createMapping(
   usePETSc = true;
 #endif
 
-  if (usePETSc && (not useLU)) {
+  PRECICE_CHECK(not(useSparseMatrix && precomputeOperator),
+                "The RBF mapping from mesh \"{}\" to mesh \"{}\" cannot precompute its evaluation operator when using sparse matrices, "
+                "as the operator is dense. Please remove one of the attributes \"{}\" and \"{}\".",
+                fromMeshName, toMeshName, ATTR_USE_SPARSE, ATTR_PRECOMPUTE);
+
+  PRECICE_CHECK(cacheDirectory.empty() || not(useSparseMatrix || usePartitionOfUnity),
+                "The RBF mapping from mesh \"{}\" to mesh \"{}\" can only cache the evaluation operator of the global dense RBF system. "
+                "Please remove the attribute \"{}\" or disable \"{}\" and \"{}\".",
+                fromMeshName, toMeshName, ATTR_CACHE, ATTR_USE_SPARSE, ATTR_USE_POU);
+
+  // The local systems of the partition of unity always contain the polynomial and are solved by a QR decomposition
+  PRECICE_CHECK(not usePartitionOfUnity || (polynomial == Polynomial::SEPARATE && not useLU && not precomputeOperator && not useSparseMatrix),
+                "The partition of unity RBF mapping from mesh \"{}\" to mesh \"{}\" does not support the attributes \"polynomial\", \"{}\", \"{}\", and \"{}\". "
+                "Please remove them or disable \"{}\".",
+                fromMeshName, toMeshName, ATTR_USE_QR, ATTR_PRECOMPUTE, ATTR_USE_SPARSE, ATTR_USE_POU);
+
+  if (usePartitionOfUnity) {
+    rbfType = RBFType::PARTITION_OF_UNITY;
+  } else if (useSparseMatrix) {
+    rbfType = RBFType::EIGEN_SPARSE;
+  } else if (usePETSc && (not useLU) && (not precomputeOperator) && cacheDirectory.empty()) {
     rbfType = RBFType::PETSc;
   } else {
     rbfType = RBFType::EIGEN;
   }
 
+  // Only the conjugate gradient method starts from an initial guess
+  PRECICE_CHECK(recycledSolutions == 0 || (rbfType == RBFType::EIGEN_SPARSE && useConjugateGradient),
+                "The RBF mapping from mesh \"{}\" to mesh \"{}\" can only recycle solutions with the conjugate gradient solver of the sparse implementation. "
+                "Please remove the attribute \"{}\" or set \"{}\" to true and \"{}\" to \"{}\".",
+                fromMeshName, toMeshName, ATTR_RECYCLING, ATTR_USE_SPARSE, ATTR_SPARSE_SOLVER, VALUE_SPARSE_CG);
+
+  // Only the dense Eigen-based and the partition of unity implementations distribute their work over threads
+  PRECICE_CHECK(threads == 1 || rbfType == RBFType::EIGEN || rbfType == RBFType::PARTITION_OF_UNITY,
+                "The RBF mapping from mesh \"{}\" to mesh \"{}\" can only use several threads with the dense Eigen-based or the partition of unity implementation, "
+                "but the {} implementation is selected. Please remove the attribute \"{}\" or disable \"{}\".",
+                fromMeshName, toMeshName, rbfType == RBFType::PETSc ? "PETSc-based" : "sparse", ATTR_THREADS,
+                rbfType == RBFType::PETSc ? "PETSc" : ATTR_USE_SPARSE);
+
   if (rbfType == RBFType::EIGEN) {
     PRECICE_DEBUG("Eigen RBF is used");
     if (type == VALUE_RBF_TPS) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Multiquadrics>(
-              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Multiquadrics(shapeParameter), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<InverseMultiquadrics>(
-              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, InverseMultiquadrics(shapeParameter), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_VOLUME_SPLINES) {
       configuredMapping.mapping = PtrMapping(
-          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead));
+          new RadialBasisFctMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_GAUSSIAN) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<Gaussian>(
-              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead));
+              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_CTPS_C2) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactThinPlateSplinesC2>(
-              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC0>(
-              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
     } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
       configuredMapping.mapping = PtrMapping(
           new RadialBasisFctMapping<CompactPolynomialC6>(
-              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead));
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead, precomputeOperator, threads, cacheDirectory));
+    } else {
+      PRECICE_ERROR("Unknown mapping type!");
+    }
+  }
+
+  if (rbfType == RBFType::EIGEN_SPARSE) {
+    PRECICE_DEBUG("Sparse Eigen RBF is used");
+    using Method        = impl::SparseInterpolationSolver::Method;
+    const Method method = useConjugateGradient ? Method::ConjugateGradient : Method::Cholesky;
+    if (type == VALUE_RBF_GAUSSIAN) {
+      configuredMapping.mapping = PtrMapping(
+          new SparseRadialBasisFctMapping<Gaussian>(
+              constraintValue, dimensions, Gaussian(shapeParameter), xDead, yDead, zDead, method, solverRtol, recycledSolutions));
+    } else if (type == VALUE_RBF_CTPS_C2) {
+      configuredMapping.mapping = PtrMapping(
+          new SparseRadialBasisFctMapping<CompactThinPlateSplinesC2>(
+              constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius), xDead, yDead, zDead, method, solverRtol, recycledSolutions));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
+      configuredMapping.mapping = PtrMapping(
+          new SparseRadialBasisFctMapping<CompactPolynomialC0>(
+              constraintValue, dimensions, CompactPolynomialC0(supportRadius), xDead, yDead, zDead, method, solverRtol, recycledSolutions));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
+      configuredMapping.mapping = PtrMapping(
+          new SparseRadialBasisFctMapping<CompactPolynomialC6>(
+              constraintValue, dimensions, CompactPolynomialC6(supportRadius), xDead, yDead, zDead, method, solverRtol, recycledSolutions));
+    } else {
+      PRECICE_ERROR("Unknown mapping type!");
+    }
+  }
+
+  if (rbfType == RBFType::PARTITION_OF_UNITY) {
+    PRECICE_DEBUG("Partition of unity RBF is used.");
+    if (type == VALUE_RBF_TPS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<ThinPlateSplines>(constraintValue, dimensions, ThinPlateSplines(),
+                                                        xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Multiquadrics>(constraintValue, dimensions, Multiquadrics(shapeParameter),
+                                                     xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_INV_MULTIQUADRICS) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<InverseMultiquadrics>(constraintValue, dimensions, InverseMultiquadrics(shapeParameter),
+                                                            xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_VOLUME_SPLINES) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<VolumeSplines>(constraintValue, dimensions, VolumeSplines(),
+                                                     xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_GAUSSIAN) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<Gaussian>(constraintValue, dimensions, Gaussian(shapeParameter),
+                                                xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_CTPS_C2) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactThinPlateSplinesC2>(constraintValue, dimensions, CompactThinPlateSplinesC2(supportRadius),
+                                                                 xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C0) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC0>(constraintValue, dimensions, CompactPolynomialC0(supportRadius),
+                                                           xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
+    } else if (type == VALUE_RBF_CPOLYNOMIAL_C6) {
+      configuredMapping.mapping = PtrMapping(
+          new PartitionOfUnityMapping<CompactPolynomialC6>(constraintValue, dimensions, CompactPolynomialC6(supportRadius),
+                                                           xDead, yDead, zDead, verticesPerCluster, relativeOverlap, threads));
     } else {
       PRECICE_ERROR("Unknown mapping type!");
     }
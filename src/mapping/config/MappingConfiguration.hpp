@@ -32,7 +32,9 @@ enum class Preallocation {
 
 enum class RBFType {
   EIGEN,
-  PETSc
+  EIGEN_SPARSE,
+  PETSc,
+  PARTITION_OF_UNITY
 };
 
 /// Performs XML configuration and holds configured mappings.
@@ -110,10 +112,19 @@ private:
   const std::string ATTR_SHAPE_PARAM    = "shape-parameter";
   const std::string ATTR_SUPPORT_RADIUS = "support-radius";
   const std::string ATTR_SOLVER_RTOL    = "solver-rtol";
+  const std::string ATTR_RECYCLING      = "recycled-solutions";
   const std::string ATTR_X_DEAD         = "x-dead";
   const std::string ATTR_Y_DEAD         = "y-dead";
   const std::string ATTR_Z_DEAD         = "z-dead";
   const std::string ATTR_USE_QR         = "use-qr-decomposition";
+  const std::string ATTR_USE_POU        = "use-partition-of-unity";
+  const std::string ATTR_CLUSTER_SIZE   = "vertices-per-cluster";
+  const std::string ATTR_OVERLAP        = "relative-overlap";
+  const std::string ATTR_PRECOMPUTE     = "precompute-operator";
+  const std::string ATTR_THREADS        = "threads";
+  const std::string ATTR_USE_SPARSE     = "use-sparse-matrix";
+  const std::string ATTR_SPARSE_SOLVER  = "sparse-solver";
+  const std::string ATTR_CACHE          = "cache-directory";
 
   const std::string VALUE_WRITE             = "write";
   const std::string VALUE_READ              = "read";
@@ -132,6 +143,9 @@ private:
   const std::string VALUE_RBF_CPOLYNOMIAL_C0    = "rbf-compact-polynomial-c0";
   const std::string VALUE_RBF_CPOLYNOMIAL_C6    = "rbf-compact-polynomial-c6";
 
+  const std::string VALUE_SPARSE_CHOLESKY = "cholesky";
+  const std::string VALUE_SPARSE_CG       = "cg";
+
   const std::string VALUE_TIMING_INITIAL    = "initial";
   const std::string VALUE_TIMING_ON_ADVANCE = "onadvance";
   const std::string VALUE_TIMING_ON_DEMAND  = "ondemand";
@@ -151,12 +165,21 @@ private:
       double                           shapeParameter,
       double                           supportRadius,
       double                           solverRtol,
+      int                              recycledSolutions,
       bool                             xDead,
       bool                             yDead,
       bool                             zDead,
       bool                             useLU,
       Polynomial                       polynomial,
-      Preallocation                    preallocation) const;
+      Preallocation                    preallocation,
+      bool                             usePartitionOfUnity,
+      int                              verticesPerCluster,
+      double                           relativeOverlap,
+      bool                             precomputeOperator,
+      int                              threads,
+      bool                             useSparseMatrix,
+      bool                             useConjugateGradient,
+      const std::string &              cacheDirectory) const;
 
   /// Check whether a mapping to and from the same mesh already exists
   void checkDuplicates(const ConfiguredMapping &mapping);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Core>
+#include <vector>
 #include "logging/Logger.hpp"
 #include "math/math.hpp"
 
@@ -36,6 +38,17 @@ struct NoCompactSupportBase {
  */
 class ThinPlateSplines : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {};
+  }
+
   double evaluate(double radius) const
   {
     double result = 0.0;
@@ -44,6 +57,13 @@ public:
     }
     return result;
   }
+
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    auto r = radii.array();
+    r      = (r > math::NUMERICAL_ZERO_DIFFERENCE).select(r.log() * r.square(), 0.0);
+  }
 };
 
 /**
@@ -55,14 +75,31 @@ public:
  */
 class Multiquadrics : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
   explicit Multiquadrics(double c)
       : _cPow2(std::pow(c, 2)) {}
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_cPow2};
+  }
+
   double evaluate(double radius) const
   {
     return std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    radii.array() = (_cPow2 + radii.array().square()).sqrt();
+  }
+
 private:
   double _cPow2;
 };
@@ -77,6 +114,11 @@ private:
  */
 class InverseMultiquadrics : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit InverseMultiquadrics(double c)
       : _cPow2(std::pow(c, 2))
   {
@@ -84,11 +126,23 @@ public:
                   "Shape parameter for radial-basis-function inverse multiquadric has to be larger than zero. Please update the \"shape-parameter\" attribute.");
   }
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_cPow2};
+  }
+
   double evaluate(double radius) const
   {
     return 1.0 / std::sqrt(_cPow2 + std::pow(radius, 2));
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    radii.array() = (_cPow2 + radii.array().square()).sqrt().inverse();
+  }
+
 private:
   logging::Logger _log{"mapping::InverseMultiQuadrics"};
 
@@ -104,10 +158,27 @@ private:
  */
 class VolumeSplines : public NoCompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return false;
+  }
+
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {};
+  }
+
   double evaluate(double radius) const
   {
     return std::abs(radius);
   }
+
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    radii.array() = radii.array().abs();
+  }
 };
 
 /**
@@ -120,6 +191,11 @@ public:
  */
 class Gaussian : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   Gaussian(const double shape, const double supportRadius = std::numeric_limits<double>::infinity())
       : _shape(shape),
         _supportRadius(supportRadius)
@@ -141,6 +217,12 @@ public:
     return _supportRadius;
   }
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_shape, _supportRadius, _deltaY};
+  }
+
   double evaluate(const double radius) const
   {
     if (radius > _supportRadius)
@@ -149,6 +231,13 @@ public:
       return std::exp(-std::pow(_shape * radius, 2.0)) - _deltaY;
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    auto r = radii.array();
+    r      = (r > _supportRadius).select(0.0, (-(_shape * r).square()).exp() - _deltaY);
+  }
+
 private:
   logging::Logger _log{"mapping::Gaussian"};
 
@@ -176,6 +265,11 @@ private:
  */
 class CompactThinPlateSplinesC2 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactThinPlateSplinesC2(double supportRadius)
       : _r(supportRadius)
   {
@@ -188,6 +282,12 @@ public:
     return _r;
   }
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_r};
+  }
+
   double evaluate(double radius) const
   {
     if (radius >= _r)
@@ -198,6 +298,15 @@ public:
     return 1.0 - 30.0 * pow(p, 2.0) - 10.0 * pow(p, 3.0) + 45.0 * pow(p, 4.0) - 6.0 * pow(p, 5.0) - 60.0 * log(pow(p, pow(p, 3.0)));
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    auto p = radii.array();
+    p /= _r;
+    // log(p^(p^3)) = p^3 * log(p), which tends to zero for p -> 0
+    p = (p >= 1.0).select(0.0, 1.0 - 30.0 * p.square() - 10.0 * p.cube() + 45.0 * p.square().square() - 6.0 * p.square().square() * p - 60.0 * (p > 0.0).select(p.cube() * p.log(), 0.0));
+  }
+
 private:
   logging::Logger _log{"mapping::CompactThinPlateSplinesC2"};
 
@@ -216,6 +325,11 @@ private:
  */
 class CompactPolynomialC0 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactPolynomialC0(double supportRadius)
       : _r(supportRadius)
   {
@@ -228,6 +342,12 @@ public:
     return _r;
   }
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_r};
+  }
+
   double evaluate(double radius) const
   {
     if (radius >= _r)
@@ -235,6 +355,14 @@ public:
     return std::pow(1.0 - radius / _r, 2.0);
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    auto p = radii.array();
+    p /= _r;
+    p = (p >= 1.0).select(0.0, (1.0 - p).square());
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC0"};
 
@@ -253,6 +381,11 @@ private:
  */
 class CompactPolynomialC6 : public CompactSupportBase {
 public:
+  static constexpr bool isStrictlyPositiveDefinite()
+  {
+    return true;
+  }
+
   explicit CompactPolynomialC6(double supportRadius)
       : _r(supportRadius)
   {
@@ -265,6 +398,12 @@ public:
     return _r;
   }
 
+  /// Returns the parameters which determine the function values, e.g. to identify cached operators
+  std::vector<double> getParameters() const
+  {
+    return {_r};
+  }
+
   double evaluate(double radius) const
   {
     if (radius >= _r)
@@ -274,6 +413,14 @@ public:
     return pow(1.0 - p, 8.0) * (32.0 * pow(p, 3.0) + 25.0 * pow(p, 2.0) + 8.0 * p + 1.0);
   }
 
+  /// Replaces each radius by the function value, evaluated element-wise and vectorized
+  void evaluateInPlace(Eigen::Ref<Eigen::VectorXd> radii) const
+  {
+    auto p = radii.array();
+    p /= _r;
+    p = (p >= 1.0).select(0.0, (1.0 - p).square().square().square() * (32.0 * p.cube() + 25.0 * p.square() + 8.0 * p + 1.0));
+  }
+
 private:
   logging::Logger _log{"mapping::CompactPolynomialC6"};
 
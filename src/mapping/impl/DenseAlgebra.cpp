@@ -0,0 +1,95 @@
+#include "mapping/impl/DenseAlgebra.hpp"
+#include <Eigen/Cholesky>
+#include <algorithm>
+#include <cstddef>
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+namespace {
+/// Block size of the Cholesky decomposition, which is also the unit of work of a thread
+constexpr Eigen::Index CHOLESKY_BLOCK_SIZE = 128;
+
+/// Minimal number of rows of a matrix product handled by one thread
+constexpr Eigen::Index MINIMAL_ROWS = 64;
+
+/// Chunk size which gives every thread a few chunks for balancing, but not less than minimum
+std::ptrdiff_t grainSize(Eigen::Index size, const utils::ThreadPool &pool, Eigen::Index minimum)
+{
+  return std::max<std::ptrdiff_t>(minimum, size / (4 * pool.size()));
+}
+} // namespace
+
+void multiply(const Eigen::MatrixXd &matrix, const Eigen::MatrixXd &in, Eigen::MatrixXd &out, utils::ThreadPool &pool)
+{
+  PRECICE_ASSERT(matrix.cols() == in.rows(), matrix.cols(), in.rows());
+  out.resize(matrix.rows(), in.cols());
+  pool.parallelFor(0, matrix.rows(), grainSize(matrix.rows(), pool, MINIMAL_ROWS), [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    out.middleRows(begin, end - begin).noalias() = matrix.middleRows(begin, end - begin) * in;
+  });
+}
+
+void multiplyTransposed(const Eigen::MatrixXd &matrix, const Eigen::MatrixXd &in, Eigen::MatrixXd &out, utils::ThreadPool &pool)
+{
+  PRECICE_ASSERT(matrix.rows() == in.rows(), matrix.rows(), in.rows());
+  out.resize(matrix.cols(), in.cols());
+  pool.parallelFor(0, matrix.cols(), grainSize(matrix.cols(), pool, MINIMAL_ROWS), [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    out.middleRows(begin, end - begin).noalias() = matrix.middleCols(begin, end - begin).transpose() * in;
+  });
+}
+
+bool choleskyInPlace(Eigen::Ref<Eigen::MatrixXd> matrix, utils::ThreadPool &pool)
+{
+  PRECICE_ASSERT(matrix.rows() == matrix.cols(), matrix.rows(), matrix.cols());
+  const Eigen::Index n = matrix.rows();
+
+  for (Eigen::Index k = 0; k < n; k += CHOLESKY_BLOCK_SIZE) {
+    const Eigen::Index blockSize = std::min(CHOLESKY_BLOCK_SIZE, n - k);
+    const Eigen::Index rest      = n - k - blockSize;
+
+    // Factorize the diagonal block
+    Eigen::LLT<Eigen::MatrixXd> llt(matrix.block(k, k, blockSize, blockSize));
+    if (llt.info() != Eigen::Success) {
+      return false;
+    }
+    matrix.block(k, k, blockSize, blockSize).triangularView<Eigen::Lower>() = llt.matrixL();
+    if (rest == 0) {
+      break;
+    }
+    const auto diagonalFactor = matrix.block(k, k, blockSize, blockSize).triangularView<Eigen::Lower>();
+
+    // Panel below the diagonal block: L21 = A21 * L11^-T, rows are independent
+    pool.parallelFor(0, rest, CHOLESKY_BLOCK_SIZE, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      auto panel = matrix.block(k + blockSize + begin, k, end - begin, blockSize);
+      diagonalFactor.transpose().solveInPlace<Eigen::OnTheRight>(panel);
+    });
+
+    // Lower triangle of the trailing matrix: A22 -= L21 * L21^T, column blocks are independent
+    const auto panel    = matrix.block(k + blockSize, k, rest, blockSize);
+    auto       trailing = matrix.block(k + blockSize, k + blockSize, rest, rest);
+    pool.parallelFor(0, rest, CHOLESKY_BLOCK_SIZE, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      const Eigen::Index columns = end - begin;
+      const Eigen::Index below   = rest - end;
+      trailing.block(begin, begin, columns, columns).selfadjointView<Eigen::Lower>().rankUpdate(panel.middleRows(begin, columns), -1.0);
+      trailing.block(end, begin, below, columns).noalias() -= panel.bottomRows(below) * panel.middleRows(begin, columns).transpose();
+    });
+  }
+  return true;
+}
+
+void choleskySolveInPlace(const Eigen::Ref<const Eigen::MatrixXd> &factor, Eigen::Ref<Eigen::MatrixXd> rhs, utils::ThreadPool &pool)
+{
+  PRECICE_ASSERT(factor.rows() == rhs.rows(), factor.rows(), rhs.rows());
+  pool.parallelFor(0, rhs.cols(), grainSize(rhs.cols(), pool, 1), [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    auto columns = rhs.middleCols(begin, end - begin);
+    factor.triangularView<Eigen::Lower>().solveInPlace(columns);
+    factor.triangularView<Eigen::Lower>().transpose().solveInPlace(columns);
+  });
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <Eigen/Core>
+
+namespace precice {
+namespace utils {
+class ThreadPool;
+}
+
+namespace mapping {
+namespace impl {
+
+/// Computes out = matrix * in, distributing the rows of matrix over the threads of the pool
+void multiply(const Eigen::MatrixXd &matrix, const Eigen::MatrixXd &in, Eigen::MatrixXd &out, utils::ThreadPool &pool);
+
+/// Computes out = matrix^T * in, distributing the columns of matrix over the threads of the pool
+void multiplyTransposed(const Eigen::MatrixXd &matrix, const Eigen::MatrixXd &in, Eigen::MatrixXd &out, utils::ThreadPool &pool);
+
+/**
+ * @brief Computes the Cholesky decomposition A = L * L^T of a symmetric positive-definite matrix in place.
+ *
+ * Uses a right-looking blocked algorithm. The triangular solves of each panel and the
+ * update of the trailing matrix are distributed over the threads of the pool.
+ * Only the lower triangle of the matrix is read and overwritten by L, the strict upper triangle remains untouched.
+ *
+ * @returns false if the matrix is not numerically positive definite, the lower triangle is then undefined.
+ */
+bool choleskyInPlace(Eigen::Ref<Eigen::MatrixXd> matrix, utils::ThreadPool &pool);
+
+/// Solves L * L^T * X = B in place of B, distributing the columns of B over the threads of the pool
+void choleskySolveInPlace(const Eigen::Ref<const Eigen::MatrixXd> &factor, Eigen::Ref<Eigen::MatrixXd> rhs, utils::ThreadPool &pool);
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,79 @@
+#include "mapping/impl/InterpolationSolver.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "mapping/impl/DenseAlgebra.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+void InterpolationSolver::compute(Eigen::MatrixXd matrixCLU, int polyparams, bool positiveDefinite, utils::ThreadPool &pool)
+{
+  PRECICE_TRACE(matrixCLU.rows(), polyparams, positiveDefinite);
+  PRECICE_ASSERT(matrixCLU.rows() == matrixCLU.cols(), matrixCLU.rows(), matrixCLU.cols());
+  PRECICE_ASSERT(matrixCLU.rows() > polyparams, matrixCLU.rows(), polyparams);
+  clear();
+  const Eigen::Index n = matrixCLU.rows() - polyparams;
+
+  if (positiveDefinite) {
+    const Eigen::VectorXd diagonal = matrixCLU.diagonal().head(n);
+    if (choleskyInPlace(matrixCLU.topLeftCorner(n, n), pool)) {
+      _useCholesky       = true;
+      _inversePolynomial = matrixCLU.topRightCorner(n, polyparams);
+      choleskySolveInPlace(matrixCLU.topLeftCorner(n, n), _inversePolynomial, pool);
+      _schur.compute(matrixCLU.topRightCorner(n, polyparams).transpose() * _inversePolynomial);
+      _matrix = std::move(matrixCLU);
+      return;
+    }
+    PRECICE_DEBUG("The interpolation matrix is not numerically positive definite, falling back to a QR decomposition.");
+    matrixCLU.diagonal().head(n) = diagonal;
+
+    // The decomposition left the strict upper triangle of K untouched
+    matrixCLU.topLeftCorner(n, n).triangularView<Eigen::StrictlyLower>() = matrixCLU.topLeftCorner(n, n).transpose();
+  }
+  _qr.compute(matrixCLU);
+}
+
+bool InterpolationSolver::isInvertible() const
+{
+  return _useCholesky ? _schur.isInvertible() : _qr.isInvertible();
+}
+
+Eigen::MatrixXd InterpolationSolver::solve(const Eigen::MatrixXd &rhs, utils::ThreadPool &pool) const
+{
+  Eigen::MatrixXd result(rhs.rows(), rhs.cols());
+  if (not _useCholesky) {
+    pool.parallelFor(0, rhs.cols(), std::max<std::ptrdiff_t>(1, rhs.cols() / (4 * pool.size())), [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      result.middleCols(begin, end - begin) = _qr.solve(rhs.middleCols(begin, end - begin));
+    });
+    return result;
+  }
+
+  // K * a + P * c = f and P^T * a = g yield S * c = P^T * K^-1 * f - g and a = K^-1 * f - K^-1 * P * c
+  const Eigen::Index n          = _inversePolynomial.rows();
+  const Eigen::Index polyparams = _inversePolynomial.cols();
+  PRECICE_ASSERT(rhs.rows() == n + polyparams, rhs.rows(), n + polyparams);
+
+  result.topRows(n) = rhs.topRows(n);
+  choleskySolveInPlace(_matrix.topLeftCorner(n, n), result.topRows(n), pool);
+  result.bottomRows(polyparams) = _schur.solve(_matrix.topRightCorner(n, polyparams).transpose() * result.topRows(n) - rhs.bottomRows(polyparams));
+  result.topRows(n) -= _inversePolynomial * result.bottomRows(polyparams);
+  return result;
+}
+
+void InterpolationSolver::clear()
+{
+  _useCholesky       = false;
+  _matrix            = Eigen::MatrixXd();
+  _inversePolynomial = Eigen::MatrixXd();
+  _schur             = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _qr                = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/QR>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace utils {
+class ThreadPool;
+}
+
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Decomposition of the global RBF interpolation system C = [K P; P^T 0].
+ *
+ * For strictly positive-definite basis functions, K is decomposed by a parallel
+ * Cholesky decomposition and the polynomial is handled by the small Schur complement
+ * S = P^T * K^-1 * P. Otherwise, or if K turns out to be numerically indefinite,
+ * C is decomposed by a column-pivoting QR decomposition.
+ */
+class InterpolationSolver {
+public:
+  /**
+   * @brief Decomposes the interpolation matrix.
+   *
+   * @param[in] matrixCLU the full symmetric interpolation matrix, which is consumed
+   * @param[in] polyparams the number of polynomial coefficients, i.e., the columns of P
+   * @param[in] positiveDefinite whether K is expected to be positive definite
+   * @param[in] pool the threads used for the decomposition
+   */
+  void compute(Eigen::MatrixXd matrixCLU, int polyparams, bool positiveDefinite, utils::ThreadPool &pool);
+
+  /// Returns false if the interpolation system is singular
+  bool isInvertible() const;
+
+  /// Returns true if K has been decomposed by a Cholesky decomposition
+  bool usesCholesky() const
+  {
+    return _useCholesky;
+  }
+
+  /// Solves C * X = B, distributing the columns of B over the threads of the pool
+  Eigen::MatrixXd solve(const Eigen::MatrixXd &rhs, utils::ThreadPool &pool) const;
+
+  /// Releases the decomposition
+  void clear();
+
+private:
+  logging::Logger _log{"mapping::InterpolationSolver"};
+
+  bool _useCholesky = false;
+
+  /// The Cholesky factor of K in the lower triangle and P in the upper right block
+  Eigen::MatrixXd _matrix;
+
+  /// K^-1 * P
+  Eigen::MatrixXd _inversePolynomial;
+
+  /// Decomposition of the Schur complement P^T * K^-1 * P
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schur;
+
+  /// Decomposition of C, if the Cholesky decomposition is not used
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _qr;
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
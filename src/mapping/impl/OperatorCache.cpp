@@ -0,0 +1,143 @@
+#include "mapping/impl/OperatorCache.hpp"
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+namespace {
+constexpr char          MAGIC[8] = {'p', 'r', 'e', 'c', 'i', 'c', 'e', 'O'};
+constexpr std::uint32_t VERSION  = 2;
+
+/// Header of an operator file, followed by the key of the fingerprint and the entries
+struct Header {
+  char          magic[8];
+  std::uint32_t version;
+  std::uint32_t headerBytes;
+  std::uint64_t fingerprint;
+  std::int64_t  rows;
+  std::int64_t  cols;
+  std::uint64_t keyBytes;
+  char          padding[16];
+};
+
+static_assert(sizeof(Header) == 64, "The header keeps the entries aligned to cache lines.");
+
+/// Returns the size of the key padded to keep the entries aligned
+std::size_t paddedKeyBytes(std::size_t keyBytes)
+{
+  return (keyBytes + sizeof(Header) - 1) / sizeof(Header) * sizeof(Header);
+}
+} // namespace
+
+OperatorCache::OperatorCache(std::string directory)
+    : _directory(std::move(directory))
+{
+}
+
+std::string OperatorCache::filename(std::uint64_t fingerprint) const
+{
+  PRECICE_ASSERT(isEnabled());
+  char name[32];
+  std::snprintf(name, sizeof(name), "operator-%016llx.bin", static_cast<unsigned long long>(fingerprint));
+  return (boost::filesystem::path(_directory) / name).string();
+}
+
+bool OperatorCache::load(const utils::Fingerprint &fingerprint, Eigen::Index rows, Eigen::Index cols, Eigen::MatrixXd &matrix) const
+{
+  PRECICE_TRACE(fingerprint.value(), rows, cols);
+  PRECICE_ASSERT(fingerprint.keepsKey());
+  const std::string file = filename(fingerprint.value());
+  std::ifstream     stream(file, std::ios::binary);
+  if (not stream) {
+    PRECICE_DEBUG("No cached operator found at {}", file);
+    return false;
+  }
+
+  Header header;
+  stream.read(reinterpret_cast<char *>(&header), sizeof(Header));
+  if (not stream || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.headerBytes != sizeof(Header)) {
+    PRECICE_WARN("Ignoring the cached mapping operator {} as it is not an operator file of this version of preCICE.", file);
+    return false;
+  }
+  if (header.fingerprint != fingerprint.value() || header.rows != rows || header.cols != cols || header.keyBytes != fingerprint.key().size()) {
+    PRECICE_WARN("Ignoring the cached mapping operator {} as it belongs to different meshes.", file);
+    return false;
+  }
+
+  // The hashes of different meshes may collide, the keys never do
+  std::vector<char> key(paddedKeyBytes(header.keyBytes));
+  stream.read(key.data(), key.size());
+  if (not stream) {
+    PRECICE_WARN("Ignoring the cached mapping operator {} as it is truncated.", file);
+    return false;
+  }
+  if (not std::equal(fingerprint.key().begin(), fingerprint.key().end(), key.begin())) {
+    PRECICE_WARN("Ignoring the cached mapping operator {} as it belongs to different meshes.", file);
+    return false;
+  }
+
+  Eigen::MatrixXd loaded(rows, cols);
+  stream.read(reinterpret_cast<char *>(loaded.data()), loaded.size() * sizeof(double));
+  if (not stream) {
+    PRECICE_WARN("Ignoring the cached mapping operator {} as it is truncated.", file);
+    return false;
+  }
+  matrix = std::move(loaded);
+  return true;
+}
+
+void OperatorCache::store(const utils::Fingerprint &fingerprint, const Eigen::MatrixXd &matrix) const
+{
+  PRECICE_TRACE(fingerprint.value(), matrix.rows(), matrix.cols());
+  PRECICE_ASSERT(fingerprint.keepsKey());
+  namespace fs = boost::filesystem;
+
+  const fs::path file      = filename(fingerprint.value());
+  const fs::path temporary = file.parent_path() / fs::unique_path(file.filename().string() + ".%%%%-%%%%-%%%%");
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version     = VERSION;
+  header.headerBytes = sizeof(Header);
+  header.fingerprint = fingerprint.value();
+  header.rows        = matrix.rows();
+  header.cols        = matrix.cols();
+  header.keyBytes    = fingerprint.key().size();
+
+  std::vector<char> key(paddedKeyBytes(header.keyBytes), 0);
+  std::copy(fingerprint.key().begin(), fingerprint.key().end(), key.begin());
+
+  boost::system::error_code error;
+  fs::create_directories(file.parent_path(), error);
+  {
+    std::ofstream stream(temporary.string(), std::ios::binary);
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    stream.write(key.data(), key.size());
+    stream.write(reinterpret_cast<const char *>(matrix.data()), matrix.size() * sizeof(double));
+    if (not stream) {
+      PRECICE_WARN("Could not write the mapping operator to {}. The operator will be recomputed in the next run.", temporary.string());
+      fs::remove(temporary, error);
+      return;
+    }
+  }
+  fs::rename(temporary, file, error);
+  if (error) {
+    PRECICE_WARN("Could not move the mapping operator to {}: {}", file.string(), error.message());
+    fs::remove(temporary, error);
+    return;
+  }
+  PRECICE_DEBUG("Stored mapping operator at {}", file.string());
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
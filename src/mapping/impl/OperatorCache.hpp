@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <string>
+#include "logging/Logger.hpp"
+#include "utils/Fingerprint.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Stores computed mapping operators in a directory, such that restarts with identical meshes can skip their computation.
+ *
+ * Every operator is a file named after the hash of its fingerprint. It consists of a fixed header of
+ * 64 bytes and the key of the fingerprint, padded to a multiple of 64 bytes, followed by the
+ * column-major entries of the matrix. The entries are thus aligned and can be read in one go or
+ * mapped into memory. An operator is only loaded if the complete key matches. Files are written to a temporary file first and then renamed,
+ * such that concurrent runs never read partially written operators.
+ */
+class OperatorCache {
+public:
+  /// Constructor, an empty directory disables the cache
+  explicit OperatorCache(std::string directory = "");
+
+  bool isEnabled() const
+  {
+    return not _directory.empty();
+  }
+
+  /// Returns the file of the operator with the given fingerprint
+  std::string filename(std::uint64_t fingerprint) const;
+
+  /**
+   * @brief Loads the operator with the given fingerprint and size.
+   *
+   * @returns false if there is no such operator or the file does not match, matrix is unchanged then
+   */
+  bool load(const utils::Fingerprint &fingerprint, Eigen::Index rows, Eigen::Index cols, Eigen::MatrixXd &matrix) const;
+
+  /// Stores the operator, failing to write the file only results in a warning
+  void store(const utils::Fingerprint &fingerprint, const Eigen::MatrixXd &matrix) const;
+
+private:
+  mutable logging::Logger _log{"mapping::OperatorCache"};
+
+  std::string _directory;
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstddef>
+#include <vector>
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "precice/types.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Compile-time description of the axes an RBF system is assembled on.
+ *
+ * Dead axes are skipped when gathering coordinates, such that the assembly kernels
+ * only ever see the active coordinates and are free of per-entry branches.
+ *
+ * @tparam Dimensions spatial dimensions of the meshes
+ * @tparam DeadAxisMask bit d is set if the axis d is dead
+ */
+template <int Dimensions, unsigned DeadAxisMask>
+struct Axes {
+  static_assert(Dimensions == 2 || Dimensions == 3, "Meshes are either two or three dimensional.");
+
+  static constexpr int dimensions = Dimensions;
+
+  static constexpr int activeDimensions = Dimensions - static_cast<int>((DeadAxisMask & 1u) != 0) - static_cast<int>((DeadAxisMask & 2u) != 0) - static_cast<int>(Dimensions == 3 && (DeadAxisMask & 4u) != 0);
+
+  static_assert(activeDimensions > 0, "At least one axis has to be active.");
+
+  static constexpr bool isActive(int axis)
+  {
+    return (DeadAxisMask & (1u << axis)) == 0;
+  }
+};
+
+template <int Dimensions, unsigned DeadAxisMask>
+constexpr int Axes<Dimensions, DeadAxisMask>::dimensions;
+
+template <int Dimensions, unsigned DeadAxisMask>
+constexpr int Axes<Dimensions, DeadAxisMask>::activeDimensions;
+
+/// Coordinates of the active axes, stored column-wise (structure of arrays)
+template <int ActiveDimensions>
+using Coordinates = Eigen::Matrix<double, Eigen::Dynamic, ActiveDimensions>;
+
+/// Converts a container of dead-axis flags into the bit mask used by Axes
+template <typename Container>
+unsigned deadAxisMask(const Container &deadAxis, int dimensions)
+{
+  unsigned mask = 0;
+  for (int d = 0; d < dimensions; ++d) {
+    if (deadAxis[d]) {
+      mask |= 1u << d;
+    }
+  }
+  return mask;
+}
+
+/**
+ * @brief Calls function with the instance of Axes matching the given configuration.
+ *
+ * This turns the runtime configuration of the mapping into compile-time constants
+ * of the assembly kernels.
+ */
+template <typename Function>
+auto dispatchAxes(int dimensions, unsigned deadAxisMask, Function &&function)
+{
+  if (dimensions == 2) {
+    switch (deadAxisMask) {
+    case 0u:
+      return function(Axes<2, 0u>{});
+    case 1u:
+      return function(Axes<2, 1u>{});
+    case 2u:
+      return function(Axes<2, 2u>{});
+    }
+  } else if (dimensions == 3) {
+    switch (deadAxisMask) {
+    case 0u:
+      return function(Axes<3, 0u>{});
+    case 1u:
+      return function(Axes<3, 1u>{});
+    case 2u:
+      return function(Axes<3, 2u>{});
+    case 3u:
+      return function(Axes<3, 3u>{});
+    case 4u:
+      return function(Axes<3, 4u>{});
+    case 5u:
+      return function(Axes<3, 5u>{});
+    case 6u:
+      return function(Axes<3, 6u>{});
+    }
+  }
+  PRECICE_UNREACHABLE("Unsupported combination of {} dimensions and dead-axis mask {}.", dimensions, deadAxisMask);
+}
+
+/// Gathers the active coordinates of all vertices of the mesh
+template <typename AXES>
+Coordinates<AXES::activeDimensions> gatherCoordinates(const mesh::Mesh &mesh)
+{
+  Coordinates<AXES::activeDimensions> coordinates(mesh.vertices().size(), AXES::activeDimensions);
+  Eigen::Index                        row = 0;
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    const auto raw    = vertex.rawCoords();
+    int        column = 0;
+    for (int d = 0; d < AXES::dimensions; ++d) {
+      if (AXES::isActive(d)) {
+        coordinates(row, column++) = raw[d];
+      }
+    }
+    ++row;
+  }
+  return coordinates;
+}
+
+/// Gathers the active coordinates of the given vertices of the mesh
+template <typename AXES>
+Coordinates<AXES::activeDimensions> gatherCoordinates(const mesh::Mesh &mesh, const std::vector<VertexID> &vertexIDs)
+{
+  Coordinates<AXES::activeDimensions> coordinates(vertexIDs.size(), AXES::activeDimensions);
+  for (size_t i = 0; i < vertexIDs.size(); ++i) {
+    const auto raw    = mesh.vertices()[vertexIDs[i]].rawCoords();
+    int        column = 0;
+    for (int d = 0; d < AXES::dimensions; ++d) {
+      if (AXES::isActive(d)) {
+        coordinates(i, column++) = raw[d];
+      }
+    }
+  }
+  return coordinates;
+}
+
+/// Number of columns assembled by a thread at once
+constexpr std::ptrdiff_t ASSEMBLY_GRAIN_SIZE = 16;
+
+/// Calls body for chunks of [0, size) on the threads of the pool, or inline without a pool
+template <typename Body>
+void forEachColumn(utils::ThreadPool *pool, Eigen::Index size, Body &&body)
+{
+  if (pool) {
+    pool->parallelFor(0, size, ASSEMBLY_GRAIN_SIZE, body);
+  } else {
+    body(0, size);
+  }
+}
+
+/**
+ * @brief Evaluates the basis function between all points and a single center.
+ *
+ * The distances are accumulated one axis at a time over contiguous columns,
+ * which lets Eigen vectorize both the distance computation and the basis function.
+ */
+template <typename RBF, typename Points, typename Center>
+void evaluateColumn(const RBF &basisFunction, const Eigen::MatrixBase<Points> &points, const Eigen::MatrixBase<Center> &center, Eigen::Ref<Eigen::VectorXd> column)
+{
+  PRECICE_ASSERT(points.rows() == column.size(), points.rows(), column.size());
+  column.array() = (points.col(0).array() - center(0)).square();
+  for (Eigen::Index d = 1; d < points.cols(); ++d) {
+    column.array() += (points.col(d).array() - center(d)).square();
+  }
+  column.array() = column.array().sqrt();
+  basisFunction.evaluateInPlace(column);
+}
+
+/**
+ * @brief Assembles the symmetric interpolation matrix including the linear polynomial.
+ *
+ * Only the lower triangle is evaluated, the upper one is mirrored afterwards.
+ * The columns are distributed over the threads of the pool, if given.
+ */
+template <typename RBF, int ActiveDimensions>
+Eigen::MatrixXd assembleSystemMatrix(const RBF &basisFunction, const Coordinates<ActiveDimensions> &input, utils::ThreadPool *pool = nullptr)
+{
+  const Eigen::Index inputSize  = input.rows();
+  const Eigen::Index polyparams = 1 + input.cols();
+  const Eigen::Index n          = inputSize + polyparams;
+
+  Eigen::MatrixXd matrixCLU(n, n);
+  forEachColumn(pool, inputSize, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (Eigen::Index j = begin; j < end; ++j) {
+      evaluateColumn(basisFunction, input.bottomRows(inputSize - j), input.row(j), matrixCLU.col(j).segment(j, inputSize - j));
+    }
+  });
+  matrixCLU.block(inputSize, 0, 1, inputSize).setOnes();
+  matrixCLU.bottomLeftCorner(polyparams - 1, inputSize) = input.transpose();
+  matrixCLU.bottomRightCorner(polyparams, polyparams).setZero();
+  // Mirror column by column, the copied segments of row and column never overlap
+  for (Eigen::Index j = 0; j < n - 1; ++j) {
+    matrixCLU.row(j).tail(n - j - 1) = matrixCLU.col(j).tail(n - j - 1).transpose();
+  }
+  return matrixCLU;
+}
+
+/// Assembles the evaluation matrix including the linear polynomial, optionally distributing the columns over the threads of the pool
+template <typename RBF, int ActiveDimensions>
+Eigen::MatrixXd assembleEvaluationMatrix(const RBF &basisFunction, const Coordinates<ActiveDimensions> &input, const Coordinates<ActiveDimensions> &output, utils::ThreadPool *pool = nullptr)
+{
+  const Eigen::Index inputSize = input.rows();
+
+  Eigen::MatrixXd matrixA(output.rows(), inputSize + 1 + input.cols());
+  forEachColumn(pool, inputSize, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (Eigen::Index j = begin; j < end; ++j) {
+      evaluateColumn(basisFunction, output, input.row(j), matrixA.col(j));
+    }
+  });
+  matrixA.col(inputSize).setOnes();
+  matrixA.rightCols(input.cols()) = output;
+  return matrixA;
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,135 @@
+#include "mapping/impl/SparseInterpolationSolver.hpp"
+#include <cmath>
+#include <utility>
+#include "logging/LogMacros.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+SparseInterpolationSolver::SparseInterpolationSolver(Method method, double relativeTolerance, int recycledSolutions)
+    : _method(method),
+      _relativeTolerance(relativeTolerance),
+      _recycledSolutions(recycledSolutions)
+{
+  PRECICE_ASSERT(recycledSolutions >= 0, recycledSolutions);
+}
+
+void SparseInterpolationSolver::compute(SparseMatrix matrixK, Eigen::MatrixXd polynomial)
+{
+  PRECICE_TRACE(matrixK.rows(), matrixK.nonZeros(), polynomial.cols());
+  PRECICE_ASSERT(matrixK.rows() == matrixK.cols(), matrixK.rows(), matrixK.cols());
+  PRECICE_ASSERT(matrixK.rows() == polynomial.rows(), matrixK.rows(), polynomial.rows());
+  clear();
+  _matrixK    = std::move(matrixK);
+  _polynomial = std::move(polynomial);
+
+  if (_method == Method::Cholesky) {
+    _cholesky = std::make_unique<Eigen::SimplicialLDLT<SparseMatrix, Eigen::Lower>>(_matrixK);
+    if (_cholesky->info() != Eigen::Success) {
+      PRECICE_DEBUG("The sparse LDL^T decomposition of the interpolation matrix failed.");
+      return;
+    }
+    // The factor replaces K
+    _matrixK = SparseMatrix();
+  } else {
+    _cg = std::make_unique<Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower>>(_matrixK);
+    _cg->setTolerance(_relativeTolerance);
+  }
+
+  // K * a + P * c = f and P^T * a = g yield S * c = P^T * K^-1 * f - g and a = K^-1 * f - K^-1 * P * c
+  // The columns of P are unrelated to the data, hence they are not recycled
+  _inversePolynomial = solveK(_polynomial, false);
+  _schur.compute(_polynomial.transpose() * _inversePolynomial);
+}
+
+bool SparseInterpolationSolver::isInvertible() const
+{
+  if (_method == Method::Cholesky && (not _cholesky || _cholesky->info() != Eigen::Success)) {
+    return false;
+  }
+  return _schur.rows() > 0 && _schur.isInvertible();
+}
+
+Eigen::MatrixXd SparseInterpolationSolver::solve(const Eigen::MatrixXd &rhs)
+{
+  const Eigen::Index n          = _polynomial.rows();
+  const Eigen::Index polyparams = _polynomial.cols();
+  PRECICE_ASSERT(rhs.rows() == n + polyparams, rhs.rows(), n + polyparams);
+
+  Eigen::MatrixXd result(rhs.rows(), rhs.cols());
+  result.topRows(n)             = solveK(rhs.topRows(n), true);
+  result.bottomRows(polyparams) = _schur.solve(_polynomial.transpose() * result.topRows(n) - rhs.bottomRows(polyparams));
+  result.topRows(n) -= _inversePolynomial * result.bottomRows(polyparams);
+  return result;
+}
+
+Eigen::MatrixXd SparseInterpolationSolver::solveK(const Eigen::MatrixXd &rhs, bool recycle)
+{
+  _iterations = 0;
+  if (_method == Method::Cholesky) {
+    PRECICE_ASSERT(_cholesky);
+    return _cholesky->solve(rhs);
+  }
+
+  PRECICE_ASSERT(_cg);
+  Eigen::MatrixXd result(rhs.rows(), rhs.cols());
+  const bool recycling = recycle && _recycledSolutions > 0;
+  for (Eigen::Index column = 0; column < rhs.cols(); ++column) {
+    if (recycling && _recycledBasis.cols() > 0) {
+      // As W^T * K * W = I, the K-orthogonal projection of K^-1 * b onto span(W) is W * W^T * b
+      const Eigen::VectorXd guess = _recycledBasis * (_recycledBasis.transpose() * rhs.col(column));
+      result.col(column)          = _cg->solveWithGuess(rhs.col(column), guess);
+    } else {
+      result.col(column) = _cg->solve(rhs.col(column));
+    }
+    PRECICE_CHECK(_cg->info() == Eigen::Success,
+                  "The conjugate gradient solver of the sparse RBF mapping did not converge within {} iterations, "
+                  "the relative residual is {} but should be below {}. "
+                  "Please check if the interpolation matrix is positive definite for the chosen support radius "
+                  "or switch to the sparse Cholesky solver.",
+                  _cg->maxIterations(), _cg->error(), _relativeTolerance);
+    PRECICE_DEBUG("Conjugate gradient solver converged after {} iterations", _cg->iterations());
+    _iterations += _cg->iterations();
+    if (recycling) {
+      this->recycle(result.col(column));
+    }
+  }
+  return result;
+}
+
+void SparseInterpolationSolver::recycle(const Eigen::VectorXd &solution)
+{
+  const auto      matrixK   = _matrixK.selfadjointView<Eigen::Lower>();
+  Eigen::VectorXd direction = solution;
+  if (_recycledBasis.cols() > 0) {
+    direction -= _recycledBasis * (_recycledBasis.transpose() * (matrixK * solution));
+  }
+  const double norm2 = direction.dot(matrixK * direction);
+  // Skip solutions which lie within the span already, up to the rounding errors of the orthogonalization
+  if (not(norm2 > 1e-20 * solution.dot(matrixK * solution))) {
+    return;
+  }
+  if (_recycledBasis.cols() == _recycledSolutions) {
+    _recycledBasis = _recycledBasis.rightCols(_recycledSolutions - 1).eval();
+  }
+  _recycledBasis.conservativeResize(solution.size(), _recycledBasis.cols() + 1);
+  _recycledBasis.rightCols<1>() = direction / std::sqrt(norm2);
+}
+
+void SparseInterpolationSolver::clear()
+{
+  _cholesky.reset();
+  _cg.reset();
+  _matrixK           = SparseMatrix();
+  _polynomial        = Eigen::MatrixXd();
+  _inversePolynomial = Eigen::MatrixXd();
+  _schur             = Eigen::ColPivHouseholderQR<Eigen::MatrixXd>();
+  _recycledBasis     = Eigen::MatrixXd();
+  _iterations        = 0;
+}
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <Eigen/IterativeLinearSolvers>
+#include <Eigen/QR>
+#include <Eigen/SparseCholesky>
+#include <Eigen/SparseCore>
+#include <memory>
+#include "logging/Logger.hpp"
+
+namespace precice {
+namespace mapping {
+namespace impl {
+
+/**
+ * @brief Solver of the global RBF interpolation system C = [K P; P^T 0] with a sparse K.
+ *
+ * K stems from a basis function with compact support. It is either decomposed by a
+ * sparse LDL^T decomposition with fill-reducing ordering, or inverted iteratively by
+ * a conjugate gradient method with diagonal preconditioning, which needs no additional
+ * memory for the factor. The polynomial is handled by the small dense Schur complement
+ * S = P^T * K^-1 * P, as in InterpolationSolver.
+ *
+ * The conjugate gradient method can recycle previous solutions: they span a subspace, whose
+ * best approximation of the next solution in the K-norm serves as the initial guess.
+ */
+class SparseInterpolationSolver {
+public:
+  using SparseMatrix = Eigen::SparseMatrix<double>;
+
+  /// How to solve systems with K
+  enum class Method {
+    Cholesky,
+    ConjugateGradient
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] method the solver used for K
+   * @param[in] relativeTolerance tolerance of the relative residual of the conjugate gradient method
+   * @param[in] recycledSolutions number of previous solutions the conjugate gradient method starts from, 0 disables it
+   */
+  explicit SparseInterpolationSolver(Method method = Method::Cholesky, double relativeTolerance = 1e-9, int recycledSolutions = 0);
+
+  /**
+   * @brief Decomposes the interpolation matrix.
+   *
+   * @param[in] matrixK the lower triangle of K, which is consumed
+   * @param[in] polynomial the polynomial block P
+   */
+  void compute(SparseMatrix matrixK, Eigen::MatrixXd polynomial);
+
+  /// Returns false if the interpolation system is singular
+  bool isInvertible() const;
+
+  /// Returns the used solver
+  Method method() const
+  {
+    return _method;
+  }
+
+  /// Solves C * X = B, recycles the solutions of previous calls with the conjugate gradient method
+  Eigen::MatrixXd solve(const Eigen::MatrixXd &rhs);
+
+  /// Returns the conjugate gradient iterations of the last solve() summed over all columns
+  int iterations() const
+  {
+    return _iterations;
+  }
+
+  /// Releases the decomposition
+  void clear();
+
+private:
+  mutable logging::Logger _log{"mapping::SparseInterpolationSolver"};
+
+  Method _method;
+
+  double _relativeTolerance;
+
+  int _recycledSolutions;
+
+  /**
+   * @brief K-orthonormal basis of the recycled solutions, the oldest in the first column.
+   *
+   * It is shared by all columns and data, as the initial guess is the best approximation within
+   * the whole span in the K-norm, which unrelated solutions do not spoil.
+   */
+  Eigen::MatrixXd _recycledBasis;
+
+  int _iterations = 0;
+
+  /// Lower triangle of K, referenced by the conjugate gradient method
+  SparseMatrix _matrixK;
+
+  /// P
+  Eigen::MatrixXd _polynomial;
+
+  /// K^-1 * P
+  Eigen::MatrixXd _inversePolynomial;
+
+  /// Decomposition of the Schur complement P^T * K^-1 * P
+  Eigen::ColPivHouseholderQR<Eigen::MatrixXd> _schur;
+
+  std::unique_ptr<Eigen::SimplicialLDLT<SparseMatrix, Eigen::Lower>> _cholesky;
+
+  std::unique_ptr<Eigen::ConjugateGradient<SparseMatrix, Eigen::Lower>> _cg;
+
+  /// Solves K * X = B with the configured method, recycle adds the solutions to _recycledBasis
+  Eigen::MatrixXd solveK(const Eigen::MatrixXd &rhs, bool recycle);
+
+  /// K-orthogonalizes the solution against _recycledBasis and appends it, dropping the oldest column if it is full
+  void recycle(const Eigen::VectorXd &solution);
+};
+
+} // namespace impl
+} // namespace mapping
+} // namespace precice
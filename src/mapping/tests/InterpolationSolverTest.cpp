@@ -0,0 +1,152 @@
+#include <Eigen/Cholesky>
+#include <Eigen/Core>
+#include "mapping/impl/DenseAlgebra.hpp"
+#include "mapping/impl/InterpolationSolver.hpp"
+#include "mapping/impl/SparseInterpolationSolver.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(InterpolationSolver)
+
+namespace {
+/// Creates a symmetric positive-definite matrix, which spans several blocks of the Cholesky decomposition
+Eigen::MatrixXd createSPDMatrix(int n)
+{
+  Eigen::MatrixXd random = Eigen::MatrixXd::Random(n, n);
+  return random * random.transpose() + n * Eigen::MatrixXd::Identity(n, n);
+}
+
+/// Creates an interpolation system [K P; P^T 0] with a linear polynomial in 2D
+Eigen::MatrixXd createSystem(const Eigen::MatrixXd &kernel)
+{
+  const int       n = kernel.rows();
+  Eigen::MatrixXd polynomial(n, 3);
+  polynomial.col(0).setOnes();
+  polynomial.rightCols(2).setRandom();
+
+  Eigen::MatrixXd system = Eigen::MatrixXd::Zero(n + 3, n + 3);
+  system.topLeftCorner(n, n)    = kernel;
+  system.topRightCorner(n, 3)   = polynomial;
+  system.bottomLeftCorner(3, n) = polynomial.transpose();
+  return system;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Cholesky)
+{
+  PRECICE_TEST(1_rank);
+  utils::ThreadPool     pool(3);
+  const Eigen::MatrixXd matrix = createSPDMatrix(300);
+
+  Eigen::MatrixXd factor = matrix;
+  BOOST_TEST(impl::choleskyInPlace(factor, pool));
+  const Eigen::MatrixXd lower = factor.triangularView<Eigen::Lower>();
+  BOOST_TEST(lower.isApprox(Eigen::MatrixXd(matrix.llt().matrixL()), 1e-10));
+  // The strict upper triangle is untouched
+  BOOST_TEST((factor.triangularView<Eigen::StrictlyUpper>().toDenseMatrix() == matrix.triangularView<Eigen::StrictlyUpper>().toDenseMatrix()));
+
+  Eigen::MatrixXd rhs      = Eigen::MatrixXd::Random(300, 5);
+  Eigen::MatrixXd solution = rhs;
+  impl::choleskySolveInPlace(factor, solution, pool);
+  BOOST_TEST((matrix * solution).isApprox(rhs, 1e-10));
+
+  Eigen::MatrixXd indefinite = matrix;
+  indefinite(200, 200)       = -1e4;
+  BOOST_TEST(not impl::choleskyInPlace(indefinite, pool));
+}
+
+BOOST_AUTO_TEST_CASE(Products)
+{
+  PRECICE_TEST(1_rank);
+  utils::ThreadPool     pool(3);
+  const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(500, 200);
+  const Eigen::MatrixXd in     = Eigen::MatrixXd::Random(200, 3);
+  const Eigen::MatrixXd inT    = Eigen::MatrixXd::Random(500, 3);
+
+  Eigen::MatrixXd out;
+  impl::multiply(matrix, in, out, pool);
+  BOOST_TEST(out.isApprox(matrix * in));
+  impl::multiplyTransposed(matrix, inT, out, pool);
+  BOOST_TEST(out.isApprox(matrix.transpose() * inT));
+}
+
+BOOST_AUTO_TEST_CASE(PositiveDefiniteSystem)
+{
+  PRECICE_TEST(1_rank);
+  utils::ThreadPool     pool(3);
+  const Eigen::MatrixXd system = createSystem(createSPDMatrix(200));
+  const Eigen::MatrixXd rhs    = Eigen::MatrixXd::Random(203, 4);
+
+  impl::InterpolationSolver solver;
+  solver.compute(system, 3, true, pool);
+  BOOST_TEST(solver.usesCholesky());
+  BOOST_TEST(solver.isInvertible());
+  BOOST_TEST((system * solver.solve(rhs, pool)).isApprox(rhs, 1e-10));
+
+  solver.compute(system, 3, false, pool);
+  BOOST_TEST(not solver.usesCholesky());
+  BOOST_TEST(solver.isInvertible());
+  BOOST_TEST((system * solver.solve(rhs, pool)).isApprox(rhs, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(IndefiniteFallback)
+{
+  PRECICE_TEST(1_rank);
+  utils::ThreadPool pool(2);
+  Eigen::MatrixXd   kernel = createSPDMatrix(150);
+  kernel(100, 100)         = -1e4;
+
+  const Eigen::MatrixXd system = createSystem(kernel);
+  const Eigen::MatrixXd rhs    = Eigen::MatrixXd::Random(153, 2);
+
+  // The Cholesky decomposition fails and the solver falls back to the QR decomposition of the restored matrix
+  impl::InterpolationSolver solver;
+  solver.compute(system, 3, true, pool);
+  BOOST_TEST(not solver.usesCholesky());
+  BOOST_TEST(solver.isInvertible());
+  BOOST_TEST((system * solver.solve(rhs, pool)).isApprox(rhs, 1e-10));
+}
+
+BOOST_AUTO_TEST_CASE(SparseRecycling)
+{
+  PRECICE_TEST(1_rank);
+  using Solver                     = impl::SparseInterpolationSolver;
+  const Eigen::MatrixXd      kernel = createSPDMatrix(100);
+  const Eigen::MatrixXd      system = createSystem(kernel);
+  const Eigen::MatrixXd      rhs    = Eigen::MatrixXd::Random(103, 2);
+  const Solver::SparseMatrix lower  = Eigen::MatrixXd(kernel.triangularView<Eigen::Lower>()).sparseView();
+
+  Solver solver(Solver::Method::ConjugateGradient, 1e-12, 2);
+  solver.compute(lower, system.topRightCorner(100, 3));
+  BOOST_TEST(solver.isInvertible());
+  const Eigen::MatrixXd first = solver.solve(rhs);
+  BOOST_TEST((system * first).isApprox(rhs, 1e-10));
+  BOOST_TEST(solver.iterations() > 0);
+
+  // Combinations of the recycled solutions start from the converged solution
+  const Eigen::MatrixXd combined = rhs * Eigen::Vector2d(2.0, -0.5);
+  const Eigen::MatrixXd second   = solver.solve(combined);
+  BOOST_TEST(solver.iterations() <= 1);
+  BOOST_TEST((system * second).isApprox(combined, 1e-10));
+
+  // Other right-hand sides still converge, starting from the projected guess
+  const Eigen::MatrixXd other = Eigen::MatrixXd::Random(103, 1);
+  BOOST_TEST((system * solver.solve(other)).isApprox(other, 1e-10));
+  BOOST_TEST(solver.iterations() > 0);
+
+  // Without recycling, the same right-hand side needs iterations again
+  Solver plain(Solver::Method::ConjugateGradient, 1e-12);
+  plain.compute(lower, system.topRightCorner(100, 3));
+  plain.solve(rhs);
+  plain.solve(combined);
+  BOOST_TEST(plain.iterations() > 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // InterpolationSolver
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -3,6 +3,9 @@
 #include <vector>
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mapping/SparseRadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
 #include "mapping/config/MappingConfiguration.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/config/DataConfiguration.hpp"
@@ -50,5 +53,49 @@ BOOST_AUTO_TEST_CASE(Configuration)
   BOOST_TEST(mappingConfig.mappings().at(2).direction == MappingConfiguration::WRITE);
 }
 
+BOOST_AUTO_TEST_CASE(PartitionOfUnity)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-config-pou.xml");
+  using xml::XMLTag;
+  XMLTag                     tag = xml::getRootTag();
+  mesh::PtrDataConfiguration dataConfig(new mesh::DataConfiguration(tag));
+  dataConfig->setDimensions(3);
+  mesh::PtrMeshConfiguration meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  meshConfig->setDimensions(3);
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(mappingConfig.mappings().size() == 1);
+  const auto &configuredMapping = mappingConfig.mappings().at(0);
+  BOOST_TEST(configuredMapping.isRBF);
+  BOOST_TEST(configuredMapping.direction == MappingConfiguration::READ);
+  BOOST_TEST(dynamic_cast<PartitionOfUnityMapping<ThinPlateSplines> *>(configuredMapping.mapping.get()) != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(SparseMatrix)
+{
+  PRECICE_TEST(1_rank);
+
+  std::string pathToTests = testing::getPathToSources() + "/mapping/tests/";
+  std::string file(pathToTests + "mapping-config-sparse.xml");
+  using xml::XMLTag;
+  XMLTag                     tag = xml::getRootTag();
+  mesh::PtrDataConfiguration dataConfig(new mesh::DataConfiguration(tag));
+  dataConfig->setDimensions(3);
+  mesh::PtrMeshConfiguration meshConfig(new mesh::MeshConfiguration(tag, dataConfig));
+  meshConfig->setDimensions(3);
+  mapping::MappingConfiguration mappingConfig(tag, meshConfig);
+  xml::configure(tag, xml::ConfigurationContext{}, file);
+
+  BOOST_TEST(mappingConfig.mappings().size() == 2);
+  BOOST_TEST(mappingConfig.mappings().at(0).isRBF);
+  BOOST_TEST(dynamic_cast<SparseRadialBasisFctMapping<CompactPolynomialC6> *>(mappingConfig.mappings().at(0).mapping.get()) != nullptr);
+  BOOST_TEST(mappingConfig.mappings().at(1).direction == MappingConfiguration::WRITE);
+  BOOST_TEST(dynamic_cast<SparseRadialBasisFctMapping<Gaussian> *>(mappingConfig.mappings().at(1).mapping.get()) != nullptr);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
@@ -68,6 +68,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
   // Map data with almost coinciding vertices, has to result in equal values.
   inVertex0.setCoords(outVertex0.getCoords() + Eigen::Vector2d::Constant(0.1));
   inVertex1.setCoords(outVertex1.getCoords() + Eigen::Vector2d::Constant(0.1));
+  inMesh->meshChanged(*inMesh);
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -79,6 +80,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
   // Map data with exchanged vertices, has to result in exchanged values.
   inVertex0.setCoords(outVertex1.getCoords());
   inVertex1.setCoords(outVertex0.getCoords());
+  inMesh->meshChanged(*inMesh);
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -90,6 +92,7 @@ BOOST_AUTO_TEST_CASE(ConsistentNonIncremental)
 
   // Map data with coinciding output vertices, has to result in same values.
   outVertex1.setCoords(outVertex0.getCoords());
+  outMesh->meshChanged(*outMesh);
   mapping.computeMapping();
   mapping.map(inDataScalarID, outDataScalarID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -141,6 +144,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   // Map data with almost coinciding vertices, has to result in equal values.
   inVertex0.setCoords(outVertex0.getCoords() + Eigen::Vector2d::Constant(0.1));
   inVertex1.setCoords(outVertex1.getCoords() + Eigen::Vector2d::Constant(0.1));
+  inMesh->meshChanged(*inMesh);
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -151,6 +155,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
   // Map data with exchanged vertices, has to result in exchanged values.
   inVertex0.setCoords(outVertex1.getCoords());
   inVertex1.setCoords(outVertex0.getCoords());
+  inMesh->meshChanged(*inMesh);
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -160,6 +165,7 @@ BOOST_AUTO_TEST_CASE(ConservativeNonIncremental)
 
   // Map data with coinciding output vertices, has to result in double values.
   outVertex1.setCoords(Eigen::Vector2d::Constant(-1.0));
+  outMesh->meshChanged(*outMesh);
   mapping.computeMapping();
   mapping.map(inDataID, outDataID);
   BOOST_TEST(mapping.hasComputedMapping() == true);
@@ -235,5 +241,83 @@ BOOST_AUTO_TEST_CASE(ScaledConsistentNonIncremental)
   BOOST_TEST(inValues(3) * scaleFactor == outValues(3));
 }
 
+BOOST_AUTO_TEST_CASE(MultipleData)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 2;
+  using testing::equals;
+
+  // Create mesh to map from
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  PtrData inDataScalar = inMesh->createData("InDataScalar", 1);
+  PtrData inDataVector = inMesh->createData("InDataVector", 2);
+  inMesh->createVertex(Eigen::Vector2d::Constant(0.0));
+  inMesh->createVertex(Eigen::Vector2d::Constant(1.0));
+  inMesh->allocateDataValues();
+  inDataScalar->values() << 1.0, 2.0;
+  inDataVector->values() << 1.0, 2.0, 3.0, 4.0;
+
+  // Create mesh to map to, with swapped and coinciding vertices
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  PtrData outDataScalar = outMesh->createData("OutDataScalar", 1);
+  PtrData outDataVector = outMesh->createData("OutDataVector", 2);
+  outMesh->createVertex(Eigen::Vector2d::Constant(1.1));
+  outMesh->createVertex(Eigen::Vector2d::Constant(-0.1));
+  outMesh->createVertex(Eigen::Vector2d::Constant(0.9));
+  outMesh->allocateDataValues();
+
+  const mapping::Mapping::DataIDPair dataIDs[] = {{inDataScalar->getID(), outDataScalar->getID()},
+                                                  {inDataVector->getID(), outDataVector->getID()}};
+
+  precice::mapping::NearestNeighborMapping consistent(mapping::Mapping::CONSISTENT, dimensions);
+  consistent.setMeshes(inMesh, outMesh);
+  consistent.computeMapping();
+  consistent.map(dataIDs);
+  BOOST_TEST(equals(outDataScalar->values(), Eigen::Vector3d(2.0, 1.0, 2.0)));
+  BOOST_TEST(equals(outDataVector->values(), (Eigen::VectorXd(6) << 3.0, 4.0, 1.0, 2.0, 3.0, 4.0).finished()));
+
+  // Map back, the values of coinciding output vertices are summed up
+  const mapping::Mapping::DataIDPair backDataIDs[] = {{outDataScalar->getID(), inDataScalar->getID()},
+                                                      {outDataVector->getID(), inDataVector->getID()}};
+
+  inDataScalar->values().setZero();
+  inDataVector->values().setZero();
+  precice::mapping::NearestNeighborMapping conservative(mapping::Mapping::CONSERVATIVE, dimensions);
+  conservative.setMeshes(outMesh, inMesh);
+  conservative.computeMapping();
+  conservative.map(backDataIDs);
+  BOOST_TEST(equals(inDataScalar->values(), Eigen::Vector2d(1.0, 4.0)));
+  BOOST_TEST(equals(inDataVector->values(), Eigen::Vector4d(1.0, 2.0, 6.0, 8.0)));
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentThreaded)
+{
+  PRECICE_TEST(1_rank);
+  int dimensions = 3;
+
+  // Grids of 10x10x10 vertices, the output one is slightly shifted
+  PtrMesh inMesh(new Mesh("InMesh", dimensions, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  PtrMesh outMesh(new Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  for (int x = 0; x < 10; ++x) {
+    for (int y = 0; y < 10; ++y) {
+      for (int z = 0; z < 10; ++z) {
+        inMesh->createVertex(Eigen::Vector3d(x, y, z));
+        outMesh->createVertex(Eigen::Vector3d(x + 0.1, y - 0.2, z + 0.3));
+      }
+    }
+  }
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  inData->values().setLinSpaced(0.0, 999.0);
+
+  precice::mapping::NearestNeighborMapping mapping(mapping::Mapping::CONSISTENT, dimensions, 3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  BOOST_TEST(testing::equals(outData->values(), inData->values()));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 BOOST_AUTO_TEST_SUITE_END()
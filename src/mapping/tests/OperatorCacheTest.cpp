@@ -0,0 +1,68 @@
+#include <Eigen/Core>
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include "mapping/impl/OperatorCache.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Fingerprint.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(OperatorCache)
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad)
+{
+  PRECICE_TEST(1_rank);
+  const std::string directory = "operator-cache-test";
+  boost::filesystem::remove_all(directory);
+
+  impl::OperatorCache cache(directory);
+  BOOST_TEST(cache.isEnabled());
+  BOOST_TEST(not impl::OperatorCache().isEnabled());
+
+  utils::Fingerprint fingerprint;
+  fingerprint.add(42);
+  utils::Fingerprint other;
+  other.add(43);
+
+  const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(5, 7);
+  Eigen::MatrixXd       loaded;
+  BOOST_TEST(not cache.load(fingerprint, 5, 7, loaded));
+  cache.store(fingerprint, matrix);
+  BOOST_TEST(boost::filesystem::exists(cache.filename(fingerprint.value())));
+
+  BOOST_TEST(cache.load(fingerprint, 5, 7, loaded));
+  BOOST_TEST(testing::equals(loaded, matrix, 0.0));
+
+  // Different sizes or fingerprints are rejected
+  Eigen::MatrixXd rejected;
+  BOOST_TEST(not cache.load(fingerprint, 7, 5, rejected));
+  BOOST_TEST(not cache.load(other, 5, 7, rejected));
+  BOOST_TEST(rejected.size() == 0);
+
+  // Colliding hashes are rejected by the key, the hash is stored after the magic, version, and header size
+  boost::filesystem::copy_file(cache.filename(fingerprint.value()), cache.filename(other.value()));
+  {
+    std::fstream        stream(cache.filename(other.value()), std::ios::binary | std::ios::in | std::ios::out);
+    const std::uint64_t hash = other.value();
+    stream.seekp(16);
+    stream.write(reinterpret_cast<const char *>(&hash), sizeof(hash));
+  }
+  BOOST_TEST(not cache.load(other, 5, 7, rejected));
+  BOOST_TEST(rejected.size() == 0);
+
+  // Truncated files are rejected
+  boost::filesystem::resize_file(cache.filename(fingerprint.value()), 2 * 64 + 8);
+  BOOST_TEST(not cache.load(fingerprint, 5, 7, rejected));
+  BOOST_TEST(rejected.size() == 0);
+
+  boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // OperatorCache
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -0,0 +1,355 @@
+#include <Eigen/Core>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <utility>
+#include "mapping/Mapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Filter.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mesh;
+using namespace precice::mapping;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(PartitionOfUnity)
+
+namespace {
+/// Creates a 2D mesh of n x n vertices on the unit square
+PtrMesh createSquare(const std::string &name, int n, double offset = 0.0)
+{
+  PtrMesh mesh(new Mesh(name, 2, testing::nextMeshID()));
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      mesh->createVertex(Eigen::Vector2d(offset + i / (n - 1.0), offset + j / (n - 1.0)));
+    }
+  }
+  return mesh;
+}
+
+double linearField(const Eigen::VectorXd &x)
+{
+  double value = 1.0 + 2.0 * x[0] - 3.0 * x[1];
+  if (x.size() == 3) {
+    value += 0.5 * x[2];
+  }
+  return value;
+}
+
+void fillLinearField(const PtrMesh &mesh, const PtrData &data)
+{
+  mesh->allocateDataValues();
+  for (const auto &v : mesh->vertices()) {
+    data->values()[v.getID()] = linearField(v.getCoords());
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Consistent2D)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh   = createSquare("InMesh", 20);
+  PtrData inData   = inMesh->createData("InData", 1);
+  PtrMesh outMesh  = createSquare("OutMesh", 13, 0.01);
+  PtrData outData  = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.37, 0.91));
+  fillLinearField(inMesh, inData);
+  outMesh->allocateDataValues();
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+  mapping.computeMapping();
+  BOOST_TEST(mapping.hasComputedMapping() == true);
+  BOOST_TEST(mapping.getNumberOfClusters() > 1);
+
+  mapping.map(inData->getID(), outData->getID());
+  // Every local interpolant reproduces linear fields, thus does the blended one
+  for (const auto &v : outMesh->vertices()) {
+    BOOST_TEST(outData->values()[v.getID()] == linearField(v.getCoords()), boost::test_tools::tolerance(1e-8));
+  }
+
+  mapping.clear();
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+  BOOST_TEST(mapping.getNumberOfClusters() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentVector2D)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquare("InMesh", 15);
+  PtrData inData  = inMesh->createData("InData", 2);
+  PtrMesh outMesh = createSquare("OutMesh", 7, 0.02);
+  PtrData outData = outMesh->createData("OutData", 2);
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()[2 * v.getID()]     = 4.0;
+    inData->values()[2 * v.getID() + 1] = linearField(v.getCoords());
+  }
+
+  CompactPolynomialC6                                   fct(0.5);
+  mapping::PartitionOfUnityMapping<CompactPolynomialC6> mapping(Mapping::CONSISTENT, 2, fct, false, false, false, 20, 0.2);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  for (const auto &v : outMesh->vertices()) {
+    BOOST_TEST(outData->values()[2 * v.getID()] == 4.0, boost::test_tools::tolerance(1e-8));
+    BOOST_TEST(outData->values()[2 * v.getID() + 1] == linearField(v.getCoords()), boost::test_tools::tolerance(1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(ConsistentTiltedPlane3D)
+{
+  PRECICE_TEST(1_rank);
+  // All vertices lie on the plane z = 0.5 * x, which renders the local polynomial rank-deficient
+  PtrMesh inMesh(new Mesh("InMesh", 3, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 12; ++i) {
+    for (int j = 0; j < 12; ++j) {
+      const double x = i / 11.0;
+      inMesh->createVertex(Eigen::Vector3d(x, j / 11.0, 0.5 * x));
+    }
+  }
+  fillLinearField(inMesh, inData);
+
+  PtrMesh outMesh(new Mesh("OutMesh", 3, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector3d(0.25, 0.5, 0.125));
+  outMesh->createVertex(Eigen::Vector3d(0.8, 0.1, 0.4));
+  outMesh->createVertex(Eigen::Vector3d(0.55, 0.95, 0.275));
+  outMesh->allocateDataValues();
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 3, ThinPlateSplines(), false, false, false, 15, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  for (const auto &v : outMesh->vertices()) {
+    BOOST_TEST(outData->values()[v.getID()] == linearField(v.getCoords()), boost::test_tools::tolerance(1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Conservative2D)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquare("InMesh", 9, 0.01);
+  PtrData inData  = inMesh->createData("InData", 1);
+  PtrMesh outMesh = createSquare("OutMesh", 16);
+  PtrData outData = outMesh->createData("OutData", 1);
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 1.0 + v.getID() % 4;
+  }
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSERVATIVE, 2, ThinPlateSplines(), false, false, false, 12, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  BOOST_TEST(outData->values().sum() == inData->values().sum(), boost::test_tools::tolerance(1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis2D)
+{
+  PRECICE_TEST(1_rank);
+  // A line of vertices along the x axis
+  PtrMesh inMesh(new Mesh("InMesh", 2, testing::nextMeshID()));
+  PtrData inData = inMesh->createData("InData", 1);
+  for (int i = 0; i < 30; ++i) {
+    inMesh->createVertex(Eigen::Vector2d(i / 29.0, 0.0));
+  }
+  inMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = 2.0 * v.getCoords()[0];
+  }
+
+  PtrMesh outMesh(new Mesh("OutMesh", 2, testing::nextMeshID()));
+  PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.3, 0.0));
+  outMesh->createVertex(Eigen::Vector2d(0.71, 0.0));
+  outMesh->allocateDataValues();
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, true, false, 8, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+
+  BOOST_TEST(outData->values()[0] == 0.6, boost::test_tools::tolerance(1e-8));
+  BOOST_TEST(outData->values()[1] == 1.42, boost::test_tools::tolerance(1e-8));
+}
+
+BOOST_AUTO_TEST_CASE(MultipleData)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh        = createSquare("InMesh", 12);
+  PtrData inDataScalar  = inMesh->createData("InDataScalar", 1);
+  PtrData inDataVector  = inMesh->createData("InDataVector", 2);
+  PtrMesh outMesh       = createSquare("OutMesh", 9, 0.01);
+  PtrData outDataScalar = outMesh->createData("OutDataScalar", 1);
+  PtrData outDataVector = outMesh->createData("OutDataVector", 2);
+  fillLinearField(inMesh, inDataScalar);
+  outMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inDataVector->values()[2 * v.getID()]     = -linearField(v.getCoords());
+    inDataVector->values()[2 * v.getID() + 1] = 3.0;
+  }
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  const Mapping::DataIDPair dataIDs[] = {{inDataScalar->getID(), outDataScalar->getID()},
+                                         {inDataVector->getID(), outDataVector->getID()}};
+  mapping.map(dataIDs);
+
+  for (const auto &v : outMesh->vertices()) {
+    BOOST_TEST(outDataScalar->values()[v.getID()] == linearField(v.getCoords()), boost::test_tools::tolerance(1e-8));
+    BOOST_TEST(outDataVector->values()[2 * v.getID()] == -linearField(v.getCoords()), boost::test_tools::tolerance(1e-8));
+    BOOST_TEST(outDataVector->values()[2 * v.getID() + 1] == 3.0, boost::test_tools::tolerance(1e-8));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TagFirstRound)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquare("InMesh", 20);
+  PtrMesh outMesh(new Mesh("OutMesh", 2, testing::nextMeshID()));
+  outMesh->createVertex(Eigen::Vector2d(0.1, 0.1));
+  outMesh->createVertex(Eigen::Vector2d(0.15, 0.12));
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.tagMeshFirstRound();
+
+  int tagged = 0;
+  for (const auto &v : inMesh->vertices()) {
+    if (v.isTagged()) {
+      ++tagged;
+      BOOST_TEST((v.getCoords() - Eigen::Vector2d(0.1, 0.1)).norm() < 0.5);
+    }
+  }
+  BOOST_TEST(tagged >= 10);
+  BOOST_TEST(tagged < 400);
+  BOOST_TEST(mapping.hasComputedMapping() == false);
+}
+
+BOOST_AUTO_TEST_CASE(RecomputeClusterGridAfterMove)
+{
+  PRECICE_TEST(1_rank);
+  PtrMesh inMesh  = createSquare("InMesh", 20);
+  PtrData inData  = inMesh->createData("InData", 1);
+  PtrMesh outMesh = createSquare("OutMesh", 5, 0.01);
+  PtrData outData = outMesh->createData("OutData", 1);
+  inMesh->allocateDataValues();
+  outMesh->allocateDataValues();
+  for (const auto &v : inMesh->vertices()) {
+    inData->values()[v.getID()] = std::sin(3.0 * v.getCoords()[0]) * std::cos(2.0 * v.getCoords()[1]);
+  }
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.tagMeshFirstRound();
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  const Eigen::VectorXd initialValues = outData->values();
+
+  // Clearing a non-stationary mapping keeps the grid of the tagging
+  mapping.clear();
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  BOOST_TEST(outData->values() == initialValues);
+
+  // The grid follows the moved output vertices, as for a mapping computed at the new positions
+  for (auto &v : outMesh->vertices()) {
+    v.setCoords(Eigen::Vector2d(0.7 * v.getCoords()[0] + 0.13, 0.9 * v.getCoords()[1]));
+  }
+  outMesh->countMove();
+  outMesh->meshChanged(*outMesh);
+  mapping.clear();
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  const Eigen::VectorXd movedValues = outData->values();
+
+  mapping::PartitionOfUnityMapping<ThinPlateSplines> reference(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+  reference.setMeshes(inMesh, outMesh);
+  reference.computeMapping();
+  reference.map(inData->getID(), outData->getID());
+  for (int i = 0; i < outData->values().size(); ++i) {
+    BOOST_TEST(movedValues[i] == outData->values()[i], boost::test_tools::tolerance(1e-14));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentOfPartitioning)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  PtrMesh fullInMesh  = createSquare("FullInMesh", 20);
+  PtrMesh fullOutMesh = createSquare("FullOutMesh", 13, 0.01);
+  auto    inField     = [](const Eigen::VectorXd &x) { return std::sin(3.0 * x[0]) * std::cos(2.0 * x[1]); };
+
+  // Maps to the output vertices with x in [xMin, xMax). The input mesh is received, thus only the input vertices
+  // within the margin around the output vertices are on this rank. These are tagged and filtered as by the partition.
+  size_t filteredVertices = 0;
+  auto   mapTo            = [&](double xMin, double xMax, double margin) {
+    PtrMesh inMesh(new Mesh("InMesh", 2, testing::nextMeshID()));
+    for (const auto &v : fullInMesh->vertices()) {
+      if (v.getCoords()[0] >= xMin - margin && v.getCoords()[0] < xMax + margin) {
+        inMesh->createVertex(v.getCoords());
+      }
+    }
+    PtrMesh outMesh(new Mesh("OutMesh", 2, testing::nextMeshID()));
+    PtrData outData = outMesh->createData("OutData", 1);
+    for (const auto &v : fullOutMesh->vertices()) {
+      if (v.getCoords()[0] >= xMin && v.getCoords()[0] < xMax) {
+        outMesh->createVertex(v.getCoords());
+      }
+    }
+    outMesh->allocateDataValues();
+
+    mapping::PartitionOfUnityMapping<ThinPlateSplines> mapping(Mapping::CONSISTENT, 2, ThinPlateSplines(), false, false, false, 10, 0.3);
+    mapping.setMeshes(inMesh, outMesh);
+    mapping.tagMeshFirstRound();
+    mapping.tagMeshSecondRound();
+    Mesh filteredMesh("FilteredMesh", 2, testing::nextMeshID());
+    mesh::filterMesh(filteredMesh, *inMesh, [](const Vertex &v) { return v.isTagged(); });
+    filteredVertices = inMesh->vertices().size() - filteredMesh.vertices().size();
+    inMesh->clear();
+    inMesh->addMesh(filteredMesh);
+
+    PtrData inData = inMesh->createData("InData", 1);
+    inMesh->allocateDataValues();
+    for (const auto &v : inMesh->vertices()) {
+      inData->values()[v.getID()] = inField(v.getCoords());
+    }
+    mapping.computeMapping();
+    mapping.map(inData->getID(), outData->getID());
+
+    std::map<std::pair<double, double>, double> values;
+    for (const auto &v : outMesh->vertices()) {
+      values.emplace(std::make_pair(v.getCoords()[0], v.getCoords()[1]), outData->values()[v.getID()]);
+    }
+    return values;
+  };
+
+  // Both ranks holding all vertices yields the same grid of clusters as a single rank
+  const auto reference = mapTo(-1.0, 2.0, 0.0);
+  const auto values    = context.isMaster() ? mapTo(-1.0, 0.5, 0.3) : mapTo(0.5, 2.0, 0.3);
+
+  BOOST_TEST(filteredVertices > 0);
+  BOOST_TEST(not values.empty());
+  for (const auto &value : values) {
+    BOOST_TEST(value.second == reference.at(value.first), boost::test_tools::tolerance(1e-12));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PartitionOfUnity
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -0,0 +1,167 @@
+#include <Eigen/Core>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/impl/BasisFunctions.hpp"
+#include "mapping/impl/RBFAssembly.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Vertex.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(RBFAssembly)
+
+namespace {
+template <typename RBF>
+void testEvaluateInPlace(const RBF &fct)
+{
+  Eigen::VectorXd radii(9);
+  radii << 0.0, 1e-16, 0.01, 0.1, 0.5, 0.99, 1.0, 1.5, 4.0;
+  Eigen::VectorXd values = radii;
+  fct.evaluateInPlace(values);
+  for (Eigen::Index i = 0; i < radii.size(); ++i) {
+    BOOST_TEST(values(i) == fct.evaluate(radii(i)), boost::test_tools::tolerance(1e-10));
+  }
+}
+
+double distance(const Eigen::VectorXd &u, const Eigen::VectorXd &v, const std::vector<bool> &deadAxis)
+{
+  double sum = 0.0;
+  for (int d = 0; d < u.size(); ++d) {
+    if (not deadAxis[d]) {
+      sum += std::pow(u[d] - v[d], 2);
+    }
+  }
+  return std::sqrt(sum);
+}
+
+/// Assembles the interpolation matrix entry by entry
+template <typename RBF>
+Eigen::MatrixXd referenceMatrixCLU(const RBF &fct, const mesh::Mesh &inMesh, const std::vector<bool> &deadAxis)
+{
+  const int inSize     = inMesh.vertices().size();
+  const int polyparams = 1 + inMesh.getDimensions() - std::count(deadAxis.begin(), deadAxis.end(), true);
+
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Zero(inSize + polyparams, inSize + polyparams);
+  for (int i = 0; i < inSize; ++i) {
+    const auto &u = inMesh.vertices()[i].getCoords();
+    for (int j = 0; j < inSize; ++j) {
+      matrix(i, j) = fct.evaluate(distance(u, inMesh.vertices()[j].getCoords(), deadAxis));
+    }
+    matrix(i, inSize) = matrix(inSize, i) = 1.0;
+    int column                            = inSize + 1;
+    for (int d = 0; d < inMesh.getDimensions(); ++d) {
+      if (not deadAxis[d]) {
+        matrix(i, column) = matrix(column, i) = u[d];
+        ++column;
+      }
+    }
+  }
+  return matrix;
+}
+
+/// Assembles the evaluation matrix entry by entry
+template <typename RBF>
+Eigen::MatrixXd referenceMatrixA(const RBF &fct, const mesh::Mesh &inMesh, const mesh::Mesh &outMesh, const std::vector<bool> &deadAxis)
+{
+  const int inSize     = inMesh.vertices().size();
+  const int outSize    = outMesh.vertices().size();
+  const int polyparams = 1 + inMesh.getDimensions() - std::count(deadAxis.begin(), deadAxis.end(), true);
+
+  Eigen::MatrixXd matrix = Eigen::MatrixXd::Zero(outSize, inSize + polyparams);
+  for (int i = 0; i < outSize; ++i) {
+    const auto &u = outMesh.vertices()[i].getCoords();
+    for (int j = 0; j < inSize; ++j) {
+      matrix(i, j) = fct.evaluate(distance(u, inMesh.vertices()[j].getCoords(), deadAxis));
+    }
+    matrix(i, inSize) = 1.0;
+    int column        = inSize + 1;
+    for (int d = 0; d < outMesh.getDimensions(); ++d) {
+      if (not deadAxis[d]) {
+        matrix(i, column++) = u[d];
+      }
+    }
+  }
+  return matrix;
+}
+
+void fillMesh(mesh::Mesh &mesh, int size, double offset)
+{
+  for (int i = 0; i < size; ++i) {
+    Eigen::VectorXd coords(mesh.getDimensions());
+    for (int d = 0; d < mesh.getDimensions(); ++d) {
+      coords[d] = offset + std::fmod(0.37 * (i + 1) * (d + 1) + 0.11 * d, 1.0);
+    }
+    mesh.createVertex(coords);
+  }
+}
+
+template <typename RBF>
+void testAssembly(const RBF &fct, int dimensions, const std::vector<bool> &deadAxis)
+{
+  mesh::Mesh inMesh("InMesh", dimensions, testing::nextMeshID());
+  mesh::Mesh outMesh("OutMesh", dimensions, testing::nextMeshID());
+  fillMesh(inMesh, 23, 0.0);
+  fillMesh(outMesh, 17, 0.05);
+
+  const Eigen::MatrixXd matrixCLU = buildMatrixCLU(fct, inMesh, deadAxis);
+  const Eigen::MatrixXd matrixA   = buildMatrixA(fct, inMesh, outMesh, deadAxis);
+  BOOST_TEST(matrixCLU.isApprox(referenceMatrixCLU(fct, inMesh, deadAxis), 1e-12));
+  BOOST_TEST(matrixA.isApprox(referenceMatrixA(fct, inMesh, outMesh, deadAxis), 1e-12));
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(EvaluateInPlace)
+{
+  PRECICE_TEST(1_rank);
+  testEvaluateInPlace(ThinPlateSplines());
+  testEvaluateInPlace(Multiquadrics(0.3));
+  testEvaluateInPlace(InverseMultiquadrics(0.3));
+  testEvaluateInPlace(VolumeSplines());
+  testEvaluateInPlace(Gaussian(2.0));
+  testEvaluateInPlace(Gaussian(2.0, 1.2));
+  testEvaluateInPlace(CompactThinPlateSplinesC2(1.2));
+  testEvaluateInPlace(CompactPolynomialC0(1.2));
+  testEvaluateInPlace(CompactPolynomialC6(1.2));
+}
+
+BOOST_AUTO_TEST_CASE(AxesConfiguration)
+{
+  PRECICE_TEST(1_rank);
+  using impl::Axes;
+  BOOST_TEST((Axes<2, 0u>::activeDimensions) == 2);
+  BOOST_TEST((Axes<2, 1u>::activeDimensions) == 1);
+  BOOST_TEST((Axes<3, 0u>::activeDimensions) == 3);
+  BOOST_TEST((Axes<3, 5u>::activeDimensions) == 1);
+  BOOST_TEST((Axes<3, 4u>::isActive(1)));
+  BOOST_TEST(not(Axes<3, 4u>::isActive(2)));
+
+  BOOST_TEST(impl::deadAxisMask(std::vector<bool>{false, true, true}, 3) == 6u);
+  BOOST_TEST(impl::deadAxisMask(std::vector<bool>{true, false}, 2) == 1u);
+  BOOST_TEST(impl::dispatchAxes(3, 2u, [](auto axes) { return decltype(axes)::activeDimensions; }) == 2);
+}
+
+BOOST_AUTO_TEST_CASE(Assembly2D)
+{
+  PRECICE_TEST(1_rank);
+  testAssembly(ThinPlateSplines(), 2, {false, false});
+  testAssembly(CompactPolynomialC6(0.6), 2, {false, false});
+  testAssembly(Gaussian(2.0), 2, {true, false});
+}
+
+BOOST_AUTO_TEST_CASE(Assembly3D)
+{
+  PRECICE_TEST(1_rank);
+  testAssembly(ThinPlateSplines(), 3, {false, false, false});
+  testAssembly(InverseMultiquadrics(0.4), 3, {false, true, false});
+  testAssembly(CompactThinPlateSplinesC2(0.7), 3, {true, false, true});
+}
+
+BOOST_AUTO_TEST_SUITE_END() // RBFAssembly
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
@@ -1,5 +1,8 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <iterator>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -8,6 +11,7 @@
 #include "logging/Logger.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/RadialBasisFctMapping.hpp"
+#include "mapping/SparseRadialBasisFctMapping.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
 #include "mesh/Data.hpp"
 #include "mesh/Mesh.hpp"
@@ -152,6 +156,50 @@ void testDistributed(const TestContext &    context,
   BOOST_TEST(outData->values().size() == index * valueDimension);
 }
 
+/// Maps the data of testDistributed and a scaled copy of it with a single call
+void testDistributedMultipleData(const TestContext &    context,
+                                 Mapping &              mapping,
+                                 MeshSpecification      inMeshSpec,
+                                 MeshSpecification      outMeshSpec,
+                                 ReferenceSpecification referenceSpec,
+                                 int                    inGlobalIndexOffset = 0)
+{
+  int meshDimension  = inMeshSpec.at(0).position.size();
+  int valueDimension = inMeshSpec.at(0).value.size();
+
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", meshDimension, testing::nextMeshID()));
+  mesh::PtrData inData       = inMesh->createData("InData", valueDimension);
+  mesh::PtrData inDataScaled = inMesh->createData("InDataScaled", valueDimension);
+
+  getDistributedMesh(context, inMeshSpec, inMesh, inData, inGlobalIndexOffset);
+  inDataScaled->values() = 10.0 * inData->values();
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("outMesh", meshDimension, testing::nextMeshID()));
+  mesh::PtrData outData       = outMesh->createData("OutData", valueDimension);
+  mesh::PtrData outDataScaled = outMesh->createData("OutDataScaled", valueDimension);
+
+  getDistributedMesh(context, outMeshSpec, outMesh, outData);
+
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  const Mapping::DataIDPair dataIDs[] = {{inData->getID(), outData->getID()},
+                                         {inDataScaled->getID(), outDataScaled->getID()}};
+  mapping.map(dataIDs);
+
+  int index = 0;
+  for (auto &referenceVertex : referenceSpec) {
+    if (referenceVertex.first == context.rank or referenceVertex.first == -1) {
+      for (int dim = 0; dim < valueDimension; ++dim) {
+        BOOST_TEST_INFO("Index of vertex: " << index << " - Dimension: " << dim);
+        BOOST_TEST(outData->values()(index * valueDimension + dim) == referenceVertex.second.at(dim));
+        BOOST_TEST(outDataScaled->values()(index * valueDimension + dim) == 10.0 * referenceVertex.second.at(dim));
+      }
+      ++index;
+    }
+  }
+  BOOST_TEST(outData->values().size() == index * valueDimension);
+}
+
 /// Test with a homogenous distribution of mesh amoung ranks
 BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1)
 {
@@ -225,6 +273,117 @@ BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1Vector)
                    {3, {8, 11}}});
 }
 
+/// Same as DistributedConsistent2DV1Vector, but mapping two data at once
+BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1VectorMultipleData)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  Gaussian                        fct(5.0);
+  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
+
+  testDistributedMultipleData(context, mapping,
+                              {// Consistent mapping: The inMesh is communicated
+                               {-1, 0, {0, 0}, {1, 4}},
+                               {-1, 0, {0, 1}, {2, 5}},
+                               {-1, 1, {1, 0}, {3, 6}},
+                               {-1, 1, {1, 1}, {4, 7}},
+                               {-1, 2, {2, 0}, {5, 8}},
+                               {-1, 2, {2, 1}, {6, 9}},
+                               {-1, 3, {3, 0}, {7, 10}},
+                               {-1, 3, {3, 1}, {8, 11}}},
+                              {// The outMesh is local, distributed amoung all ranks
+                               {0, -1, {0, 0}, {0, 0}},
+                               {0, -1, {0, 1}, {0, 0}},
+                               {1, -1, {1, 0}, {0, 0}},
+                               {1, -1, {1, 1}, {0, 0}},
+                               {2, -1, {2, 0}, {0, 0}},
+                               {2, -1, {2, 1}, {0, 0}},
+                               {3, -1, {3, 0}, {0, 0}},
+                               {3, -1, {3, 1}, {0, 0}}},
+                              {// Tests for {0, 1} on the first rank, {1, 2} on the second, ...
+                               {0, {1, 4}},
+                               {0, {2, 5}},
+                               {1, {3, 6}},
+                               {1, {4, 7}},
+                               {2, {5, 8}},
+                               {2, {6, 9}},
+                               {3, {7, 10}},
+                               {3, {8, 11}}});
+}
+
+/// Same as DistributedConsistent2DV1Vector, but using the precomputed evaluation operator
+BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1VectorPrecomputed)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  Gaussian                        fct(5.0);
+  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false, true);
+
+  testDistributed(context, mapping,
+                  {// Consistent mapping: The inMesh is communicated
+                   {-1, 0, {0, 0}, {1, 4}},
+                   {-1, 0, {0, 1}, {2, 5}},
+                   {-1, 1, {1, 0}, {3, 6}},
+                   {-1, 1, {1, 1}, {4, 7}},
+                   {-1, 2, {2, 0}, {5, 8}},
+                   {-1, 2, {2, 1}, {6, 9}},
+                   {-1, 3, {3, 0}, {7, 10}},
+                   {-1, 3, {3, 1}, {8, 11}}},
+                  {// The outMesh is local, distributed amoung all ranks
+                   {0, -1, {0, 0}, {0, 0}},
+                   {0, -1, {0, 1}, {0, 0}},
+                   {1, -1, {1, 0}, {0, 0}},
+                   {1, -1, {1, 1}, {0, 0}},
+                   {2, -1, {2, 0}, {0, 0}},
+                   {2, -1, {2, 1}, {0, 0}},
+                   {3, -1, {3, 0}, {0, 0}},
+                   {3, -1, {3, 1}, {0, 0}}},
+                  {// Tests for {0, 1} on the first rank, {1, 2} on the second, ...
+                   {0, {1, 4}},
+                   {0, {2, 5}},
+                   {1, {3, 6}},
+                   {1, {4, 7}},
+                   {2, {5, 8}},
+                   {2, {6, 9}},
+                   {3, {7, 10}},
+                   {3, {8, 11}}});
+}
+
+/// Test with a homogenous distribution of mesh amoung ranks, gathering a sparse system on the master
+BOOST_AUTO_TEST_CASE(DistributedConsistent2DV1Sparse)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  Gaussian                              fct(5.0);
+  SparseRadialBasisFctMapping<Gaussian> mapping(Mapping::CONSISTENT, 2, fct, false, false, false);
+
+  testDistributed(context, mapping,
+                  {// Consistent mapping: The inMesh is communicated
+                   {-1, 0, {0, 0}, {1}},
+                   {-1, 0, {0, 1}, {2}},
+                   {-1, 1, {1, 0}, {3}},
+                   {-1, 1, {1, 1}, {4}},
+                   {-1, 2, {2, 0}, {5}},
+                   {-1, 2, {2, 1}, {6}},
+                   {-1, 3, {3, 0}, {7}},
+                   {-1, 3, {3, 1}, {8}}},
+                  {// The outMesh is local, distributed amoung all ranks
+                   {0, -1, {0, 0}, {0}},
+                   {0, -1, {0, 1}, {0}},
+                   {1, -1, {1, 0}, {0}},
+                   {1, -1, {1, 1}, {0}},
+                   {2, -1, {2, 0}, {0}},
+                   {2, -1, {2, 1}, {0}},
+                   {3, -1, {3, 0}, {0}},
+                   {3, -1, {3, 1}, {0}}},
+                  {// Tests for {0, 1} on the first rank, {1, 2} on the second, ...
+                   {0, {1}},
+                   {0, {2}},
+                   {1, {3}},
+                   {1, {4}},
+                   {2, {5}},
+                   {2, {6}},
+                   {3, {7}},
+                   {3, {8}}});
+}
+
 /// Using a more heterogenous distributon of vertices and owner
 BOOST_AUTO_TEST_CASE(DistributedConsistent2DV2)
 {
@@ -680,6 +839,133 @@ BOOST_AUTO_TEST_CASE(DistributedConservative2DV1Vector)
                   context.rank * 2);
 }
 
+/// Same as DistributedConservative2DV1Vector, but mapping two data at once
+BOOST_AUTO_TEST_CASE(DistributedConservative2DV1VectorMultipleData)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  Gaussian                        fct(5.0);
+  RadialBasisFctMapping<Gaussian> mapping(Mapping::CONSERVATIVE, 2, fct, false, false, false);
+
+  testDistributedMultipleData(context, mapping,
+                              {// Conservative mapping: The inMesh is local
+                               {0, -1, {0, 0}, {1, 4}},
+                               {0, -1, {0, 1}, {2, 5}},
+                               {1, -1, {1, 0}, {3, 6}},
+                               {1, -1, {1, 1}, {4, 7}},
+                               {2, -1, {2, 0}, {5, 8}},
+                               {2, -1, {2, 1}, {6, 9}},
+                               {3, -1, {3, 0}, {7, 10}},
+                               {3, -1, {3, 1}, {8, 11}}},
+                              {// The outMesh is distributed
+                               {-1, 0, {0, 0}, {0, 0}},
+                               {-1, 0, {0, 1}, {0, 0}},
+                               {-1, 1, {1, 0}, {0, 0}},
+                               {-1, 1, {1, 1}, {0, 0}},
+                               {-1, 2, {2, 0}, {0, 0}},
+                               {-1, 2, {2, 1}, {0, 0}},
+                               {-1, 3, {3, 0}, {0, 0}},
+                               {-1, 3, {3, 1}, {0, 0}}},
+                              {// Tests for {0, 1, 0, 0, 0, 0, 0, 0} on the first rank,
+                               // {0, 0, 2, 3, 0, 0, 0, 0} on the second, ...
+                               {0, {1, 4}},
+                               {0, {2, 5}},
+                               {0, {0, 0}},
+                               {0, {0, 0}},
+                               {0, {0, 0}},
+                               {0, {0, 0}},
+                               {0, {0, 0}},
+                               {0, {0, 0}},
+                               {1, {0, 0}},
+                               {1, {0, 0}},
+                               {1, {3, 6}},
+                               {1, {4, 7}},
+                               {1, {0, 0}},
+                               {1, {0, 0}},
+                               {1, {0, 0}},
+                               {1, {0, 0}},
+                               {2, {0, 0}},
+                               {2, {0, 0}},
+                               {2, {0, 0}},
+                               {2, {0, 0}},
+                               {2, {5, 8}},
+                               {2, {6, 9}},
+                               {2, {0, 0}},
+                               {2, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {0, 0}},
+                               {3, {7, 10}},
+                               {3, {8, 11}}},
+                              context.rank * 2);
+}
+
+/// Test with a homogenous distribution of mesh amoung ranks, gathering a sparse system on the master
+BOOST_AUTO_TEST_CASE(DistributedConservative2DV1Sparse)
+{
+  PRECICE_TEST(""_on(4_ranks).setupMasterSlaves());
+  Gaussian                              fct(5.0);
+  SparseRadialBasisFctMapping<Gaussian> mapping(Mapping::CONSERVATIVE, 2, fct, false, false, false,
+                                                SparseRadialBasisFctMapping<Gaussian>::Method::ConjugateGradient, 1e-12);
+
+  testDistributed(context, mapping,
+                  {// Conservative mapping: The inMesh is local
+                   {0, -1, {0, 0}, {1}},
+                   {0, -1, {0, 1}, {2}},
+                   {1, -1, {1, 0}, {3}},
+                   {1, -1, {1, 1}, {4}},
+                   {2, -1, {2, 0}, {5}},
+                   {2, -1, {2, 1}, {6}},
+                   {3, -1, {3, 0}, {7}},
+                   {3, -1, {3, 1}, {8}}},
+                  {// The outMesh is distributed
+                   {-1, 0, {0, 0}, {0}},
+                   {-1, 0, {0, 1}, {0}},
+                   {-1, 1, {1, 0}, {0}},
+                   {-1, 1, {1, 1}, {0}},
+                   {-1, 2, {2, 0}, {0}},
+                   {-1, 2, {2, 1}, {0}},
+                   {-1, 3, {3, 0}, {0}},
+                   {-1, 3, {3, 1}, {0}}},
+                  {// Tests for {0, 1, 0, 0, 0, 0, 0, 0} on the first rank,
+                   // {0, 0, 2, 3, 0, 0, 0, 0} on the second, ...
+                   {0, {1}},
+                   {0, {2}},
+                   {0, {0}},
+                   {0, {0}},
+                   {0, {0}},
+                   {0, {0}},
+                   {0, {0}},
+                   {0, {0}},
+                   {1, {0}},
+                   {1, {0}},
+                   {1, {3}},
+                   {1, {4}},
+                   {1, {0}},
+                   {1, {0}},
+                   {1, {0}},
+                   {1, {0}},
+                   {2, {0}},
+                   {2, {0}},
+                   {2, {0}},
+                   {2, {0}},
+                   {2, {5}},
+                   {2, {6}},
+                   {2, {0}},
+                   {2, {0}},
+                   {3, {0}},
+                   {3, {0}},
+                   {3, {0}},
+                   {3, {0}},
+                   {3, {0}},
+                   {3, {0}},
+                   {3, {7}},
+                   {3, {8}}},
+                  context.rank * 2);
+}
+
 /// Using a more heterogenous distribution of vertices and owner
 BOOST_AUTO_TEST_CASE(DistributedConservative2DV2)
 {
@@ -1748,6 +2034,130 @@ BOOST_AUTO_TEST_CASE(MapThinPlateSplines)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapThinPlateSplinesPrecomputed)
+{
+  PRECICE_TEST(1_rank);
+  bool                                    xDead = false;
+  bool                                    yDead = false;
+  bool                                    zDead = false;
+  ThinPlateSplines                        fct;
+  RadialBasisFctMapping<ThinPlateSplines> consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, true);
+  perform2DTestConsistentMapping(consistentMap2D);
+  RadialBasisFctMapping<ThinPlateSplines> consistentMap2DVector(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, true);
+  perform2DTestConsistentMappingVector(consistentMap2DVector);
+  RadialBasisFctMapping<ThinPlateSplines> consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead, true);
+  perform3DTestConsistentMapping(consistentMap3D);
+  RadialBasisFctMapping<ThinPlateSplines> scaledConsistentMap2D(Mapping::SCALEDCONSISTENT, 2, fct, xDead, yDead, zDead, true);
+  perform2DTestScaledConsistentMapping(scaledConsistentMap2D);
+  RadialBasisFctMapping<ThinPlateSplines> conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead, true);
+  perform2DTestConservativeMapping(conservativeMap2D);
+  RadialBasisFctMapping<ThinPlateSplines> conservativeMap2DVector(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead, true);
+  perform2DTestConservativeMappingVector(conservativeMap2DVector);
+  RadialBasisFctMapping<ThinPlateSplines> conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead, true);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
+BOOST_AUTO_TEST_CASE(MapThinPlateSplinesCached)
+{
+  PRECICE_TEST(1_rank);
+  bool              xDead     = false;
+  bool              yDead     = false;
+  bool              zDead     = false;
+  const std::string directory = "rbf-operator-cache";
+  ThinPlateSplines  fct;
+  boost::filesystem::remove_all(directory);
+
+  // The first pass stores the operators, the second one loads them
+  for (int pass = 0; pass < 2; ++pass) {
+    RadialBasisFctMapping<ThinPlateSplines> consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, false, 1, directory);
+    perform2DTestConsistentMapping(consistentMap2D);
+    RadialBasisFctMapping<ThinPlateSplines> consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead, false, 1, directory);
+    perform3DTestConsistentMapping(consistentMap3D);
+    RadialBasisFctMapping<ThinPlateSplines> conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead, false, 1, directory);
+    perform2DTestConservativeMapping(conservativeMap2D);
+  }
+  BOOST_TEST(not boost::filesystem::is_empty(directory));
+  boost::filesystem::remove_all(directory);
+}
+
+/// Maps from the corners of the unit square to two points with an operator cache and returns the results
+template <typename RADIAL_BASIS_FUNCTION_T>
+Eigen::VectorXd mapWithOperatorCache(const RADIAL_BASIS_FUNCTION_T &fct, const std::string &directory)
+{
+  int           dimensions = 2;
+  mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData inData = inMesh->createData("InData", 1);
+  inMesh->createVertex(Eigen::Vector2d(0.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 0.0));
+  inMesh->createVertex(Eigen::Vector2d(1.0, 1.0));
+  inMesh->createVertex(Eigen::Vector2d(0.0, 1.0));
+  inMesh->allocateDataValues();
+  addGlobalIndex(inMesh);
+  inData->values() << 1.0, 2.0, 2.0, 1.0;
+
+  mesh::PtrMesh outMesh(new mesh::Mesh("OutMesh", dimensions, testing::nextMeshID()));
+  mesh::PtrData outData = outMesh->createData("OutData", 1);
+  outMesh->createVertex(Eigen::Vector2d(0.5, 0.5));
+  outMesh->createVertex(Eigen::Vector2d(0.2, 0.7));
+  outMesh->allocateDataValues();
+  addGlobalIndex(outMesh);
+
+  RadialBasisFctMapping<RADIAL_BASIS_FUNCTION_T> mapping(Mapping::CONSISTENT, dimensions, fct, false, false, false, false, 1, directory);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.computeMapping();
+  mapping.map(inData->getID(), outData->getID());
+  return outData->values();
+}
+
+/// Checks that a second mapping with an identical, but separately constructed basis function loads the cached operator
+template <typename RADIAL_BASIS_FUNCTION_T>
+void testOperatorCacheHit(const RADIAL_BASIS_FUNCTION_T &first, const RADIAL_BASIS_FUNCTION_T &second)
+{
+  namespace fs                = boost::filesystem;
+  const std::string directory = "rbf-operator-cache-hit";
+  fs::remove_all(directory);
+
+  const Eigen::VectorXd computed = mapWithOperatorCache(first, directory);
+  std::vector<fs::path> files{fs::directory_iterator(directory), fs::directory_iterator()};
+  BOOST_TEST_REQUIRE(files.size() == 1);
+
+  // Double the entries of the cached operator at the end of the file, such that only a loaded operator doubles the results.
+  // The header stores the number of rows and columns behind the magic, version, header size, and hash.
+  {
+    fs::fstream  stream(files[0], std::ios::in | std::ios::out | std::ios::binary);
+    std::int64_t size[2];
+    stream.seekg(24);
+    stream.read(reinterpret_cast<char *>(size), sizeof(size));
+    std::vector<double> entries(size[0] * size[1]);
+    const auto          offset = fs::file_size(files[0]) - entries.size() * sizeof(double);
+    stream.seekg(offset);
+    stream.read(reinterpret_cast<char *>(entries.data()), entries.size() * sizeof(double));
+    for (double &entry : entries) {
+      entry *= 2.0;
+    }
+    stream.seekp(offset);
+    stream.write(reinterpret_cast<const char *>(entries.data()), entries.size() * sizeof(double));
+    BOOST_TEST_REQUIRE(stream.good());
+  }
+
+  const Eigen::VectorXd loaded = mapWithOperatorCache(second, directory);
+  BOOST_TEST(testing::equals(loaded, Eigen::VectorXd(2.0 * computed)));
+  BOOST_TEST(std::distance(fs::directory_iterator(directory), fs::directory_iterator()) == 1);
+  fs::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(MapGaussianCached)
+{
+  PRECICE_TEST(1_rank);
+  testOperatorCacheHit(Gaussian(1.0), Gaussian(1.0));
+}
+
+BOOST_AUTO_TEST_CASE(MapCompactPolynomialC6Cached)
+{
+  PRECICE_TEST(1_rank);
+  testOperatorCacheHit(CompactPolynomialC6(2.0), CompactPolynomialC6(2.0));
+}
+
 BOOST_AUTO_TEST_CASE(MapMultiquadrics)
 {
   PRECICE_TEST(1_rank);
@@ -1832,6 +2242,26 @@ BOOST_AUTO_TEST_CASE(MapGaussian)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapGaussianThreaded)
+{
+  PRECICE_TEST(1_rank);
+  bool                            xDead   = false;
+  bool                            yDead   = false;
+  bool                            zDead   = false;
+  int                             threads = 3;
+  Gaussian                        fct(1.0);
+  RadialBasisFctMapping<Gaussian> consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, false, threads);
+  perform2DTestConsistentMapping(consistentMap2D);
+  RadialBasisFctMapping<Gaussian> consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead, false, threads);
+  perform3DTestConsistentMapping(consistentMap3D);
+  RadialBasisFctMapping<Gaussian> consistentMap3DPrecomputed(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead, true, threads);
+  perform3DTestConsistentMapping(consistentMap3DPrecomputed);
+  RadialBasisFctMapping<Gaussian> conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead, false, threads);
+  perform2DTestConservativeMapping(conservativeMap2D);
+  RadialBasisFctMapping<Gaussian> conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead, false, threads);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
 BOOST_AUTO_TEST_CASE(MapCompactThinPlateSplinesC2)
 {
   PRECICE_TEST(1_rank);
@@ -1901,6 +2331,67 @@ BOOST_AUTO_TEST_CASE(MapPetCompactPolynomialC6)
   perform3DTestConservativeMapping(conservativeMap3D);
 }
 
+BOOST_AUTO_TEST_CASE(MapSparseGaussian)
+{
+  PRECICE_TEST(1_rank);
+  bool     xDead = false;
+  bool     yDead = false;
+  bool     zDead = false;
+  Gaussian fct(1.0);
+  using Mapping = SparseRadialBasisFctMapping<Gaussian>;
+  Mapping consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead);
+  perform2DTestConsistentMapping(consistentMap2D);
+  Mapping consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead);
+  perform3DTestConsistentMapping(consistentMap3D);
+  Mapping conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead);
+  perform2DTestConservativeMapping(conservativeMap2D);
+  Mapping conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
+BOOST_AUTO_TEST_CASE(MapSparseCompactPolynomialC6)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  bool                xDead         = false;
+  bool                yDead         = false;
+  bool                zDead         = false;
+  CompactPolynomialC6 fct(supportRadius);
+  using Mapping = SparseRadialBasisFctMapping<CompactPolynomialC6>;
+  Mapping consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead);
+  perform2DTestConsistentMapping(consistentMap2D);
+  Mapping consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead);
+  perform3DTestConsistentMapping(consistentMap3D);
+  Mapping scaledConsistentMap2D(Mapping::SCALEDCONSISTENT, 2, fct, xDead, yDead, zDead);
+  perform2DTestScaledConsistentMapping(scaledConsistentMap2D);
+  Mapping scaledConsistentMap3D(Mapping::SCALEDCONSISTENT, 3, fct, xDead, yDead, zDead);
+  perform3DTestScaledConsistentMapping(scaledConsistentMap3D);
+  Mapping conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead);
+  perform2DTestConservativeMapping(conservativeMap2D);
+  Mapping conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
+BOOST_AUTO_TEST_CASE(MapSparseCompactThinPlateSplinesC2ConjugateGradient)
+{
+  PRECICE_TEST(1_rank);
+  double                    supportRadius = 1.2;
+  bool                      xDead         = false;
+  bool                      yDead         = false;
+  bool                      zDead         = false;
+  CompactThinPlateSplinesC2 fct(supportRadius);
+  using Mapping     = SparseRadialBasisFctMapping<CompactThinPlateSplinesC2>;
+  const auto method = Mapping::Method::ConjugateGradient;
+  Mapping    consistentMap2D(Mapping::CONSISTENT, 2, fct, xDead, yDead, zDead, method, 1e-12);
+  perform2DTestConsistentMapping(consistentMap2D);
+  Mapping consistentMap3D(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead, method, 1e-12);
+  perform3DTestConsistentMapping(consistentMap3D);
+  Mapping conservativeMap2D(Mapping::CONSERVATIVE, 2, fct, xDead, yDead, zDead, method, 1e-12);
+  perform2DTestConservativeMapping(conservativeMap2D);
+  Mapping conservativeMap3D(Mapping::CONSERVATIVE, 3, fct, xDead, yDead, zDead, method, 1e-12);
+  perform3DTestConservativeMapping(conservativeMap3D);
+}
+
 BOOST_AUTO_TEST_CASE(DeadAxis2)
 {
   PRECICE_TEST(1_rank);
@@ -1949,20 +2440,12 @@ BOOST_AUTO_TEST_CASE(DeadAxis2)
   BOOST_TEST(value == 1.0);
 }
 
-BOOST_AUTO_TEST_CASE(DeadAxis3D)
+/// Maps in the xz-plane with a dead y-axis
+void performDeadAxis3D(Mapping &mapping)
 {
-  PRECICE_TEST(1_rank);
   using Eigen::Vector3d;
   int dimensions = 3;
 
-  double              supportRadius = 1.2;
-  CompactPolynomialC6 fct(supportRadius);
-  bool                xDead = false;
-  bool                yDead = true;
-  bool                zDead = false;
-  using Mapping             = RadialBasisFctMapping<CompactPolynomialC6>;
-  Mapping mapping(Mapping::CONSISTENT, dimensions, fct, xDead, yDead, zDead);
-
   // Create mesh to map from
   mesh::PtrMesh inMesh(new mesh::Mesh("InMesh", dimensions, testing::nextMeshID()));
   mesh::PtrData inData   = inMesh->createData("InData", 1);
@@ -2002,6 +2485,32 @@ BOOST_AUTO_TEST_CASE(DeadAxis3D)
   BOOST_TEST(outData->values()(3) == 4.3);
 }
 
+BOOST_AUTO_TEST_CASE(DeadAxis3D)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC6 fct(supportRadius);
+  bool                xDead = false;
+  bool                yDead = true;
+  bool                zDead = false;
+  using Mapping             = RadialBasisFctMapping<CompactPolynomialC6>;
+  Mapping mapping(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead);
+  performDeadAxis3D(mapping);
+}
+
+BOOST_AUTO_TEST_CASE(DeadAxis3DSparse)
+{
+  PRECICE_TEST(1_rank);
+  double              supportRadius = 1.2;
+  CompactPolynomialC6 fct(supportRadius);
+  bool                xDead = false;
+  bool                yDead = true;
+  bool                zDead = false;
+  using Mapping             = SparseRadialBasisFctMapping<CompactPolynomialC6>;
+  Mapping mapping(Mapping::CONSISTENT, 3, fct, xDead, yDead, zDead);
+  performDeadAxis3D(mapping);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Serial
 
 BOOST_AUTO_TEST_SUITE_END() // RadialBasisFunctionMapping
@@ -0,0 +1,117 @@
+#include <Eigen/Core>
+#include <Eigen/SparseCore>
+#include <utility>
+#include <vector>
+#include "mapping/Mapping.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/SharedPointer.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+
+using namespace precice;
+using namespace precice::mapping;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(MappingTests)
+BOOST_AUTO_TEST_SUITE(SparseOperator)
+
+namespace {
+/// Mapping with a given operator, which maps all data with mapWithSparseOperator()
+class OperatorMapping : public Mapping {
+public:
+  OperatorMapping(Constraint constraint, const std::vector<Eigen::Triplet<double>> &weights, int rows, int cols)
+      : Mapping(constraint, 2)
+  {
+    SparseOperator sparseOperator(rows, cols);
+    sparseOperator.setFromTriplets(weights.begin(), weights.end());
+    setSparseOperator(std::move(sparseOperator));
+  }
+
+  void computeMapping() override {}
+
+  bool hasComputedMapping() const override
+  {
+    return true;
+  }
+
+  void clear() override {}
+
+  void map(int inputDataID, int outputDataID) override
+  {
+    const DataIDPair ids{inputDataID, outputDataID};
+    mapWithSparseOperator({&ids, 1});
+  }
+
+  using Mapping::map;
+
+  void tagMeshFirstRound() override {}
+
+  void tagMeshSecondRound() override {}
+};
+
+/// Creates a 2D mesh with vertices along the x-axis and a scalar and a vector data
+mesh::PtrMesh createMesh(const std::string &name, int vertices)
+{
+  mesh::PtrMesh mesh(new mesh::Mesh(name, 2, testing::nextMeshID()));
+  mesh->createData(name + "Scalar", 1);
+  mesh->createData(name + "Vector", 2);
+  for (int i = 0; i < vertices; ++i) {
+    mesh->createVertex(Eigen::Vector2d(i, 0.0));
+  }
+  mesh->allocateDataValues();
+  return mesh;
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Consistent)
+{
+  PRECICE_TEST(1_rank);
+  mesh::PtrMesh inMesh  = createMesh("In", 3);
+  mesh::PtrMesh outMesh = createMesh("Out", 2);
+  inMesh->data()[0]->values() << 1.0, 2.0, 3.0;
+  inMesh->data()[1]->values() << 1.0, 10.0, 2.0, 20.0, 3.0, 30.0;
+  outMesh->data()[0]->values().setConstant(100.0);
+  outMesh->data()[1]->values().setConstant(100.0);
+
+  // A row per output vertex, the output is overwritten
+  OperatorMapping mapping(Mapping::CONSISTENT, {{0, 0, 0.25}, {0, 1, 0.75}, {1, 2, 1.0}}, 2, 3);
+  mapping.setMeshes(inMesh, outMesh);
+  const std::vector<Mapping::DataIDPair> dataIDs{{inMesh->data()[0]->getID(), outMesh->data()[0]->getID()},
+                                                 {inMesh->data()[1]->getID(), outMesh->data()[1]->getID()}};
+  mapping.map(dataIDs);
+
+  Eigen::VectorXd expectedScalar(2);
+  expectedScalar << 1.75, 3.0;
+  BOOST_TEST(testing::equals(outMesh->data()[0]->values(), expectedScalar));
+  Eigen::VectorXd expectedVector(4);
+  expectedVector << 1.75, 17.5, 3.0, 30.0;
+  BOOST_TEST(testing::equals(outMesh->data()[1]->values(), expectedVector));
+}
+
+BOOST_AUTO_TEST_CASE(Conservative)
+{
+  PRECICE_TEST(1_rank);
+  mesh::PtrMesh inMesh  = createMesh("In", 3);
+  mesh::PtrMesh outMesh = createMesh("Out", 2);
+  inMesh->data()[0]->values() << 1.0, 2.0, 4.0;
+  inMesh->data()[1]->values() << 1.0, 10.0, 2.0, 20.0, 4.0, 40.0;
+  outMesh->data()[0]->values().setConstant(1.0);
+  outMesh->data()[1]->values().setConstant(1.0);
+
+  // A row per input vertex, the transposed operator is added to the output
+  OperatorMapping mapping(Mapping::CONSERVATIVE, {{0, 0, 1.0}, {1, 0, 0.5}, {1, 1, 0.5}, {2, 1, 1.0}}, 3, 2);
+  mapping.setMeshes(inMesh, outMesh);
+  mapping.map(inMesh->data()[0]->getID(), outMesh->data()[0]->getID());
+  mapping.map(inMesh->data()[1]->getID(), outMesh->data()[1]->getID());
+
+  Eigen::VectorXd expectedScalar(2);
+  expectedScalar << 3.0, 6.0;
+  BOOST_TEST(testing::equals(outMesh->data()[0]->values(), expectedScalar));
+  Eigen::VectorXd expectedVector(4);
+  expectedVector << 3.0, 21.0, 6.0, 51.0;
+  BOOST_TEST(testing::equals(outMesh->data()[1]->values(), expectedVector));
+}
+
+BOOST_AUTO_TEST_SUITE_END() // SparseOperator
+BOOST_AUTO_TEST_SUITE_END() // MappingTests
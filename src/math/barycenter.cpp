@@ -1,6 +1,7 @@
 #include "math/barycenter.hpp"
 #include <Eigen/Core>
 #include <Eigen/Geometry>
+#include <limits>
 #include <utility>
 #include "math/differences.hpp"
 #include "math/geometry.hpp"
@@ -194,6 +195,81 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
   return {barycentricCoords, projected};
 }
 
+namespace {
+/// Squared length of an edge relative to the distance of the location, below which the edge is considered degenerated
+constexpr double DEGENERATED_EDGE = 1e-14;
+
+/// Squared sine of the angle at the first corner, below which the system of a triangle is considered ill-conditioned
+constexpr double ILL_CONDITIONED_TRIANGLE = 1e-6;
+} // namespace
+
+void calcBarycentricCoordsForEdges(
+    const BatchedCorners &                               a,
+    const BatchedCorners &                               b,
+    const Eigen::Vector3d &                              location,
+    Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, 2>> barycentricCoords)
+{
+  PRECICE_ASSERT(a.rows() == b.rows() && a.rows() == barycentricCoords.rows(), a.rows(), b.rows(), barycentricCoords.rows());
+  using Eigen::ArrayXd;
+
+  // Each operation processes all edges, the arrays of a coordinate are contiguous
+  const ArrayXd abX = b.col(0).array() - a.col(0).array();
+  const ArrayXd abY = b.col(1).array() - a.col(1).array();
+  const ArrayXd abZ = b.col(2).array() - a.col(2).array();
+  const ArrayXd apX = location[0] - a.col(0).array();
+  const ArrayXd apY = location[1] - a.col(1).array();
+  const ArrayXd apZ = location[2] - a.col(2).array();
+
+  const ArrayXd length2 = abX * abX + abY * abY + abZ * abZ;
+  const ArrayXd s       = (apX * abX + apY * abY + apZ * abZ) / length2;
+
+  const double nan         = std::numeric_limits<double>::quiet_NaN();
+  const auto   degenerated = length2 <= DEGENERATED_EDGE * (apX * apX + apY * apY + apZ * apZ).max(length2);
+
+  barycentricCoords.col(1) = degenerated.select(nan, s).matrix();
+  barycentricCoords.col(0) = 1.0 - barycentricCoords.col(1).array();
+}
+
+void calcBarycentricCoordsForTriangles(
+    const BatchedCorners &     a,
+    const BatchedCorners &     b,
+    const BatchedCorners &     c,
+    const Eigen::Vector3d &    location,
+    Eigen::Ref<BatchedCorners> barycentricCoords)
+{
+  PRECICE_ASSERT(a.rows() == b.rows() && a.rows() == c.rows() && a.rows() == barycentricCoords.rows(), a.rows(), b.rows(), c.rows(), barycentricCoords.rows());
+  using Eigen::ArrayXd;
+
+  // Solve the normal equations of location - a = v * (b - a) + w * (c - a) in the plane of each triangle.
+  // Each operation processes all triangles, the arrays of a coordinate are contiguous.
+  const ArrayXd abX = b.col(0).array() - a.col(0).array();
+  const ArrayXd abY = b.col(1).array() - a.col(1).array();
+  const ArrayXd abZ = b.col(2).array() - a.col(2).array();
+  const ArrayXd acX = c.col(0).array() - a.col(0).array();
+  const ArrayXd acY = c.col(1).array() - a.col(1).array();
+  const ArrayXd acZ = c.col(2).array() - a.col(2).array();
+  const ArrayXd apX = location[0] - a.col(0).array();
+  const ArrayXd apY = location[1] - a.col(1).array();
+  const ArrayXd apZ = location[2] - a.col(2).array();
+
+  const ArrayXd d00 = abX * abX + abY * abY + abZ * abZ;
+  const ArrayXd d01 = abX * acX + abY * acY + abZ * acZ;
+  const ArrayXd d11 = acX * acX + acY * acY + acZ * acZ;
+  const ArrayXd d20 = apX * abX + apY * abY + apZ * abZ;
+  const ArrayXd d21 = apX * acX + apY * acY + apZ * acZ;
+
+  const ArrayXd denominator = d00 * d11 - d01 * d01;
+  const ArrayXd v           = (d11 * d20 - d01 * d21) / denominator;
+  const ArrayXd w           = (d00 * d21 - d01 * d20) / denominator;
+
+  const double nan         = std::numeric_limits<double>::quiet_NaN();
+  const auto   degenerated = denominator <= ILL_CONDITIONED_TRIANGLE * d00 * d11;
+
+  barycentricCoords.col(1) = degenerated.select(nan, v).matrix();
+  barycentricCoords.col(2) = degenerated.select(nan, w).matrix();
+  barycentricCoords.col(0) = 1.0 - barycentricCoords.col(1).array() - barycentricCoords.col(2).array();
+}
+
 } // namespace barycenter
 } // namespace math
 } // namespace precice
@@ -53,6 +53,46 @@ BarycentricCoordsAndProjected calcBarycentricCoordsForTriangle(
     const Eigen::VectorXd &normal,
     const Eigen::VectorXd &location);
 
+/**
+ * @brief Corners of several primitives, with one primitive per row.
+ *
+ * Each coordinate of the corners is contiguous, such that the batched kernels
+ * process as many primitives at once as fit into a SIMD register.
+ */
+using BatchedCorners = Eigen::Matrix<double, Eigen::Dynamic, 3>;
+
+/** Calculates the barycentric coordinates of the orthogonal projections of a location onto several edges at once.
+ *
+ *  Unused coordinates of 2D corners have to be zero. For 2D edges, the coordinates equal the ones of calcBarycentricCoordsForEdge.
+ *  Coordinates of degenerated edges are NaN.
+ *
+ *  @param a, b the corners of the edges, one edge per row
+ *  @param location the location to compute the barycentric coordinates for
+ *  @param barycentricCoords the coordinates of corner A and B, one edge per row
+ */
+void calcBarycentricCoordsForEdges(
+    const BatchedCorners &                               a,
+    const BatchedCorners &                               b,
+    const Eigen::Vector3d &                              location,
+    Eigen::Ref<Eigen::Matrix<double, Eigen::Dynamic, 2>> barycentricCoords);
+
+/** Calculates the barycentric coordinates of the projections of a location onto several triangles at once.
+ *
+ *  The coordinates equal the ones of calcBarycentricCoordsForTriangle, as the projection onto the plane of a triangle
+ *  does not change the barycentric coordinates. Coordinates of nearly degenerated triangles are NaN, as they
+ *  would be too inaccurate.
+ *
+ *  @param a, b, c the corners of the triangles, one triangle per row
+ *  @param location the location to compute the barycentric coordinates for
+ *  @param barycentricCoords the coordinates of corner A, B and C, one triangle per row
+ */
+void calcBarycentricCoordsForTriangles(
+    const BatchedCorners &     a,
+    const BatchedCorners &     b,
+    const BatchedCorners &     c,
+    const Eigen::Vector3d &    location,
+    Eigen::Ref<BatchedCorners> barycentricCoords);
+
 } // namespace barycenter
 } // namespace math
 } // namespace precice
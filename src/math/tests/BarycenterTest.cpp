@@ -183,6 +183,76 @@ BOOST_AUTO_TEST_CASE(BarycenterTriangle)
   }
 }
 
+BOOST_AUTO_TEST_CASE(BarycenterTrianglesBatched)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector3d;
+  using precice::testing::equals;
+  const int      size = 5;
+  BatchedCorners a(size, 3), b(size, 3), c(size, 3);
+  a << 0.0, 0.0, 0.0,
+      1.0, -1.0, 0.5,
+      -0.5, 0.2, 1.0,
+      0.3, 0.3, -0.7,
+      0.0, 0.0, 0.0;
+  b << 1.0, 0.0, 0.0,
+      -0.2, 0.8, 0.1,
+      0.6, -0.9, 0.4,
+      -0.8, 0.1, 0.2,
+      1.0, 1.0, 1.0;
+  c << 0.0, 1.0, 0.0,
+      0.4, 0.3, -0.9,
+      0.1, 0.7, -0.6,
+      0.5, -0.6, 0.9,
+      0.5, 0.5, 0.5;
+  // The last triangle is degenerated
+
+  const Vector3d location(0.2, -0.3, 0.4);
+  BatchedCorners coords(size, 3);
+  calcBarycentricCoordsForTriangles(a, b, c, location, coords);
+
+  for (int i = 0; i < size - 1; ++i) {
+    const Vector3d ab     = b.row(i) - a.row(i);
+    const Vector3d ac     = c.row(i) - a.row(i);
+    const Vector3d normal = ab.cross(ac).normalized();
+    auto           ret    = calcBarycentricCoordsForTriangle(a.row(i).transpose(), b.row(i).transpose(), c.row(i).transpose(), normal, location);
+    BOOST_TEST(equals(coords.row(i).transpose(), ret.barycentricCoords, 1e-10));
+  }
+  BOOST_TEST(coords.row(size - 1).hasNaN());
+}
+
+BOOST_AUTO_TEST_CASE(BarycenterEdgesBatched)
+{
+  PRECICE_TEST(1_rank);
+  using Eigen::Vector2d;
+  using Eigen::Vector3d;
+  using precice::testing::equals;
+  const int      size = 4;
+  BatchedCorners a(size, 3), b(size, 3);
+  a << 0.0, 0.0, 0.0,
+      1.0, -1.0, 0.0,
+      -0.5, 0.2, 0.0,
+      0.3, 0.3, 0.0;
+  b << 1.0, 0.0, 0.0,
+      -0.2, 0.8, 0.0,
+      0.6, -0.9, 0.0,
+      0.3, 0.3, 0.0;
+  // The last edge is degenerated
+
+  const Vector3d                           location(0.2, -0.3, 0.0);
+  Eigen::Matrix<double, Eigen::Dynamic, 2> coords(size, 2);
+  calcBarycentricCoordsForEdges(a, b, location, coords);
+
+  for (int i = 0; i < size - 1; ++i) {
+    const Vector2d edgeA  = a.row(i).head<2>();
+    const Vector2d edgeB  = b.row(i).head<2>();
+    const Vector2d normal = Vector2d(edgeA[1] - edgeB[1], edgeB[0] - edgeA[0]).normalized();
+    auto           ret    = calcBarycentricCoordsForEdge(edgeA, edgeB, normal, location.head<2>());
+    BOOST_TEST(equals(coords.row(i).transpose(), ret.barycentricCoords, 1e-10));
+  }
+  BOOST_TEST(coords.row(size - 1).hasNaN());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Barycenter
 
 BOOST_AUTO_TEST_SUITE_END() // Math
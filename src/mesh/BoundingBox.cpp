@@ -64,6 +64,20 @@ bool BoundingBox::contains(const mesh::Vertex &vertex) const
   return true;
 }
 
+bool BoundingBox::contains(const BoundingBox &otherBB) const
+{
+  PRECICE_ASSERT(_dimensions == otherBB._dimensions, "Bounding boxes with different dimensions cannot be checked.");
+  if (otherBB.empty()) {
+    return true;
+  }
+  for (int d = 0; d < _dimensions; d++) {
+    if (otherBB._bounds[2 * d] < _bounds[2 * d] || otherBB._bounds[2 * d + 1] > _bounds[2 * d + 1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
 Eigen::VectorXd BoundingBox::center() const
 {
   PRECICE_ASSERT(!empty(), "Data of the bounding box is at default state.");
@@ -62,6 +62,9 @@ public:
   /// Checks if vertex in contained in _bb
   bool contains(const Vertex &vertex) const;
 
+  /// Checks if otherBB is contained in _bb, an empty otherBB is always contained
+  bool contains(const BoundingBox &otherBB) const;
+
   /// Checks whether two bounding boxes are overlapping
   bool overlapping(const BoundingBox &otherBB);
 
@@ -2,6 +2,7 @@
 #include <algorithm>
 #include <array>
 #include <boost/container/flat_map.hpp>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <ostream>
@@ -34,7 +35,7 @@ Mesh::Mesh(
   PRECICE_ASSERT((_dimensions == 2) || (_dimensions == 3), _dimensions);
   PRECICE_ASSERT(_name != std::string(""));
 
-  meshChanged.connect([](Mesh &m) { query::clearCache(m); });
+  meshChanged.connect([](Mesh &m) { query::updateCache(m); });
   meshDestroyed.connect([](Mesh &m) { query::clearCache(m); });
 }
 
@@ -82,6 +83,10 @@ Vertex &Mesh::createVertex(const Eigen::VectorXd &coords)
 {
   PRECICE_ASSERT(coords.size() == _dimensions, coords.size(), _dimensions);
   auto nextID = _vertices.size();
+  PRECICE_CHECK(nextID <= static_cast<std::size_t>(Vertex::MAX_ID),
+                "The mesh \"{}\" cannot hold more than {} vertices per rank. "
+                "Please use more ranks for this mesh.",
+                _name, Vertex::MAX_ID + 1);
   _vertices.emplace_back(coords, nextID);
   return _vertices.back();
 }
@@ -95,22 +100,36 @@ Edge &Mesh::createEdge(
   return _edges.back();
 }
 
+namespace {
+
+/// Returns the key of an edge in Mesh::_uniqueEdges
+std::uint64_t edgeKey(VertexID a, VertexID b)
+{
+  const auto ids = std::minmax(a, b);
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ids.first)) << 32) | static_cast<std::uint32_t>(ids.second);
+}
+
+} // namespace
+
 Edge &Mesh::createUniqueEdge(
     Vertex &vertexOne,
     Vertex &vertexTwo)
 {
-  const std::array<VertexID, 2> vids{vertexOne.getID(), vertexTwo.getID()};
-  const auto                    eend = edges().end();
-  auto                          pos  = std::find_if(edges().begin(), eend,
-                          [&vids](const Edge &e) -> bool {
-                            const std::array<VertexID, 2> eids{e.vertex(0).getID(), e.vertex(1).getID()};
-                            return std::is_permutation(vids.begin(), vids.end(), eids.begin());
-                          });
-  if (pos != eend) {
-    return *pos;
-  } else {
-    return createEdge(vertexOne, vertexTwo);
+  // Keeps the first of repeated edges, as a linear search would
+  for (; _uniqueEdgesSize < _edges.size(); ++_uniqueEdgesSize) {
+    const Edge &edge = _edges[_uniqueEdgesSize];
+    _uniqueEdges.emplace(edgeKey(edge.vertex(0).getID(), edge.vertex(1).getID()), edge.getID());
+  }
+
+  const auto key      = edgeKey(vertexOne.getID(), vertexTwo.getID());
+  const auto existing = _uniqueEdges.find(key);
+  if (existing != _uniqueEdges.end()) {
+    return _edges[existing->second];
   }
+  Edge &edge = createEdge(vertexOne, vertexTwo);
+  _uniqueEdges.emplace(key, edge.getID());
+  ++_uniqueEdgesSize;
+  return edge;
 }
 
 Triangle &Mesh::createTriangle(
@@ -238,11 +257,25 @@ void Mesh::computeBoundingBox()
   PRECICE_DEBUG("Bounding Box, {}", _boundingBox);
 }
 
+Mesh::MemoryUsage Mesh::memoryUsage() const
+{
+  MemoryUsage usage;
+  usage.vertices  = _vertices.size() * sizeof(Vertex);
+  usage.edges     = _edges.size() * sizeof(Edge) + _uniqueEdges.size() * sizeof(decltype(_uniqueEdges)::value_type);
+  usage.triangles = _triangles.size() * sizeof(Triangle);
+  for (const PtrData &data : _data) {
+    usage.data += data->values().size() * sizeof(double);
+  }
+  return usage;
+}
+
 void Mesh::clear()
 {
   _triangles.clear();
   _edges.clear();
   _vertices.clear();
+  _uniqueEdges.clear();
+  _uniqueEdgesSize = 0;
 
   meshChanged(*this);
 
@@ -2,11 +2,14 @@
 
 #include <Eigen/Core>
 #include <boost/signals2.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "logging/Logger.hpp"
@@ -24,6 +27,16 @@
 namespace precice {
 namespace mesh {
 
+/// Data structures available to index the vertices of a mesh, see query::Index
+enum class IndexBackend {
+  /// R*-tree of boost.geometry, which is also used for edges and triangles
+  RTree,
+  /// Balanced kd-tree over contiguous coordinates
+  KDTree,
+  /// Uniform grid of cells over contiguous coordinates
+  Grid
+};
+
 /**
  * @brief Container and creator for meshes.
  *
@@ -49,7 +62,20 @@ public:
   /// A mapping from remote local ranks to the IDs that must be communicated
   using CommunicationMap = std::map<Rank, std::vector<VertexID>>;
 
-  /// Signal is emitted when the mesh is changed
+  /// Bytes allocated for the vertices, edges, triangles, and data values of a mesh
+  struct MemoryUsage {
+    std::size_t vertices  = 0;
+    std::size_t edges     = 0;
+    std::size_t triangles = 0;
+    std::size_t data      = 0;
+
+    std::size_t total() const
+    {
+      return vertices + edges + triangles + data;
+    }
+  };
+
+  /// Signal is emitted when the mesh is changed, which is required to update the spatial indices after moving vertices
   boost::signals2::signal<void(Mesh &)> meshChanged;
 
   /// Signal is emitted when the mesh is destroyed
@@ -93,6 +119,9 @@ public:
 
   int getDimensions() const;
 
+  /// Returns the memory allocated by the mesh, the containers are approximated by their elements
+  MemoryUsage memoryUsage() const;
+
   /// Creates and initializes a Vertex object.
   Vertex &createVertex(const Eigen::VectorXd &coords);
 
@@ -109,6 +138,9 @@ public:
   /**
    * @brief Creates and initializes an Edge object or returns an already existing one.
    *
+   * Existing edges are looked up in a hash map keyed by the sorted vertex IDs, which is
+   * built on the first call and extended by the edges created since.
+   *
    * @param[in] vertexOne Reference to first Vertex defining the Edge.
    * @param[in] vertexTwo Reference to second Vertex defining the Edge.
    */
@@ -152,6 +184,41 @@ public:
   /// Returns the base ID of the mesh.
   MeshID getID() const;
 
+  /// Returns the data structure which indexes the vertices in spatial queries
+  IndexBackend getIndexBackend() const
+  {
+    return _indexBackend;
+  }
+
+  /// Selects the data structure which indexes the vertices, see query::setIndexBackend()
+  void setIndexBackend(IndexBackend backend)
+  {
+    _indexBackend = backend;
+  }
+
+  /// Returns true if the vertices may be moved after the initialization, see SolverInterface::setMeshVertexCoordinates()
+  bool isMoving() const
+  {
+    return _isMoving;
+  }
+
+  void setMoving(bool moving)
+  {
+    _isMoving = moving;
+  }
+
+  /// Returns how often the vertices were moved or received moved after the initialization, which is equal on all ranks
+  int getMoveCount() const
+  {
+    return _moveCount;
+  }
+
+  /// Counts a movement of the vertices after the initialization, has to be called by all ranks together
+  void countMove()
+  {
+    ++_moveCount;
+  }
+
   /// Returns true if the given vertexID is valid
   bool isValidVertexID(VertexID vertexID) const;
 
@@ -238,7 +305,16 @@ private:
   /// The ID of this mesh.
   MeshID _id;
 
-  /// Holds vertices, edges, and triangles.
+  /// Index of the vertices in spatial queries
+  IndexBackend _indexBackend = IndexBackend::RTree;
+
+  /// Whether the vertices may be moved after the initialization
+  bool _isMoving = false;
+
+  /// Number of movements of the vertices after the initialization
+  int _moveCount = 0;
+
+  /// Holds vertices, edges, and triangles. The deques keep the references of edges and triangles valid while the mesh grows.
   VertexContainer   _vertices;
   EdgeContainer     _edges;
   TriangleContainer _triangles;
@@ -280,6 +356,12 @@ private:
   CommunicationMap _communicationMap;
 
   BoundingBox _boundingBox;
+
+  /// The edges by their sorted vertex IDs, used by createUniqueEdge
+  std::unordered_map<std::uint64_t, EdgeID> _uniqueEdges;
+
+  /// The number of edges in _uniqueEdges, later edges are added on demand
+  std::size_t _uniqueEdgesSize = 0;
 };
 
 std::ostream &operator<<(std::ostream &os, const Mesh &q);
@@ -1,11 +1,35 @@
 #include <Eigen/Core>
+#include <algorithm>
+#include <vector>
 #include <mesh/Edge.hpp>
 #include <mesh/Mesh.hpp>
+#include <mesh/Utils.hpp>
 #include <utils/MasterSlave.hpp>
 
 namespace precice {
 namespace mesh {
 
+std::vector<double> packedCoordinates(const Mesh &mesh)
+{
+  const int           dimensions = mesh.getDimensions();
+  std::vector<double> coords(mesh.vertices().size() * dimensions);
+  auto                out = coords.begin();
+  for (const Vertex &vertex : mesh.vertices()) {
+    out = std::copy_n(vertex.rawCoords().begin(), dimensions, out);
+  }
+  return coords;
+}
+
+void addToFingerprint(utils::Fingerprint &fingerprint, const Mesh &mesh)
+{
+  fingerprint.add(mesh.getDimensions());
+  fingerprint.add(mesh.vertices().size());
+  for (const Vertex &vertex : mesh.vertices()) {
+    const auto coords = vertex.rawCoords();
+    fingerprint.add(coords.data(), coords.size() * sizeof(double));
+  }
+}
+
 /// Given the data and the mesh, this function returns the surface integral. Assumes no overlap exists for the mesh
 Eigen::VectorXd integrate(const PtrMesh &mesh, const PtrData &data)
 {
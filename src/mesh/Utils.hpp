@@ -5,6 +5,8 @@
 #include <mesh/Edge.hpp>
 #include <mesh/Mesh.hpp>
 #include <utility>
+#include <utils/Fingerprint.hpp>
+#include <vector>
 
 namespace precice {
 namespace mesh {
@@ -132,6 +134,17 @@ std::array<Eigen::VectorXd, n> coordsFor(const std::array<Vertex *, n> &vertexPt
   return coords;
 }
 
+/**
+ * @brief Returns the coordinates of all vertices, packed with as many entries per vertex as the mesh has dimensions
+ *
+ * The vertices store their own coordinates, thus every call gathers them. Callers needing them
+ * several times should keep the result.
+ */
+std::vector<double> packedCoordinates(const Mesh &mesh);
+
+/// Adds the dimensions, the number of vertices, and the coordinates of all vertices to the fingerprint
+void addToFingerprint(utils::Fingerprint &fingerprint, const Mesh &mesh);
+
 /// Given the data and the mesh, this function returns the surface integral. Assumes no overlap exists for the mesh
 Eigen::VectorXd integrate(const PtrMesh &mesh, const PtrData &data);
 
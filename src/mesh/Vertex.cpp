@@ -5,9 +5,11 @@
 namespace precice {
 namespace mesh {
 
+constexpr VertexID Vertex::MAX_ID;
+
 int Vertex::getDimensions() const
 {
-  return _dim;
+  return _threeDimensional ? 3 : 2;
 }
 
 int Vertex::getGlobalIndex() const
@@ -22,22 +24,22 @@ void Vertex::setGlobalIndex(int globalIndex)
 
 bool Vertex::isOwner() const
 {
-  return _owner;
+  return _owner != 0;
 }
 
 void Vertex::setOwner(bool owner)
 {
-  _owner = owner;
+  _owner = owner ? 1 : 0;
 }
 
 bool Vertex::isTagged() const
 {
-  return _tagged;
+  return _tagged != 0;
 }
 
 void Vertex::tag()
 {
-  _tagged = true;
+  _tagged = 1;
 }
 
 std::ostream &operator<<(std::ostream &os, Vertex const &v)
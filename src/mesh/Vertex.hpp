@@ -18,6 +18,9 @@ public:
   //( Used as the raw representation of the coordinates
   using RawCoords = std::array<double, 3>;
 
+  /// Largest ID of a vertex, the ID shares its word with the flags of the vertex. Vertices outside of meshes may use negative IDs.
+  static constexpr VertexID MAX_ID = (1 << 28) - 1;
+
   /// Constructor for vertex
   template <typename VECTOR_T>
   Vertex(
@@ -58,23 +61,23 @@ public:
   inline bool operator!=(const Vertex &rhs) const;
 
 private:
-  /// Coordinates of the vertex
+  /// Coordinates of the vertex, the third one is zero in 2D
   std::array<double, 3> _coords;
 
-  /// Dimension of the coordinates. 3D or 2D
-  short _dim;
-
   /// Unique (among vertices in one mesh) ID of the vertex.
-  VertexID _id;
+  VertexID _id : 29;
 
-  /// global (unique) index for parallel simulations
-  int _globalIndex = -1;
+  /// true if the vertex has three coordinates, the dimension of all vertices of a mesh is the same
+  unsigned int _threeDimensional : 1;
 
   /// true if this processors is the owner of the vertex (for parallel simulations)
-  bool _owner = true;
+  unsigned int _owner : 1;
 
   /// true if this vertex is tagged for partition
-  bool _tagged = false;
+  unsigned int _tagged : 1;
+
+  /// global (unique) index for parallel simulations
+  int _globalIndex = -1;
 };
 
 // ------------------------------------------------------ HEADER IMPLEMENTATION
@@ -83,23 +86,26 @@ template <typename VECTOR_T>
 Vertex::Vertex(
     const VECTOR_T &coordinates,
     int             id)
-    : _dim(coordinates.size()),
-      _id(id)
+    : _id(id),
+      _threeDimensional(coordinates.size() == 3),
+      _owner(true),
+      _tagged(false)
 {
-  PRECICE_ASSERT(_dim == 2 || _dim == 3, _dim);
+  PRECICE_ASSERT(coordinates.size() == 2 || coordinates.size() == 3, coordinates.size());
+  PRECICE_ASSERT(id >= -MAX_ID - 1 && id <= MAX_ID, id);
   _coords[0] = coordinates[0];
   _coords[1] = coordinates[1];
-  _coords[2] = (_dim == 3) ? coordinates[2] : 0.0;
+  _coords[2] = _threeDimensional ? coordinates[2] : 0.0;
 }
 
 template <typename VECTOR_T>
 void Vertex::setCoords(
     const VECTOR_T &coordinates)
 {
-  PRECICE_ASSERT(coordinates.size() == _dim, coordinates.size(), _dim);
+  PRECICE_ASSERT(coordinates.size() == getDimensions(), coordinates.size(), getDimensions());
   _coords[0] = coordinates[0];
   _coords[1] = coordinates[1];
-  _coords[2] = (_dim == 3) ? coordinates[2] : 0.0;
+  _coords[2] = _threeDimensional ? coordinates[2] : 0.0;
 }
 
 inline VertexID Vertex::getID() const
@@ -109,8 +115,9 @@ inline VertexID Vertex::getID() const
 
 inline Eigen::VectorXd Vertex::getCoords() const
 {
-  Eigen::VectorXd v(_dim);
-  std::copy_n(_coords.data(), _dim, v.data());
+  const int       dim = getDimensions();
+  Eigen::VectorXd v(dim);
+  std::copy_n(_coords.data(), dim, v.data());
   return v;
 }
 
@@ -23,6 +23,8 @@ MeshConfiguration::MeshConfiguration(
     : TAG("mesh"),
       ATTR_NAME("name"),
       ATTR_FLIP_NORMALS("flip-normals"),
+      ATTR_SPATIAL_INDEX("spatial-index"),
+      ATTR_MOVING("moving"),
       TAG_DATA("use-data"),
       ATTR_SIDE_INDEX("side"),
       _dimensions(0),
@@ -47,6 +49,20 @@ MeshConfiguration::MeshConfiguration(
   auto attrFlipNormals = makeXMLAttribute(ATTR_FLIP_NORMALS, false).setDocumentation("Deprectated.");
   tag.addAttribute(attrFlipNormals);
 
+  auto attrSpatialIndex = makeXMLAttribute(ATTR_SPATIAL_INDEX, "rtree")
+                              .setOptions({"rtree", "kd-tree", "grid"})
+                              .setDocumentation("Data structure used to find vertices of this mesh, e.g., for nearest-neighbor and RBF mappings. "
+                                                "\"kd-tree\" and \"grid\" are cheaper to build and query than \"rtree\" for large meshes, "
+                                                "\"grid\" is best suited for evenly spaced vertices. Edges and triangles are always indexed by R-trees.");
+  tag.addAttribute(attrSpatialIndex);
+
+  auto attrMoving = makeXMLAttribute(ATTR_MOVING, false)
+                        .setDocumentation("Allows the providing participant to move the vertices of this mesh with setMeshVertexCoordinates() after initialize(). "
+                                          "The coordinates are sent along with the next data set on this mesh, which the providing participant sends after moving the vertices. "
+                                          "Received meshes mapped from or to this mesh keep all vertices within the bounding box of this mesh enlarged by the safety-factor, which the vertices must not leave. "
+                                          "Received copies of this mesh are not filtered, which rules out the two-level initialization for them.");
+  tag.addAttribute(attrMoving);
+
   XMLTag subtagData(*this, TAG_DATA, XMLTag::OCCUR_ARBITRARY);
   doc = "Assigns a before defined data set (see tag <data>) to the mesh.";
   subtagData.setDocumentation(doc);
@@ -81,6 +97,14 @@ void MeshConfiguration::xmlTagCallback(
     }
     PRECICE_ASSERT(_meshIdManager);
     _meshes.push_back(std::make_shared<Mesh>(name, _dimensions, _meshIdManager->getFreeID()));
+
+    const std::string spatialIndex = tag.getStringAttributeValue(ATTR_SPATIAL_INDEX);
+    if (spatialIndex == "kd-tree") {
+      _meshes.back()->setIndexBackend(IndexBackend::KDTree);
+    } else if (spatialIndex == "grid") {
+      _meshes.back()->setIndexBackend(IndexBackend::Grid);
+    }
+    _meshes.back()->setMoving(tag.getBooleanAttributeValue(ATTR_MOVING));
   } else if (tag.getName() == TAG_DATA) {
     std::string name  = tag.getStringAttributeValue(ATTR_NAME);
     bool        found = false;
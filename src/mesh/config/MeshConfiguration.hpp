@@ -73,6 +73,8 @@ private:
   const std::string TAG;
   const std::string ATTR_NAME;
   const std::string ATTR_FLIP_NORMALS;
+  const std::string ATTR_SPATIAL_INDEX;
+  const std::string ATTR_MOVING;
   const std::string TAG_DATA;
   const std::string ATTR_SIDE_INDEX;
 
@@ -309,6 +309,25 @@ BOOST_AUTO_TEST_CASE(Contains)
   }
 } // Contains
 
+BOOST_AUTO_TEST_CASE(ContainsBoundingBox)
+{
+  PRECICE_TEST(1_rank);
+  BoundingBox bb({0.0, 1.0,
+                  -1.0, 3.0});
+  BoundingBox inside({0.2, 1.0,
+                      -1.0, 2.0});
+  BoundingBox overlapping({0.5, 1.5,
+                           0.0, 2.0});
+  BoundingBox empty(2);
+
+  BOOST_TEST(bb.contains(bb));
+  BOOST_TEST(bb.contains(inside));
+  BOOST_TEST(!inside.contains(bb));
+  BOOST_TEST(!bb.contains(overlapping));
+  BOOST_TEST(bb.contains(empty));
+  BOOST_TEST(!empty.contains(bb));
+} // ContainsBoundingBox
+
 BOOST_AUTO_TEST_CASE(EmptyCase)
 {
   PRECICE_TEST(1_rank);
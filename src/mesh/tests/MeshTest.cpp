@@ -285,6 +285,58 @@ BOOST_AUTO_TEST_CASE(CreateUniqueEdge)
   BOOST_TEST(mesh.edges().size() == 3);
 }
 
+BOOST_AUTO_TEST_CASE(CreateUniqueEdgeMixed)
+{
+  PRECICE_TEST(1_rank);
+  Mesh    mesh("Mesh", 3, testing::nextMeshID());
+  Vertex &v0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  Vertex &v1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  Vertex &v2 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.0));
+
+  Edge &e01 = mesh.createUniqueEdge(v0, v1);
+  Edge &e12 = mesh.createEdge(v1, v2);
+  BOOST_TEST(mesh.edges().size() == 2);
+
+  // Edges created in between and reversed edges are found as well
+  BOOST_TEST(mesh.createUniqueEdge(v2, v1) == e12);
+  BOOST_TEST(mesh.createUniqueEdge(v1, v0) == e01);
+  BOOST_TEST(mesh.edges().size() == 2);
+
+  mesh.createUniqueEdge(v2, v0);
+  BOOST_TEST(mesh.edges().size() == 3);
+
+  mesh.clear();
+  Vertex &w0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  Vertex &w1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  mesh.createUniqueEdge(w0, w1);
+  mesh.createUniqueEdge(w1, w0);
+  BOOST_TEST(mesh.edges().size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(MemoryUsage)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh2D("Mesh2D", 2, testing::nextMeshID());
+  Mesh mesh3D("Mesh3D", 3, testing::nextMeshID());
+  BOOST_TEST(mesh2D.memoryUsage().total() == 0);
+
+  for (int i = 0; i < 10; ++i) {
+    mesh2D.createVertex(Eigen::Vector2d(i, 0.0));
+    mesh3D.createVertex(Eigen::Vector3d(i, 0.0, 0.0));
+  }
+  mesh2D.createEdge(mesh2D.vertices()[0], mesh2D.vertices()[1]);
+  mesh2D.createData("Data", 2);
+  mesh2D.allocateDataValues();
+
+  const auto usage = mesh2D.memoryUsage();
+  BOOST_TEST(usage.vertices == 10 * sizeof(Vertex));
+  BOOST_TEST(mesh3D.memoryUsage().vertices == 10 * sizeof(Vertex));
+  BOOST_TEST(usage.edges >= sizeof(Edge));
+  BOOST_TEST(usage.triangles == 0);
+  BOOST_TEST(usage.data == 20 * sizeof(double));
+  BOOST_TEST(usage.total() == usage.vertices + usage.edges + usage.data);
+}
+
 BOOST_AUTO_TEST_CASE(ResizeDataGrow)
 {
   PRECICE_TEST(1_rank);
@@ -516,6 +568,42 @@ BOOST_AUTO_TEST_CASE(CoordsForPtrs)
   BOOST_TEST(result == expected);
 }
 
+BOOST_AUTO_TEST_CASE(PackedCoordinates)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("Mesh", 2, testing::nextMeshID());
+  BOOST_TEST(packedCoordinates(mesh).empty());
+
+  mesh.createVertex(Eigen::Vector2d(1.0, 2.0));
+  mesh.createVertex(Eigen::Vector2d(3.0, 4.0));
+  const std::vector<double> expected{1.0, 2.0, 3.0, 4.0};
+  BOOST_TEST(packedCoordinates(mesh) == expected, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(AddToFingerprint)
+{
+  PRECICE_TEST(1_rank);
+  Mesh mesh("Mesh", 2, testing::nextMeshID());
+  mesh.createVertex(Eigen::Vector2d(0.0, 0.0));
+  auto &vertex = mesh.createVertex(Eigen::Vector2d(1.0, 0.0));
+
+  utils::Fingerprint original;
+  addToFingerprint(original, mesh);
+  utils::Fingerprint same;
+  addToFingerprint(same, mesh);
+  BOOST_TEST(original.value() == same.value());
+
+  vertex.setCoords(Eigen::Vector2d(1.0, 1e-12));
+  utils::Fingerprint moved;
+  addToFingerprint(moved, mesh);
+  BOOST_TEST(original.value() != moved.value());
+
+  utils::Fingerprint parameter;
+  addToFingerprint(parameter, mesh);
+  parameter.add(0.5);
+  BOOST_TEST(moved.value() != parameter.value());
+}
+
 BOOST_AUTO_TEST_CASE(Integrate2DScalarData)
 {
   PRECICE_TEST(1_rank);
@@ -52,5 +52,50 @@ BOOST_AUTO_TEST_CASE(VertexWKTPrint)
   BOOST_TEST(v2str == v2stream.str());
 }
 
+BOOST_AUTO_TEST_CASE(VertexCopy)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  Vertex v1(Eigen::Vector2d(1., 2.), 3);
+  v1.setGlobalIndex(5);
+  v1.setOwner(false);
+  v1.tag();
+
+  // Copies hold their own data
+  Vertex v2(v1);
+  v1.setCoords(Eigen::Vector2d(3., 4.));
+  v1.setGlobalIndex(6);
+  BOOST_TEST(v2.getID() == 3);
+  BOOST_TEST(v2.getDimensions() == 2);
+  BOOST_TEST(testing::equals(v2.getCoords(), Eigen::Vector2d(1., 2.)));
+  BOOST_TEST(v2.getGlobalIndex() == 5);
+  BOOST_TEST(not v2.isOwner());
+  BOOST_TEST(v2.isTagged());
+  BOOST_TEST(testing::equals(v1.getCoords(), Eigen::Vector2d(3., 4.)));
+  BOOST_TEST(v1.getGlobalIndex() == 6);
+}
+
+BOOST_AUTO_TEST_CASE(VertexFlags)
+{
+  PRECICE_TEST(1_rank);
+  using namespace mesh;
+  // The ID, the dimension, and the flags share a word
+  BOOST_TEST(sizeof(Vertex) == 4 * sizeof(double));
+
+  Vertex v(Eigen::Vector3d(1., 2., 3.), Vertex::MAX_ID);
+  BOOST_TEST(v.getID() == Vertex::MAX_ID);
+  BOOST_TEST(v.getDimensions() == 3);
+  BOOST_TEST(v.isOwner());
+  BOOST_TEST(not v.isTagged());
+
+  v.tag();
+  v.setOwner(false);
+  BOOST_TEST(v.getID() == Vertex::MAX_ID);
+  BOOST_TEST(v.getDimensions() == 3);
+  BOOST_TEST(not v.isOwner());
+  BOOST_TEST(v.isTagged());
+  BOOST_TEST(testing::equals(v.getCoords(), Eigen::Vector3d(1., 2., 3.)));
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Vertex
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -0,0 +1,473 @@
+#include "partition/PartitionCache.hpp"
+#include <Eigen/Core>
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cstring>
+#include <fstream>
+#include <utility>
+#include <vector>
+#include "com/Communication.hpp"
+#include "logging/LogMacros.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Utils.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/MasterSlave.hpp"
+#include "utils/assertion.hpp"
+#include "utils/fmt.hpp"
+
+namespace precice {
+namespace partition {
+
+namespace {
+namespace fs = boost::filesystem;
+
+constexpr char          MAGIC[8]                   = {'p', 'r', 'e', 'c', 'i', 'c', 'e', 'P'};
+constexpr char          COMMUNICATION_MAP_MAGIC[8] = {'p', 'r', 'e', 'c', 'i', 'c', 'e', 'C'};
+constexpr std::uint32_t VERSION                    = 3;
+
+/// Header of a partition file, followed by the key, the tagging state, and the arrays in the order of the sizes
+struct Header {
+  char          magic[8];
+  std::uint32_t version;
+  std::uint32_t headerBytes;
+  std::uint64_t hash;
+  std::int64_t  keyBytes;
+  std::int32_t  dimensions;
+  std::int32_t  globalNumberOfVertices;
+  std::int64_t  vertices;
+  std::int64_t  edges;
+  std::int64_t  triangles;
+  std::int64_t  offsets;
+  std::int64_t  distribution;
+  std::int64_t  taggingState;
+};
+
+/// Header of a communication map file, followed by the key and the map
+struct CommunicationMapHeader {
+  char          magic[8];
+  std::uint32_t version;
+  std::uint32_t headerBytes;
+  std::uint64_t hash;
+  std::int64_t  keyBytes;
+  std::int64_t  numberOfVertices;
+  std::int64_t  entries;
+};
+
+constexpr char OWNER  = 1;
+constexpr char TAGGED = 2;
+
+template <typename T>
+void write(std::ostream &stream, const std::vector<T> &values)
+{
+  stream.write(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+std::vector<T> read(std::istream &stream, std::int64_t size)
+{
+  std::vector<T> values(size);
+  stream.read(reinterpret_cast<char *>(values.data()), values.size() * sizeof(T));
+  return values;
+}
+
+std::vector<int> toInts(std::uint64_t fingerprint)
+{
+  return {static_cast<int>(static_cast<std::uint32_t>(fingerprint)), static_cast<int>(static_cast<std::uint32_t>(fingerprint >> 32))};
+}
+
+std::uint64_t fromInts(const std::vector<int> &ints)
+{
+  PRECICE_ASSERT(ints.size() == 2, ints.size());
+  return static_cast<std::uint64_t>(static_cast<std::uint32_t>(ints[0])) | (static_cast<std::uint64_t>(static_cast<std::uint32_t>(ints[1])) << 32);
+}
+
+Rank localRank()
+{
+  return utils::MasterSlave::isParallel() ? utils::MasterSlave::getRank() : 0;
+}
+
+/// Returns whether all values are in [0, end)
+bool allInRange(const std::vector<int> &values, std::int64_t end)
+{
+  return std::all_of(values.begin(), values.end(), [end](int value) { return value >= 0 && value < end; });
+}
+
+/// Flattens a map of ranks to vertex indices into the rank, the number of vertices, and the vertices of every rank
+std::vector<int> flatten(const std::map<int, std::vector<int>> &indexMap)
+{
+  std::vector<int> flat;
+  for (const auto &rankVertices : indexMap) {
+    flat.push_back(rankVertices.first);
+    flat.push_back(rankVertices.second.size());
+    flat.insert(flat.end(), rankVertices.second.begin(), rankVertices.second.end());
+  }
+  return flat;
+}
+
+/// Returns whether the flattened map consists of complete entries, each of a rank, a number of vertices, and vertex indices in [0, end)
+bool isValidFlatMap(const std::vector<int> &flat, int end)
+{
+  for (std::size_t i = 0; i < flat.size();) {
+    if (flat.size() - i < 2 || flat[i] < 0 || flat[i + 1] < 0 ||
+        static_cast<std::size_t>(flat[i + 1]) > flat.size() - i - 2) {
+      return false;
+    }
+    const auto begin = flat.begin() + i + 2;
+    if (not std::all_of(begin, begin + flat[i + 1], [end](int index) { return index >= 0 && index < end; })) {
+      return false;
+    }
+    i += 2 + flat[i + 1];
+  }
+  return true;
+}
+
+/// Restores a map flattened by flatten(), which has to be valid
+std::map<int, std::vector<int>> unflatten(const std::vector<int> &flat)
+{
+  std::map<int, std::vector<int>> indexMap;
+  for (std::size_t i = 0; i < flat.size(); i += 2 + flat[i + 1]) {
+    indexMap[flat[i]].assign(flat.begin() + i + 2, flat.begin() + i + 2 + flat[i + 1]);
+  }
+  return indexMap;
+}
+
+/// Returns whether the stream continues with the complete key of the fingerprint
+bool readKey(std::istream &stream, std::uint64_t hash, std::int64_t keyBytes, const utils::Fingerprint &key)
+{
+  if (hash != key.value() || keyBytes != static_cast<std::int64_t>(key.key().size())) {
+    return false;
+  }
+  // The hashes of different meshes may collide, the keys never do
+  const auto stored = read<char>(stream, keyBytes);
+  return stream && stored == key.key();
+}
+
+/// Writes to a temporary file, which is then renamed to the file, returns an error message if this fails
+template <typename Write>
+std::string writeAtomically(const fs::path &file, Write writeContent)
+{
+  const fs::path temporary = file.parent_path() / fs::unique_path(file.filename().string() + ".%%%%-%%%%-%%%%");
+
+  boost::system::error_code error;
+  fs::create_directories(file.parent_path(), error);
+  {
+    std::ofstream stream(temporary.string(), std::ios::binary);
+    writeContent(stream);
+    if (not stream) {
+      fs::remove(temporary, error);
+      return "could not write " + temporary.string();
+    }
+  }
+  fs::rename(temporary, file, error);
+  if (error) {
+    const std::string message = "could not move it to " + file.string() + ": " + error.message();
+    fs::remove(temporary, error);
+    return message;
+  }
+  return "";
+}
+} // namespace
+
+void addMeshToFingerprint(utils::Fingerprint &fingerprint, const mesh::Mesh &mesh)
+{
+  mesh::addToFingerprint(fingerprint, mesh);
+  fingerprint.add(mesh.edges().size());
+  for (const mesh::Edge &edge : mesh.edges()) {
+    fingerprint.add(edge.vertex(0).getID());
+    fingerprint.add(edge.vertex(1).getID());
+  }
+  fingerprint.add(mesh.triangles().size());
+  for (const mesh::Triangle &triangle : mesh.triangles()) {
+    fingerprint.add(triangle.edge(0).getID());
+    fingerprint.add(triangle.edge(1).getID());
+    fingerprint.add(triangle.edge(2).getID());
+  }
+}
+
+std::uint64_t fingerprint(const mesh::Mesh &mesh)
+{
+  utils::Fingerprint result(false);
+  addMeshToFingerprint(result, mesh);
+  return result.value();
+}
+
+std::uint64_t combineFingerprints(std::uint64_t local)
+{
+  if (utils::MasterSlave::isSlave()) {
+    std::vector<int> combined = toInts(local);
+    utils::MasterSlave::_communication->send(combined, 0);
+    utils::MasterSlave::_communication->broadcast(combined, 0);
+    return fromInts(combined);
+  }
+
+  utils::Fingerprint result(false);
+  result.add(utils::MasterSlave::isParallel() ? utils::MasterSlave::getSize() : 1);
+  result.add(local);
+  if (utils::MasterSlave::isMaster()) {
+    for (Rank rankSlave : utils::MasterSlave::allSlaves()) {
+      std::vector<int> slaveFingerprint;
+      utils::MasterSlave::_communication->receive(slaveFingerprint, rankSlave);
+      result.add(fromInts(slaveFingerprint));
+    }
+    utils::MasterSlave::_communication->broadcast(toInts(result.value()));
+  }
+  return result.value();
+}
+
+void sendFingerprint(com::Communication &communication, std::uint64_t fingerprint, Rank rankReceiver)
+{
+  communication.send(toInts(fingerprint), rankReceiver);
+}
+
+std::uint64_t receiveFingerprint(com::Communication &communication, Rank rankSender)
+{
+  std::vector<int> fingerprint;
+  communication.receive(fingerprint, rankSender);
+  return fromInts(fingerprint);
+}
+
+void broadcastFingerprint(std::uint64_t &fingerprint)
+{
+  if (utils::MasterSlave::isMaster()) {
+    utils::MasterSlave::_communication->broadcast(toInts(fingerprint));
+  } else if (utils::MasterSlave::isSlave()) {
+    std::vector<int> ints;
+    utils::MasterSlave::_communication->broadcast(ints, 0);
+    fingerprint = fromInts(ints);
+  }
+}
+
+PartitionCache::PartitionCache(std::string directory, std::string participantName)
+    : _directory(std::move(directory)),
+      _participantName(std::move(participantName))
+{
+}
+
+std::string PartitionCache::filename(const std::string &meshName, Rank rank) const
+{
+  PRECICE_ASSERT(isEnabled());
+  return (fs::path(_directory) / fmt::format("partition-{}-{}-{}.bin", _participantName, meshName, rank)).string();
+}
+
+std::string PartitionCache::communicationMapFilename(const std::string &meshName, Rank rank) const
+{
+  PRECICE_ASSERT(isEnabled());
+  return (fs::path(_directory) / fmt::format("communication-{}-{}-{}.bin", _participantName, meshName, rank)).string();
+}
+
+bool PartitionCache::load(const utils::Fingerprint &key, mesh::Mesh &mesh, int globalNumberOfVertices, std::vector<double> &taggingState) const
+{
+  PRECICE_TRACE(key.value(), mesh.getName(), globalNumberOfVertices);
+  PRECICE_ASSERT(key.keepsKey());
+  PRECICE_ASSERT(mesh.vertices().empty());
+  const std::string file = filename(mesh.getName(), localRank());
+  std::ifstream     stream(file, std::ios::binary);
+  if (not stream) {
+    PRECICE_DEBUG("No cached partition found at {}", file);
+    return false;
+  }
+
+  Header header;
+  stream.read(reinterpret_cast<char *>(&header), sizeof(Header));
+  if (not stream || std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.headerBytes != sizeof(Header)) {
+    PRECICE_WARN("Ignoring the cached partition {} as it is not a partition file of this version of preCICE.", file);
+    return false;
+  }
+  if (header.dimensions != mesh.getDimensions() || header.globalNumberOfVertices != globalNumberOfVertices ||
+      not readKey(stream, header.hash, header.keyBytes, key)) {
+    PRECICE_DEBUG("Ignoring the cached partition {} as it belongs to different meshes or decompositions.", file);
+    return false;
+  }
+
+  // Check the sizes against the file before allocating anything
+  boost::system::error_code error;
+  const std::int64_t        fileBytes = fs::file_size(file, error);
+  const std::int64_t        counts[]  = {header.vertices, header.edges, header.triangles, header.offsets, header.distribution, header.taggingState};
+  if (error || not std::all_of(std::begin(counts), std::end(counts), [fileBytes](std::int64_t count) { return count >= 0 && count <= fileBytes; })) {
+    PRECICE_WARN("Ignoring the cached partition {} as its sizes do not match the file.", file);
+    return false;
+  }
+  const std::int64_t vertexBytes   = header.dimensions * sizeof(double) + sizeof(int) + sizeof(char);
+  const std::int64_t expectedBytes = sizeof(Header) + header.keyBytes + header.taggingState * static_cast<std::int64_t>(sizeof(double)) + header.vertices * vertexBytes +
+                                     (2 * header.edges + 3 * header.triangles + header.offsets + header.distribution) * static_cast<std::int64_t>(sizeof(int));
+  if (fileBytes != expectedBytes || header.vertices > globalNumberOfVertices) {
+    PRECICE_WARN("Ignoring the cached partition {} as its sizes do not match the file or the provided mesh.", file);
+    return false;
+  }
+
+  auto       state         = read<double>(stream, header.taggingState);
+  const auto coordinates   = read<double>(stream, header.vertices * header.dimensions);
+  const auto globalIndices = read<int>(stream, header.vertices);
+  const auto flags         = read<char>(stream, header.vertices);
+  const auto edges         = read<int>(stream, 2 * header.edges);
+  const auto triangles     = read<int>(stream, 3 * header.triangles);
+  auto       offsets       = read<int>(stream, header.offsets);
+  const auto distribution  = read<int>(stream, header.distribution);
+  if (not stream) {
+    PRECICE_WARN("Ignoring the cached partition {} as it is truncated.", file);
+    return false;
+  }
+  if (not allInRange(globalIndices, globalNumberOfVertices) || not allInRange(edges, header.vertices) ||
+      not allInRange(triangles, header.edges) || not isValidFlatMap(distribution, globalNumberOfVertices)) {
+    PRECICE_WARN("Ignoring the cached partition {} as its indices do not match the provided mesh.", file);
+    return false;
+  }
+
+  for (std::int64_t i = 0; i < header.vertices; ++i) {
+    mesh::Vertex &vertex = mesh.createVertex(Eigen::Map<const Eigen::VectorXd>(&coordinates[i * header.dimensions], header.dimensions));
+    vertex.setGlobalIndex(globalIndices[i]);
+    vertex.setOwner(flags[i] & OWNER);
+    if (flags[i] & TAGGED) {
+      vertex.tag();
+    }
+  }
+  for (std::int64_t i = 0; i < header.edges; ++i) {
+    mesh.createEdge(mesh.vertices()[edges[2 * i]], mesh.vertices()[edges[2 * i + 1]]);
+  }
+  for (std::int64_t i = 0; i < header.triangles; ++i) {
+    mesh.createTriangle(mesh.edges()[triangles[3 * i]], mesh.edges()[triangles[3 * i + 1]], mesh.edges()[triangles[3 * i + 2]]);
+  }
+  mesh.setVertexOffsets(offsets);
+  mesh.getVertexDistribution() = unflatten(distribution);
+  mesh.setGlobalNumberOfVertices(header.globalNumberOfVertices);
+  taggingState = std::move(state);
+  return true;
+}
+
+void PartitionCache::store(const utils::Fingerprint &key, const mesh::Mesh &mesh, const std::vector<double> &taggingState) const
+{
+  PRECICE_TRACE(key.value(), mesh.getName());
+  PRECICE_ASSERT(key.keepsKey());
+
+  std::vector<double> coordinates;
+  std::vector<int>    globalIndices;
+  std::vector<char>   flags;
+  for (const mesh::Vertex &vertex : mesh.vertices()) {
+    const auto coords = vertex.rawCoords();
+    coordinates.insert(coordinates.end(), coords.begin(), coords.begin() + mesh.getDimensions());
+    globalIndices.push_back(vertex.getGlobalIndex());
+    flags.push_back((vertex.isOwner() ? OWNER : 0) | (vertex.isTagged() ? TAGGED : 0));
+  }
+  std::vector<int> edges;
+  for (const mesh::Edge &edge : mesh.edges()) {
+    edges.push_back(edge.vertex(0).getID());
+    edges.push_back(edge.vertex(1).getID());
+  }
+  std::vector<int> triangles;
+  for (const mesh::Triangle &triangle : mesh.triangles()) {
+    triangles.push_back(triangle.edge(0).getID());
+    triangles.push_back(triangle.edge(1).getID());
+    triangles.push_back(triangle.edge(2).getID());
+  }
+  const std::vector<int> distribution = flatten(mesh.getVertexDistribution());
+
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version                = VERSION;
+  header.headerBytes            = sizeof(Header);
+  header.hash                   = key.value();
+  header.keyBytes               = key.key().size();
+  header.dimensions             = mesh.getDimensions();
+  header.globalNumberOfVertices = mesh.getGlobalNumberOfVertices();
+  header.vertices               = mesh.vertices().size();
+  header.edges                  = mesh.edges().size();
+  header.triangles              = mesh.triangles().size();
+  header.offsets                = mesh.getVertexOffsets().size();
+  header.distribution           = distribution.size();
+  header.taggingState           = taggingState.size();
+
+  const fs::path    file  = filename(mesh.getName(), localRank());
+  const std::string error = writeAtomically(file, [&](std::ostream &stream) {
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    write(stream, key.key());
+    write(stream, taggingState);
+    write(stream, coordinates);
+    write(stream, globalIndices);
+    write(stream, flags);
+    write(stream, edges);
+    write(stream, triangles);
+    write(stream, mesh.getVertexOffsets());
+    write(stream, distribution);
+  });
+  if (not error.empty()) {
+    PRECICE_WARN("Could not store the partition of mesh \"{}\", {}. The mesh will be re-partitioned in the next run.", mesh.getName(), error);
+    return;
+  }
+  PRECICE_DEBUG("Stored partition at {}", file.string());
+}
+
+bool PartitionCache::loadCommunicationMap(const utils::Fingerprint &key, const std::string &meshName, int numberOfVertices, CommunicationMap &communicationMap) const
+{
+  PRECICE_TRACE(key.value(), meshName, numberOfVertices);
+  PRECICE_ASSERT(key.keepsKey());
+  const std::string file = communicationMapFilename(meshName, localRank());
+  std::ifstream     stream(file, std::ios::binary);
+  if (not stream) {
+    PRECICE_DEBUG("No cached communication map found at {}", file);
+    return false;
+  }
+
+  CommunicationMapHeader header;
+  stream.read(reinterpret_cast<char *>(&header), sizeof(CommunicationMapHeader));
+  if (not stream || std::memcmp(header.magic, COMMUNICATION_MAP_MAGIC, sizeof(COMMUNICATION_MAP_MAGIC)) != 0 ||
+      header.version != VERSION || header.headerBytes != sizeof(CommunicationMapHeader)) {
+    PRECICE_WARN("Ignoring the cached communication map {} as it is not a communication map file of this version of preCICE.", file);
+    return false;
+  }
+  if (header.numberOfVertices != numberOfVertices || not readKey(stream, header.hash, header.keyBytes, key)) {
+    PRECICE_DEBUG("Ignoring the cached communication map {} as it belongs to different decompositions.", file);
+    return false;
+  }
+
+  boost::system::error_code error;
+  const std::int64_t        fileBytes = fs::file_size(file, error);
+  if (error || header.entries < 0 ||
+      fileBytes != static_cast<std::int64_t>(sizeof(CommunicationMapHeader)) + header.keyBytes + header.entries * static_cast<std::int64_t>(sizeof(int))) {
+    PRECICE_WARN("Ignoring the cached communication map {} as its size does not match the file.", file);
+    return false;
+  }
+  const auto entries = read<int>(stream, header.entries);
+  if (not stream) {
+    PRECICE_WARN("Ignoring the cached communication map {} as it is truncated.", file);
+    return false;
+  }
+  if (not isValidFlatMap(entries, numberOfVertices)) {
+    PRECICE_WARN("Ignoring the cached communication map {} as its indices do not match the local mesh.", file);
+    return false;
+  }
+  communicationMap = unflatten(entries);
+  return true;
+}
+
+void PartitionCache::storeCommunicationMap(const utils::Fingerprint &key, const std::string &meshName, int numberOfVertices, const CommunicationMap &communicationMap) const
+{
+  PRECICE_TRACE(key.value(), meshName, numberOfVertices);
+  PRECICE_ASSERT(key.keepsKey());
+  const std::vector<int> entries = flatten(communicationMap);
+
+  CommunicationMapHeader header{};
+  std::memcpy(header.magic, COMMUNICATION_MAP_MAGIC, sizeof(COMMUNICATION_MAP_MAGIC));
+  header.version          = VERSION;
+  header.headerBytes      = sizeof(CommunicationMapHeader);
+  header.hash             = key.value();
+  header.keyBytes         = key.key().size();
+  header.numberOfVertices = numberOfVertices;
+  header.entries          = entries.size();
+
+  const fs::path    file  = communicationMapFilename(meshName, localRank());
+  const std::string error = writeAtomically(file, [&](std::ostream &stream) {
+    stream.write(reinterpret_cast<const char *>(&header), sizeof(CommunicationMapHeader));
+    write(stream, key.key());
+    write(stream, entries);
+  });
+  if (not error.empty()) {
+    PRECICE_WARN("Could not store the communication map of mesh \"{}\", {}. It will be rebuilt in the next run.", meshName, error);
+    return;
+  }
+  PRECICE_DEBUG("Stored communication map at {}", file.string());
+}
+
+} // namespace partition
+} // namespace precice
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+#include "com/SharedPointer.hpp"
+#include "logging/Logger.hpp"
+#include "precice/types.hpp"
+#include "utils/Fingerprint.hpp"
+
+namespace precice {
+namespace mesh {
+class Mesh;
+}
+
+namespace partition {
+
+/// Adds the coordinates of the vertices and the edges and triangles of the local mesh to the fingerprint
+void addMeshToFingerprint(utils::Fingerprint &fingerprint, const mesh::Mesh &mesh);
+
+/// Hash of the coordinates of the vertices and of the edges and triangles of the local mesh
+std::uint64_t fingerprint(const mesh::Mesh &mesh);
+
+/**
+ * @brief Combines the fingerprints of all ranks in rank order.
+ *
+ * Collective over master and slaves, every rank returns the combined fingerprint.
+ * The combination also depends on the number of ranks.
+ */
+std::uint64_t combineFingerprints(std::uint64_t local);
+
+/// Sends a fingerprint, which does not fit into a single int
+void sendFingerprint(com::Communication &communication, std::uint64_t fingerprint, Rank rankReceiver);
+
+/// Receives a fingerprint sent by sendFingerprint()
+std::uint64_t receiveFingerprint(com::Communication &communication, Rank rankSender);
+
+/// Broadcasts the fingerprint of the master to all slaves
+void broadcastFingerprint(std::uint64_t &fingerprint);
+
+/**
+ * @brief Stores the partitions of received meshes in a directory, such that restarts with identical meshes skip the re-partitioning.
+ *
+ * Every rank of a participant stores its partition of a mesh in its own file: the local vertices
+ * with their global indices and owner flags, the edges and triangles, the vertex offsets, the
+ * vertex distribution, and the state the mappings computed while tagging the mesh. Point-to-point communications store the communication maps of their meshes
+ * alongside. A file stores the complete key of its fingerprint and is only loaded if the complete
+ * key matches, which the caller derives from everything the file depends on. Files are written to
+ * a temporary file first and then renamed, such that concurrent runs never read partially written files.
+ */
+class PartitionCache {
+public:
+  using CommunicationMap = std::map<int, std::vector<int>>;
+
+  /// Constructor, an empty directory disables the cache
+  explicit PartitionCache(std::string directory = "", std::string participantName = "");
+
+  bool isEnabled() const
+  {
+    return not _directory.empty();
+  }
+
+  /// Returns the file of the partition of the mesh on the given rank
+  std::string filename(const std::string &meshName, Rank rank) const;
+
+  /// Returns the file of the communication map of the mesh on the given rank
+  std::string communicationMapFilename(const std::string &meshName, Rank rank) const;
+
+  /**
+   * @brief Loads the partition of this rank into the empty mesh.
+   *
+   * Besides the key, the sizes in the file have to match the file size, and all stored indices
+   * have to lie within the provided mesh of the given global number of vertices.
+   *
+   * @param[out] taggingState the state of the mappings passed to store()
+   *
+   * @returns false if there is no such partition or the file does not match, the mesh and the state are unchanged then
+   */
+  bool load(const utils::Fingerprint &key, mesh::Mesh &mesh, int globalNumberOfVertices, std::vector<double> &taggingState) const;
+
+  /// Stores the partition of this rank and the tagging state of its mappings, failing to write the file only results in a warning
+  void store(const utils::Fingerprint &key, const mesh::Mesh &mesh, const std::vector<double> &taggingState) const;
+
+  /**
+   * @brief Loads the communication map of this rank for the given mesh.
+   *
+   * All stored indices have to lie within the given number of local vertices.
+   *
+   * @returns false if there is no such map or the file does not match, the map is unchanged then
+   */
+  bool loadCommunicationMap(const utils::Fingerprint &key, const std::string &meshName, int numberOfVertices, CommunicationMap &communicationMap) const;
+
+  /// Stores the communication map of this rank, failing to write the file only results in a warning
+  void storeCommunicationMap(const utils::Fingerprint &key, const std::string &meshName, int numberOfVertices, const CommunicationMap &communicationMap) const;
+
+private:
+  mutable logging::Logger _log{"partition::PartitionCache"};
+
+  std::string _directory;
+
+  std::string _participantName;
+};
+
+} // namespace partition
+} // namespace precice
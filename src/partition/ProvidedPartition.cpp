@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -16,6 +17,7 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/Vertex.hpp"
 #include "partition/Partition.hpp"
+#include "partition/PartitionCache.hpp"
 #include "partition/ProvidedPartition.hpp"
 #include "precice/types.hpp"
 #include "utils/Event.hpp"
@@ -79,6 +81,11 @@ void ProvidedPartition::communicate()
 
     } else {
 
+      if (isPartitionCached(*m2n)) {
+        PRECICE_INFO("Skip sending mesh {} as its partition is cached by the receiving participant", _mesh->getName());
+        continue;
+      }
+
       if (not hasMeshBeenGathered) {
         //Gather mesh
         Event e("partition.gatherMesh." + _mesh->getName(), precice::syncMode);
@@ -115,6 +122,29 @@ void ProvidedPartition::communicate()
   }
 }
 
+bool ProvidedPartition::isPartitionCached(m2n::M2N &m2n)
+{
+  PRECICE_TRACE();
+  if (m2n.getPartitionCacheDirectory().empty()) {
+    return false;
+  }
+  Event e("partition.checkCache." + _mesh->getName(), precice::syncMode);
+
+  const std::uint64_t key    = combineFingerprints(fingerprint(*_mesh));
+  bool                cached = false;
+  if (not utils::MasterSlave::isSlave()) {
+    sendFingerprint(*m2n.getMasterCommunication(), key, 0);
+    m2n.getMasterCommunication()->send(_mesh->getGlobalNumberOfVertices(), 0);
+    m2n.getMasterCommunication()->receive(cached, 0);
+  }
+  if (utils::MasterSlave::isMaster()) {
+    utils::MasterSlave::_communication->broadcast(cached);
+  } else if (utils::MasterSlave::isSlave()) {
+    utils::MasterSlave::_communication->broadcast(cached, 0);
+  }
+  return cached;
+}
+
 void ProvidedPartition::prepare()
 {
   PRECICE_TRACE();
@@ -32,6 +32,9 @@ public:
 private:
   void prepare();
 
+  /// Exchanges the fingerprint of the mesh with the receiving participant, returns true if it loaded the partition from its cache
+  bool isPartitionCached(m2n::M2N &m2n);
+
   logging::Logger _log{"partition::ProvidedPartition"};
 };
 
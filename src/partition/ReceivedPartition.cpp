@@ -1,25 +1,39 @@
 #include "partition/ReceivedPartition.hpp"
+#include <Eigen/Core>
 #include <algorithm>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <ostream>
+#include <typeinfo>
 #include <utility>
 #include <vector>
 #include "com/CommunicateBoundingBox.hpp"
 #include "com/CommunicateMesh.hpp"
 #include "com/Communication.hpp"
+#include "com/SerializedMesh.hpp"
 #include "com/SharedPointer.hpp"
 #include "logging/LogMacros.hpp"
 #include "m2n/M2N.hpp"
 #include "mapping/Mapping.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mesh/BoundingBox.hpp"
+#include "mesh/Data.hpp"
+#include "mesh/Edge.hpp"
 #include "mesh/Filter.hpp"
 #include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Utils.hpp"
 #include "mesh/Vertex.hpp"
 #include "partition/Partition.hpp"
+#include "partition/PartitionCache.hpp"
+#include "precice/types.hpp"
+#include "query/Index.hpp"
+#include "query/impl/SpaceFillingCurve.hpp"
 #include "utils/Event.hpp"
+#include "utils/Fingerprint.hpp"
 #include "utils/MasterSlave.hpp"
+#include "utils/ThreadPool.hpp"
 #include "utils/assertion.hpp"
 #include "utils/fmt.hpp"
 
@@ -65,6 +79,10 @@ void ReceivedPartition::communicate()
     m2n().broadcastReceiveAllMesh(*_mesh);
 
   } else {
+    if (loadFromCache()) {
+      return;
+    }
+
     // for one-level initialization receive complete mesh on master
     PRECICE_INFO("Receive global mesh {}", _mesh->getName());
     Event e("partition.receiveGlobalMesh." + _mesh->getName(), precice::syncMode);
@@ -92,11 +110,21 @@ void ReceivedPartition::compute()
 {
   PRECICE_TRACE();
 
+  if (_loadedFromCache) {
+    PRECICE_DEBUG("Partition of mesh {} has been loaded from the cache", _mesh->getName());
+    // The bounding box is still required to check moved local meshes
+    if (utils::MasterSlave::isParallel() || _allowDirectAccess) {
+      prepareBoundingBox();
+    }
+    return;
+  }
+
   // handle coupling mode first (i.e. serial participant)
   if (!utils::MasterSlave::isParallel()) { //coupling mode
     PRECICE_DEBUG("Handle partition data structures for serial participant");
 
-    if (_allowDirectAccess) {
+    // The vertices of a moving mesh may enter the access region later
+    if (_allowDirectAccess && not _mesh->isMoving()) {
       // Prepare the bounding boxes
       prepareBoundingBox();
       // Filter out vertices not laying in the bounding box
@@ -125,6 +153,7 @@ void ReceivedPartition::compute()
       vertexCounter++;
     }
     _mesh->getVertexOffsets().push_back(vertexCounter);
+    storeInCache();
     return;
   }
 
@@ -260,6 +289,8 @@ void ReceivedPartition::compute()
     PRECICE_DEBUG("My vertex offsets: {}", _mesh->getVertexOffsets());
     utils::MasterSlave::_communication->broadcast(_mesh->getVertexOffsets());
   }
+
+  storeInCache();
 }
 
 namespace {
@@ -276,6 +307,144 @@ auto errorMeshFilteredOut(const std::string &meshName, const int rank)
                      "\"<use-mesh mesh=\"{0}\" ... geometric-filter=\"no-filter\" />",
                      meshName, rank);
 }
+
+/// Elements referencing an item in compressed rows, the elements of item i are at [offsets[i], offsets[i + 1])
+struct Adjacency {
+  std::vector<int> offsets;
+  std::vector<int> elements;
+};
+
+/// Inverts the references of elements to items, where referenceOf(e, k) is the k-th item referenced by element e
+template <typename Reference>
+Adjacency invertReferences(std::size_t items, std::size_t elements, int referencesPerElement, Reference referenceOf)
+{
+  Adjacency adjacency;
+  adjacency.offsets.assign(items + 1, 0);
+  for (std::size_t e = 0; e < elements; ++e) {
+    for (int k = 0; k < referencesPerElement; ++k) {
+      ++adjacency.offsets[referenceOf(e, k) + 1];
+    }
+  }
+  std::partial_sum(adjacency.offsets.begin(), adjacency.offsets.end(), adjacency.offsets.begin());
+
+  adjacency.elements.resize(adjacency.offsets.back());
+  std::vector<int> next(adjacency.offsets.begin(), adjacency.offsets.end() - 1);
+  for (std::size_t e = 0; e < elements; ++e) {
+    for (int k = 0; k < referencesPerElement; ++k) {
+      adjacency.elements[next[referenceOf(e, k)]++] = e;
+    }
+  }
+  return adjacency;
+}
+
+/**
+ * @brief Serializes the vertices together with the edges and triangles between them.
+ *
+ * Only the connectivity of the given vertices is visited, hence the costs do not depend on the size of the mesh.
+ * The result equals the serialization of mesh::filterMesh() applied to the vertices.
+ */
+com::SerializedMesh serializeSubMesh(const mesh::Mesh &mesh, const Adjacency &vertexEdges, const Adjacency &edgeTriangles, const std::vector<VertexID> &vertices)
+{
+  auto contains = [](const std::vector<int> &ids, int id) { return std::binary_search(ids.begin(), ids.end(), id); };
+
+  // Every edge and triangle is added once, by its first vertex and edge respectively
+  std::vector<EdgeID> edges;
+  for (VertexID vertex : vertices) {
+    for (int i = vertexEdges.offsets[vertex]; i < vertexEdges.offsets[vertex + 1]; ++i) {
+      const mesh::Edge &edge = mesh.edges()[vertexEdges.elements[i]];
+      if (edge.vertex(0).getID() == vertex && contains(vertices, edge.vertex(1).getID())) {
+        edges.push_back(edge.getID());
+      }
+    }
+  }
+  std::sort(edges.begin(), edges.end());
+
+  std::vector<TriangleID> triangles;
+  for (EdgeID edge : edges) {
+    for (int i = edgeTriangles.offsets[edge]; i < edgeTriangles.offsets[edge + 1]; ++i) {
+      const mesh::Triangle &triangle = mesh.triangles()[edgeTriangles.elements[i]];
+      if (triangle.edge(0).getID() == edge && contains(edges, triangle.edge(1).getID()) && contains(edges, triangle.edge(2).getID())) {
+        triangles.push_back(triangle.getID());
+      }
+    }
+  }
+  std::sort(triangles.begin(), triangles.end());
+
+  return com::SerializedMesh::serialize(mesh, vertices, edges, triangles);
+}
+
+/**
+ * @brief Decides the owners of the tagged vertices of all ranks, balancing the costs of the ranks.
+ *
+ * A vertex tagged on a single rank is owned by this rank. Shared vertices are visited along
+ * a space-filling curve and go to the candidate rank with the lowest accumulated cost, the
+ * lower rank winning ties. Hence, the result is deterministic and neighbouring vertices tend
+ * to end up on the same rank.
+ */
+void assignOwnersBalanced(const std::vector<std::vector<int>> &   tags,
+                          const std::vector<std::vector<int>> &   globalIDs,
+                          const std::vector<std::vector<double>> &coordinates,
+                          int                                     dimensions,
+                          int                                     vertexCost,
+                          std::vector<double> &                   costs,
+                          std::vector<std::vector<int>> &         ownerVecs,
+                          std::vector<int> &                      globalOwnerVec)
+{
+  // Candidates of every global vertex in compressed rows, in ascending order of ranks
+  std::vector<int> offsets(globalOwnerVec.size() + 1, 0);
+  for (std::size_t rank = 0; rank < tags.size(); ++rank) {
+    for (std::size_t i = 0; i < tags[rank].size(); ++i) {
+      if (tags[rank][i] == 1) {
+        ++offsets[globalIDs[rank][i] + 1];
+      }
+    }
+  }
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  std::vector<std::pair<Rank, int>> candidates(offsets.back());
+  std::vector<int>                  next(offsets.begin(), offsets.end() - 1);
+  for (std::size_t rank = 0; rank < tags.size(); ++rank) {
+    for (std::size_t i = 0; i < tags[rank].size(); ++i) {
+      if (tags[rank][i] == 1) {
+        candidates[next[globalIDs[rank][i]]++] = {static_cast<Rank>(rank), static_cast<int>(i)};
+      }
+    }
+  }
+
+  auto assign = [&](int globalID, const std::pair<Rank, int> &candidate) {
+    ownerVecs[candidate.first][candidate.second] = 1;
+    globalOwnerVec[globalID]                     = candidate.first + 1;
+    costs[candidate.first] += vertexCost;
+  };
+
+  std::vector<int>    shared;
+  std::vector<double> sharedCoordinates;
+  for (std::size_t globalID = 0; globalID < globalOwnerVec.size(); ++globalID) {
+    const int count = offsets[globalID + 1] - offsets[globalID];
+    if (count == 1) {
+      assign(globalID, candidates[offsets[globalID]]);
+    } else if (count > 1) {
+      const auto &first = candidates[offsets[globalID]];
+      shared.push_back(globalID);
+      sharedCoordinates.insert(sharedCoordinates.end(),
+                               coordinates[first.first].begin() + first.second * dimensions,
+                               coordinates[first.first].begin() + (first.second + 1) * dimensions);
+    }
+  }
+
+  const std::vector<int> order = query::impl::mortonOrder(Eigen::Map<const Eigen::MatrixXd>(sharedCoordinates.data(), dimensions, shared.size()));
+  for (int index : order) {
+    const int globalID = shared[index];
+    int       best     = offsets[globalID];
+    for (int c = offsets[globalID] + 1; c < offsets[globalID + 1]; ++c) {
+      if (costs[candidates[c].first] < costs[candidates[best].first]) {
+        best = c;
+      }
+    }
+    assign(globalID, candidates[best]);
+  }
+}
+
 } // namespace
 
 void ReceivedPartition::filterByBoundingBox()
@@ -292,7 +461,10 @@ void ReceivedPartition::filterByBoundingBox()
 
   prepareBoundingBox();
 
-  if (_geometricFilter == ON_MASTER) { //filter on master and communicate reduced mesh then
+  // The vertices of a moving mesh may enter the bounding box later
+  const GeometricFilter geometricFilter = _mesh->isMoving() ? NO_FILTER : _geometricFilter;
+
+  if (geometricFilter == ON_MASTER) { //filter on master and communicate reduced mesh then
 
     PRECICE_ASSERT(not m2n().usesTwoLevelInitialization());
     PRECICE_INFO("Pre-filter mesh {} by bounding box on master", _mesh->getName());
@@ -312,15 +484,45 @@ void ReceivedPartition::filterByBoundingBox()
       PRECICE_ASSERT(utils::MasterSlave::getRank() == 0);
       PRECICE_ASSERT(utils::MasterSlave::getSize() > 1);
 
+      const int                      ranks = utils::MasterSlave::getSize();
+      std::vector<mesh::BoundingBox> slaveBBs(ranks, mesh::BoundingBox(_dimensions));
       for (int rankSlave : utils::MasterSlave::allSlaves()) {
-        mesh::BoundingBox slaveBB(_bb.getDimension());
-        com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(slaveBB, rankSlave);
-
-        PRECICE_DEBUG("From slave {}, bounding mesh: {}", rankSlave, slaveBB);
-        mesh::Mesh slaveMesh("SlaveMesh", _dimensions, mesh::Mesh::MESH_ID_UNDEFINED);
-        mesh::filterMesh(slaveMesh, *_mesh, [&slaveBB](const mesh::Vertex &v) { return slaveBB.contains(v); });
-        PRECICE_DEBUG("Send filtered mesh to slave: {}", rankSlave);
-        com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(slaveMesh, rankSlave);
+        com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(slaveBBs[rankSlave], rankSlave);
+        PRECICE_DEBUG("From slave {}, bounding mesh: {}", rankSlave, slaveBBs[rankSlave]);
+      }
+
+      // Query the vertices of all slaves in one index and serialize their meshes with the threads of the mappings
+      utils::ThreadPool *pool   = getMappingThreadPool();
+      query::Index       index(_mesh);
+      const auto         inside = index.getVerticesInsideBoxes(slaveBBs, pool);
+
+      const mesh::Mesh &mesh          = *_mesh;
+      const Adjacency   vertexEdges   = invertReferences(mesh.vertices().size(), mesh.edges().size(), 2,
+                                                     [&mesh](std::size_t e, int k) { return mesh.edges()[e].vertex(k).getID(); });
+      const Adjacency   edgeTriangles = invertReferences(mesh.edges().size(), mesh.triangles().size(), 3,
+                                                       [&mesh](std::size_t t, int k) { return mesh.triangles()[t].edge(k).getID(); });
+
+      // Only one batch of sub-meshes is held in memory, one per thread
+      const int                        batchSize = pool ? pool->size() : 1;
+      std::vector<com::SerializedMesh> slaveMeshes(batchSize);
+      for (int batchBegin = 1; batchBegin < ranks; batchBegin += batchSize) {
+        const int  batchEnd  = std::min(batchBegin + batchSize, ranks);
+        const auto serialize = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+          for (std::ptrdiff_t rankSlave = begin; rankSlave < end; ++rankSlave) {
+            slaveMeshes[rankSlave - batchBegin] = serializeSubMesh(mesh, vertexEdges, edgeTriangles, inside[rankSlave]);
+          }
+        };
+        if (pool) {
+          pool->parallelFor(batchBegin, batchEnd, 1, serialize);
+        } else {
+          serialize(batchBegin, batchEnd);
+        }
+
+        for (int rankSlave = batchBegin; rankSlave < batchEnd; ++rankSlave) {
+          const com::SerializedMesh &slaveMesh = slaveMeshes[rankSlave - batchBegin];
+          PRECICE_DEBUG("Send filtered mesh with {} vertices to slave: {}", slaveMesh.vertexCount(), rankSlave);
+          com::CommunicateMesh(utils::MasterSlave::_communication).sendMesh(slaveMesh, rankSlave);
+        }
       }
 
       // Now also filter the remaining master mesh
@@ -349,7 +551,7 @@ void ReceivedPartition::filterByBoundingBox()
         com::CommunicateMesh(utils::MasterSlave::_communication).broadcastSendMesh(*_mesh);
       }
     }
-    if (_geometricFilter == ON_SLAVES) {
+    if (geometricFilter == ON_SLAVES) {
 
       PRECICE_INFO("Filter mesh {} by bounding box on slaves", _mesh->getName());
       Event e("partition.filterMeshBB." + _mesh->getName(), precice::syncMode);
@@ -368,7 +570,7 @@ void ReceivedPartition::filterByBoundingBox()
         PRECICE_CHECK(not _mesh->vertices().empty(), errorMeshFilteredOut(_mesh->getName(), utils::MasterSlave::getRank()));
       }
     } else {
-      PRECICE_ASSERT(_geometricFilter == NO_FILTER);
+      PRECICE_ASSERT(geometricFilter == NO_FILTER);
     }
   }
 }
@@ -389,62 +591,39 @@ void ReceivedPartition::compareBoundingBoxes()
   if (not m2n().usesTwoLevelInitialization())
     return;
 
-  // receive and broadcast number of remote ranks
-  int numberOfRemoteRanks = -1;
-  if (utils::MasterSlave::isMaster()) {
-    m2n().getMasterCommunication()->receive(numberOfRemoteRanks, 0);
-    utils::MasterSlave::_communication->broadcast(numberOfRemoteRanks);
-  } else {
-    PRECICE_ASSERT(utils::MasterSlave::isSlave());
-    utils::MasterSlave::_communication->broadcast(numberOfRemoteRanks, 0);
-  }
+  PRECICE_CHECK(not _mesh->isMoving(),
+                "The received mesh \"{}\" is moving, which is not supported in combination with two-level initialization, "
+                "as only the mesh partitions of the initial positions are exchanged. "
+                "Please switch off the two-level initialization.",
+                _mesh->getName());
 
-  // define and initialize remote bounding box map
+  // The remote bounding boxes are only received by the master, which does not broadcast them.
+  // All ranks find their connected remote ranks together, see com::CommunicateBoundingBox::findOverlappingBoundingBoxes().
+  PRECICE_ASSERT(utils::MasterSlave::isParallel());
   mesh::Mesh::BoundingBoxMap remoteBBMap;
-  mesh::BoundingBox          initialBB(_mesh->getDimensions());
-
-  for (int remoteRank = 0; remoteRank < numberOfRemoteRanks; remoteRank++) {
-    remoteBBMap.emplace(remoteRank, initialBB);
-  }
-
-  // receive and broadcast remote bounding box map
   if (utils::MasterSlave::isMaster()) {
+    int numberOfRemoteRanks = -1;
+    m2n().getMasterCommunication()->receive(numberOfRemoteRanks, 0);
+    mesh::BoundingBox initialBB(_mesh->getDimensions());
+    for (int remoteRank = 0; remoteRank < numberOfRemoteRanks; remoteRank++) {
+      remoteBBMap.emplace(remoteRank, initialBB);
+    }
     com::CommunicateBoundingBox(m2n().getMasterCommunication()).receiveBoundingBoxMap(remoteBBMap, 0);
-    com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastSendBoundingBoxMap(remoteBBMap);
-  } else {
-    PRECICE_ASSERT(utils::MasterSlave::isSlave());
-    com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastReceiveBoundingBoxMap(remoteBBMap);
   }
 
   // prepare local bounding box
   prepareBoundingBox();
 
-  if (utils::MasterSlave::isMaster()) {                 // Master
-    std::map<int, std::vector<int>> connectionMap;      //local ranks -> {remote ranks}
-    std::vector<int>                connectedRanksList; // local ranks with any connection
+  com::CommunicateBoundingBox comBB(utils::MasterSlave::_communication);
+  _mesh->getConnectedRanks() = comBB.findOverlappingBoundingBoxes(_bb, remoteBBMap, utils::MasterSlave::getRank(), utils::MasterSlave::getSize());
 
-    // connected ranks for master
-    _mesh->getConnectedRanks().clear();
-    for (auto &remoteBB : remoteBBMap) {
-      if (_bb.overlapping(remoteBB.second)) {
-        _mesh->getConnectedRanks().push_back(remoteBB.first); //connected remote ranks for this rank
-      }
-    }
-    if (not _mesh->getConnectedRanks().empty()) {
-      connectionMap[0] = _mesh->getConnectedRanks();
-      connectedRanksList.push_back(0);
-    }
+  // gather the connected ranks of all ranks along a tree instead of receiving them one by one
+  std::map<int, std::vector<int>> connectionMap = comBB.gatherConnectionMap(_mesh->getConnectedRanks(), utils::MasterSlave::getRank(), utils::MasterSlave::getSize()); //local ranks -> {remote ranks}
 
-    // receive connected ranks from slaves and add them to the connection map
-    for (int rank : utils::MasterSlave::allSlaves()) {
-      std::vector<int> slaveConnectedRanks;
-      int              connectedRanksSize = -1;
-      utils::MasterSlave::_communication->receive(connectedRanksSize, rank);
-      if (connectedRanksSize != 0) {
-        connectedRanksList.push_back(rank);
-        utils::MasterSlave::_communication->receive(slaveConnectedRanks, rank);
-        connectionMap[rank] = slaveConnectedRanks;
-      }
+  if (utils::MasterSlave::isMaster()) {
+    std::vector<int> connectedRanksList; // local ranks with any connection
+    for (const auto &connection : connectionMap) {
+      connectedRanksList.push_back(connection.first);
     }
 
     // send connectionMap to other master
@@ -455,21 +634,6 @@ void ReceivedPartition::compareBoundingBoxes()
                   "If you deal with very different mesh resolutions, consider increasing the safety-factor in the <use-mesh /> tag.",
                   _mesh->getName());
     com::CommunicateBoundingBox(m2n().getMasterCommunication()).sendConnectionMap(connectionMap, 0);
-  } else {
-    PRECICE_ASSERT(utils::MasterSlave::isSlave());
-
-    _mesh->getConnectedRanks().clear();
-    for (const auto &remoteBB : remoteBBMap) {
-      if (_bb.overlapping(remoteBB.second)) {
-        _mesh->getConnectedRanks().push_back(remoteBB.first);
-      }
-    }
-
-    // send connected ranks to master
-    utils::MasterSlave::_communication->send(static_cast<int>(_mesh->getConnectedRanks().size()), 0);
-    if (not _mesh->getConnectedRanks().empty()) {
-      utils::MasterSlave::_communication->send(_mesh->getConnectedRanks(), 0);
-    }
   }
 }
 
@@ -533,6 +697,8 @@ void ReceivedPartition::createOwnerInformation()
   */
 
   if (m2n().usesTwoLevelInitialization()) {
+    // Rejected by the configuration
+    PRECICE_ASSERT(_ownership == Ownership::GREEDY, _mesh->getName());
     /*
     This function ensures that each vertex is owned by only a single rank and
     is not shared among ranks. Initially, the vertices are checked against the 
@@ -543,21 +709,13 @@ void ReceivedPartition::createOwnerInformation()
     
     Following steps are taken:
 
-    1- receive local bb map from master
-    2- filter bb map to keep the connected ranks
+    1- route the local bbs to the owners of the cells of a coarse rendezvous grid
+    2- compare the bbs per cell and send each rank only its connected bbs
     3- own the vertices that only fit into this rank's bb
     4- send number of owned vertices and the list of shared vertices to neighbors
     5- for the remaining vertices: check if we have less vertices -> own it!
     */
 
-    // #1: receive local bb map from master
-    // Define and initialize localBBMap to save local bbs
-
-    mesh::Mesh::BoundingBoxMap localBBMap;
-    for (Rank rank = 0; rank < utils::MasterSlave::getSize(); rank++) {
-      localBBMap.emplace(rank, mesh::BoundingBox(_dimensions));
-    }
-
     // Define a bb map to save the local connected ranks and respective boundingboxes
     mesh::Mesh::BoundingBoxMap localConnectedBBMap;
 
@@ -574,34 +732,9 @@ void ReceivedPartition::createOwnerInformation()
     // receive list of possible shared vertices from neighboring ranks
     std::map<int, std::vector<int>> sharedVerticesReceiveMap;
 
-    if (utils::MasterSlave::isMaster()) {
-
-      // Insert masters bounding box
-      localBBMap.at(0) = _bb;
-
-      // master receives local bb from each slave rank
-      for (int rankSlave = 1; rankSlave < utils::MasterSlave::getSize(); rankSlave++) {
-        com::CommunicateBoundingBox(utils::MasterSlave::_communication).receiveBoundingBox(localBBMap.at(rankSlave), rankSlave);
-      }
-
-      // master broadcast localBBMap to all slaves
-      com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastSendBoundingBoxMap(localBBMap);
-    } else if (utils::MasterSlave::isSlave()) {
-      // slaves send local bb to master
-      com::CommunicateBoundingBox(utils::MasterSlave::_communication).sendBoundingBox(_bb, 0);
-      // slaves receive localBBMap from master
-      com::CommunicateBoundingBox(utils::MasterSlave::_communication).broadcastReceiveBoundingBoxMap(localBBMap);
-    }
-
-    // #2: filter bb map to keep the connected ranks
-    // remove the own bb from the map since we compare the own bb only with other ranks bb.
-    localBBMap.erase(utils::MasterSlave::getRank());
-    // find and store local connected ranks
-    for (const auto &localBB : localBBMap) {
-      if (_bb.overlapping(localBB.second)) {
-        localConnectedBBMap.emplace(localBB.first, localBB.second);
-      }
-    }
+    // #1-2: find the connected ranks, neither the master nor any other rank gathers all bbs
+    PRECICE_ASSERT(utils::MasterSlave::isParallel());
+    localConnectedBBMap = com::CommunicateBoundingBox(utils::MasterSlave::_communication).exchangeOverlappingBoundingBoxes(_bb, utils::MasterSlave::getRank(), utils::MasterSlave::getSize());
 
     // #3: check vertices and keep only those that fit into the current rank's bb
     const int numberOfVertices = _mesh->vertices().size();
@@ -747,6 +880,7 @@ void ReceivedPartition::createOwnerInformation()
     if (utils::MasterSlave::isSlave()) {
       int numberOfVertices = _mesh->vertices().size();
       utils::MasterSlave::_communication->send(numberOfVertices, 0);
+      utils::MasterSlave::_communication->send(baseCost(), 0);
 
       if (numberOfVertices != 0) {
         PRECICE_DEBUG("Tag vertices, number of vertices {}", numberOfVertices);
@@ -768,6 +902,10 @@ void ReceivedPartition::createOwnerInformation()
         utils::MasterSlave::_communication->send(tags, 0);
         utils::MasterSlave::_communication->send(globalIDs, 0);
         utils::MasterSlave::_communication->send(atInterface, 0);
+        if (_ownership == Ownership::BALANCED) {
+          PRECICE_DEBUG("Send coordinates");
+          utils::MasterSlave::_communication->send(mesh::packedCoordinates(*_mesh), 0);
+        }
 
         PRECICE_DEBUG("Receive owner information");
         std::vector<int> ownerVec(numberOfVertices, -1);
@@ -787,6 +925,13 @@ void ReceivedPartition::createOwnerInformation()
       std::vector<std::vector<int>> slaveGlobalIDs(utils::MasterSlave::getSize());
       // Tag information per rank
       std::vector<std::vector<int>> slaveTags(utils::MasterSlave::getSize());
+      // Coordinates and costs per rank, only required by the balanced ownership
+      std::vector<std::vector<double>> slaveCoords(utils::MasterSlave::getSize());
+      std::vector<double>              costs(utils::MasterSlave::getSize(), 0.0);
+      costs[0] = baseCost();
+      if (_ownership == Ownership::BALANCED) {
+        slaveCoords[0] = mesh::packedCoordinates(*_mesh);
+      }
 
       // Fill master data
       PRECICE_DEBUG("Tag master vertices");
@@ -812,7 +957,10 @@ void ReceivedPartition::createOwnerInformation()
 
       for (Rank rank : utils::MasterSlave::allSlaves()) {
         int localNumberOfVertices = -1;
+        int localBaseCost         = 0;
         utils::MasterSlave::_communication->receive(localNumberOfVertices, rank);
+        utils::MasterSlave::_communication->receive(localBaseCost, rank);
+        costs[rank] = localBaseCost;
         PRECICE_DEBUG("Rank {} has {} vertices.", rank, localNumberOfVertices);
         slaveOwnerVecs[rank].resize(localNumberOfVertices, 0);
 
@@ -826,6 +974,9 @@ void ReceivedPartition::createOwnerInformation()
           utils::MasterSlave::_communication->receive(atInterface, rank);
           if (atInterface)
             ranksAtInterface++;
+          if (_ownership == Ownership::BALANCED) {
+            utils::MasterSlave::_communication->receive(slaveCoords[rank], rank);
+          }
         }
       }
 
@@ -839,32 +990,47 @@ void ReceivedPartition::createOwnerInformation()
                     "in the mesh or check the definition of the provided meshes.",
                     _mesh->getName());
       PRECICE_ASSERT(ranksAtInterface != 0);
-      int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
-      // First round: every slave gets localGuess vertices
-      for (Rank rank : utils::MasterSlave::allRanks()) {
-        int counter = 0;
-        for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-          // Vertex has no owner yet and rank could be owner
-          if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-            slaveOwnerVecs[rank][i]                 = 1; // Now rank is owner
-            globalOwnerVec[slaveGlobalIDs[rank][i]] = 1; // Vertex now has owner
-            counter++;
-            if (counter == localGuess)
-              break;
+      if (_ownership == Ownership::BALANCED) {
+        PRECICE_DEBUG("Decide owners by balancing the costs in space-filling curve order");
+        assignOwnersBalanced(slaveTags, slaveGlobalIDs, slaveCoords, _dimensions, vertexCost(), costs, slaveOwnerVecs, globalOwnerVec);
+      } else {
+        int localGuess = _mesh->getGlobalNumberOfVertices() / ranksAtInterface; // Guess for a decent load balancing
+        // First round: every slave gets localGuess vertices
+        for (Rank rank : utils::MasterSlave::allRanks()) {
+          int counter = 0;
+          for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
+            // Vertex has no owner yet and rank could be owner
+            if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
+              slaveOwnerVecs[rank][i]                 = 1; // Now rank is owner
+              globalOwnerVec[slaveGlobalIDs[rank][i]] = 1; // Vertex now has owner
+              counter++;
+              if (counter == localGuess)
+                break;
+            }
+          }
+        }
+
+        // Second round: distribute all other vertices in a greedy way
+        PRECICE_DEBUG("Decide owners, second round in greedy way");
+        for (Rank rank : utils::MasterSlave::allRanks()) {
+          for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
+            if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
+              slaveOwnerVecs[rank][i]                 = 1;
+              globalOwnerVec[slaveGlobalIDs[rank][i]] = rank + 1;
+            }
           }
         }
       }
 
-      // Second round: distribute all other vertices in a greedy way
-      PRECICE_DEBUG("Decide owners, second round in greedy way");
+      std::vector<bool> atInterface(utils::MasterSlave::getSize(), false);
       for (Rank rank : utils::MasterSlave::allRanks()) {
-        for (size_t i = 0; i < slaveOwnerVecs[rank].size(); i++) {
-          if (globalOwnerVec[slaveGlobalIDs[rank][i]] == 0 && slaveTags[rank][i] == 1) {
-            slaveOwnerVecs[rank][i]                 = 1;
-            globalOwnerVec[slaveGlobalIDs[rank][i]] = rank + 1;
-          }
+        atInterface[rank] = std::find(slaveTags[rank].begin(), slaveTags[rank].end(), 1) != slaveTags[rank].end();
+        // The balanced assignment already added the owned vertices to the costs
+        if (_ownership == Ownership::GREEDY) {
+          costs[rank] += vertexCost() * std::count(slaveOwnerVecs[rank].begin(), slaveOwnerVecs[rank].end(), 1);
         }
       }
+      reportOwnership(costs, atInterface);
 
       // Send information back to slaves
       for (Rank rank : utils::MasterSlave::allSlaves()) {
@@ -917,10 +1083,56 @@ bool ReceivedPartition::hasAnyMapping() const
   return not(_fromMappings.empty() && _toMappings.empty());
 }
 
+utils::ThreadPool *ReceivedPartition::getMappingThreadPool() const
+{
+  utils::ThreadPool *pool = nullptr;
+  for (const auto &mapping : _fromMappings) {
+    utils::ThreadPool *candidate = mapping->getThreadPool();
+    if (candidate && candidate->size() > (pool ? pool->size() : 1)) {
+      pool = candidate;
+    }
+  }
+  for (const auto &mapping : _toMappings) {
+    utils::ThreadPool *candidate = mapping->getThreadPool();
+    if (candidate && candidate->size() > (pool ? pool->size() : 1)) {
+      pool = candidate;
+    }
+  }
+  return pool;
+}
+
+bool ReceivedPartition::isAnyLocalMeshMoving() const
+{
+  bool isMoving = false;
+  for (const auto &fromMapping : _fromMappings) {
+    isMoving |= fromMapping->getOutputMesh()->isMoving();
+  }
+  for (const auto &toMapping : _toMappings) {
+    isMoving |= toMapping->getInputMesh()->isMoving();
+  }
+  return isMoving;
+}
+
+bool ReceivedPartition::containsLocalMesh(const mesh::Mesh &localMesh) const
+{
+  if (not _boundingBoxPrepared || _mesh->isMoving()) {
+    return true;
+  }
+  bool isLocalMesh = false;
+  for (const auto &fromMapping : _fromMappings) {
+    isLocalMesh |= fromMapping->getOutputMesh().get() == &localMesh;
+  }
+  for (const auto &toMapping : _toMappings) {
+    isLocalMesh |= toMapping->getInputMesh().get() == &localMesh;
+  }
+  return not isLocalMesh || _bb.contains(localMesh.getBoundingBox());
+}
+
 void ReceivedPartition::tagMeshFirstRound()
 {
-  // We want to have every vertex within the box if we access the mesh directly
-  if (_allowDirectAccess) {
+  // We want to have every vertex within the box if we access the mesh directly or if vertices move,
+  // as the mappings may need other vertices after a move
+  if (_allowDirectAccess || _mesh->isMoving() || isAnyLocalMeshMoving()) {
     _mesh->tagAll();
     return;
   }
@@ -936,7 +1148,7 @@ void ReceivedPartition::tagMeshFirstRound()
 void ReceivedPartition::tagMeshSecondRound()
 {
   // We have already tagged every node in this case in the first round
-  if (_allowDirectAccess) {
+  if (_allowDirectAccess || _mesh->isMoving() || isAnyLocalMeshMoving()) {
     return;
   }
 
@@ -948,6 +1160,190 @@ void ReceivedPartition::tagMeshSecondRound()
   }
 }
 
+bool ReceivedPartition::loadFromCache()
+{
+  PRECICE_TRACE();
+  PartitionCache cache(m2n().getPartitionCacheDirectory(), m2n().getLocalParticipantName());
+  if (not cache.isEnabled()) {
+    return false;
+  }
+  PRECICE_ASSERT(not m2n().usesTwoLevelInitialization());
+  Event e("partition.loadFromCache." + _mesh->getName(), precice::syncMode);
+
+  // The key keeps all local bytes, the provided mesh and the other ranks only contribute their hashes
+  utils::Fingerprint local;
+  int                globalNumberOfVertices = -1;
+  if (not utils::MasterSlave::isSlave()) {
+    local.add(receiveFingerprint(*m2n().getMasterCommunication(), 0));
+    m2n().getMasterCommunication()->receive(globalNumberOfVertices, 0);
+  }
+  if (utils::MasterSlave::isMaster()) {
+    utils::MasterSlave::_communication->broadcast(globalNumberOfVertices);
+  } else if (utils::MasterSlave::isSlave()) {
+    utils::MasterSlave::_communication->broadcast(globalNumberOfVertices, 0);
+  }
+  local.add(_geometricFilter);
+  local.add(_safetyFactor);
+  local.add(_ownership);
+  local.add(_ownershipCost);
+  local.add(_allowDirectAccess);
+  local.add(_mesh->isMoving());
+  local.add(isAnyLocalMeshMoving());
+  if (_allowDirectAccess) {
+    for (double bound : _mesh->getBoundingBox().dataVector()) {
+      local.add(bound);
+    }
+  }
+  for (const mapping::PtrMapping &fromMapping : _fromMappings) {
+    local.add(std::string(typeid(*fromMapping).name()));
+    local.add(fromMapping->getConstraint());
+    for (double parameter : fromMapping->getTaggingParameters()) {
+      local.add(parameter);
+    }
+    addMeshToFingerprint(local, *fromMapping->getOutputMesh());
+  }
+  for (const mapping::PtrMapping &toMapping : _toMappings) {
+    local.add(std::string(typeid(*toMapping).name()));
+    local.add(toMapping->getConstraint());
+    for (double parameter : toMapping->getTaggingParameters()) {
+      local.add(parameter);
+    }
+    addMeshToFingerprint(local, *toMapping->getInputMesh());
+  }
+  local.add(combineFingerprints(local.value()));
+  _cacheKey = std::move(local);
+
+  std::vector<double>              taggingState;
+  std::vector<std::vector<double>> mappingStates;
+  int                              misses = cache.load(_cacheKey, *_mesh, globalNumberOfVertices, taggingState) && splitTaggingState(taggingState, mappingStates) ? 0 : 1;
+  if (utils::MasterSlave::isMaster()) {
+    int totalMisses = 0;
+    utils::MasterSlave::_communication->allreduceSum(misses, totalMisses);
+    misses = totalMisses;
+  } else if (utils::MasterSlave::isSlave()) {
+    int totalMisses = 0;
+    utils::MasterSlave::_communication->allreduceSum(misses, totalMisses, 0);
+    misses = totalMisses;
+  }
+  _loadedFromCache = misses == 0;
+
+  // The providing participant only sends the mesh if the partition could not be loaded
+  if (not utils::MasterSlave::isSlave()) {
+    m2n().getMasterCommunication()->send(_loadedFromCache, 0);
+  }
+
+  if (_loadedFromCache) {
+    PRECICE_INFO("Loaded the partition of mesh {} from the cache", _mesh->getName());
+    // The mappings need what they computed while tagging, for instance the cluster grid of the unfiltered mesh
+    auto state = mappingStates.begin();
+    for (const mapping::PtrMapping &fromMapping : _fromMappings) {
+      fromMapping->setTaggingState(*state++);
+    }
+    for (const mapping::PtrMapping &toMapping : _toMappings) {
+      toMapping->setTaggingState(*state++);
+    }
+  } else {
+    PRECICE_INFO("No cached partition of mesh {} found on {} rank(s), the mesh is re-partitioned", _mesh->getName(), misses);
+    _mesh->clear();
+    _mesh->clearPartitioning();
+  }
+  return _loadedFromCache;
+}
+
+void ReceivedPartition::storeInCache() const
+{
+  if (_m2ns.empty() || _m2ns[0]->getPartitionCacheDirectory().empty()) {
+    return;
+  }
+  Event e("partition.storeInCache." + _mesh->getName());
+  PartitionCache(_m2ns[0]->getPartitionCacheDirectory(), _m2ns[0]->getLocalParticipantName()).store(_cacheKey, *_mesh, getTaggingState());
+}
+
+std::vector<double> ReceivedPartition::getTaggingState() const
+{
+  std::vector<double> state;
+  auto                append = [&state](const mapping::PtrMapping &mapping) {
+    const auto mappingState = mapping->getTaggingState();
+    state.push_back(mappingState.size());
+    state.insert(state.end(), mappingState.begin(), mappingState.end());
+  };
+  std::for_each(_fromMappings.begin(), _fromMappings.end(), append);
+  std::for_each(_toMappings.begin(), _toMappings.end(), append);
+  return state;
+}
+
+bool ReceivedPartition::splitTaggingState(const std::vector<double> &state, std::vector<std::vector<double>> &states) const
+{
+  states.clear();
+  std::size_t position = 0;
+  while (position < state.size()) {
+    const double size = state[position++];
+    if (not(size >= 0.0 && size <= static_cast<double>(state.size() - position))) {
+      return false;
+    }
+    states.emplace_back(state.begin() + position, state.begin() + position + static_cast<std::size_t>(size));
+    position += static_cast<std::size_t>(size);
+  }
+  return states.size() == _fromMappings.size() + _toMappings.size();
+}
+
+void ReceivedPartition::setOwnership(Ownership ownership, OwnershipCost cost)
+{
+  _ownership     = ownership;
+  _ownershipCost = cost;
+}
+
+int ReceivedPartition::vertexCost() const
+{
+  if (_ownershipCost != OwnershipCost::DATA) {
+    return 1;
+  }
+  int cost = 0;
+  for (const mesh::PtrData &data : _mesh->data()) {
+    cost += data->getDimensions();
+  }
+  return std::max(cost, 1);
+}
+
+int ReceivedPartition::baseCost() const
+{
+  if (_ownershipCost != OwnershipCost::MAPPING_ROWS) {
+    return 0;
+  }
+  int cost = 0;
+  for (const mapping::PtrMapping &fromMapping : _fromMappings) {
+    cost += fromMapping->getOutputMesh()->vertices().size();
+  }
+  for (const mapping::PtrMapping &toMapping : _toMappings) {
+    cost += toMapping->getInputMesh()->vertices().size();
+  }
+  return cost;
+}
+
+void ReceivedPartition::reportOwnership(const std::vector<double> &costs, const std::vector<bool> &atInterface)
+{
+  PRECICE_ASSERT(costs.size() == atInterface.size());
+  double maxCost = 0.0;
+  double sumCost = 0.0;
+  int    ranks   = 0;
+  for (std::size_t rank = 0; rank < costs.size(); ++rank) {
+    if (atInterface[rank]) {
+      maxCost = std::max(maxCost, costs[rank]);
+      sumCost += costs[rank];
+      ++ranks;
+    }
+  }
+  const double meanCost  = ranks == 0 ? 0.0 : sumCost / ranks;
+  const int    imbalance = meanCost == 0.0 ? 100 : static_cast<int>(100.0 * maxCost / meanCost);
+
+  utils::Event e("partition.ownership." + _mesh->getName());
+  e.addData("maxCost", static_cast<int>(maxCost));
+  e.addData("meanCost", static_cast<int>(meanCost));
+  e.addData("imbalancePercent", imbalance);
+  PRECICE_INFO("Ownership of mesh \"{}\": maximal cost {}, mean cost {}, imbalance {}%",
+               _mesh->getName(), maxCost, meanCost, imbalance);
+}
+
 void ReceivedPartition::setOwnerInformation(const std::vector<int> &ownerVec)
 {
   size_t i = 0;
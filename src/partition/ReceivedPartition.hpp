@@ -8,11 +8,15 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Vertex.hpp"
+#include "utils/Fingerprint.hpp"
 
 namespace precice {
 namespace m2n {
 class M2N;
 } // namespace m2n
+namespace utils {
+class ThreadPool;
+} // namespace utils
 
 namespace partition {
 
@@ -39,6 +43,24 @@ public:
     ON_SLAVES
   };
 
+  /// Defines how the owners of vertices shared by several ranks are decided
+  enum class Ownership {
+    /// Every rank first owns an even share of its vertices, the remaining vertices are assigned greedily
+    GREEDY,
+    /// Shared vertices are assigned in space-filling curve order to the rank with the lowest cost so far
+    BALANCED
+  };
+
+  /// Defines the cost of a rank, which is balanced by Ownership::BALANCED
+  enum class OwnershipCost {
+    /// Every owned vertex costs one
+    VERTICES,
+    /// Every owned vertex costs one, the vertices of the local meshes of the mappings are added as mapping rows
+    MAPPING_ROWS,
+    /// Every owned vertex costs the sum of the dimensions of the data of the mesh
+    DATA
+  };
+
   /// Constructor
   ReceivedPartition(const mesh::PtrMesh &mesh, GeometricFilter geometricFilter, double safetyFactor, bool allowDirectAccess = false);
 
@@ -50,6 +72,19 @@ public:
 
   void compareBoundingBoxes() override;
 
+  /// Sets how the owners of shared vertices are decided, balancing is only supported by one-level initialization
+  void setOwnership(Ownership ownership, OwnershipCost cost);
+
+  /**
+   * @brief Checks whether a local mesh of the mappings still lies inside the bounding box the received mesh was filtered to.
+   *
+   * Vertices of the local meshes may be moved after compute(), but the received mesh is not filtered again.
+   * Within the bounding box, the received mesh keeps all vertices if a local mesh is moving.
+   *
+   * @returns true if the received mesh was not filtered or if localMesh is no local mesh of the mappings
+   */
+  bool containsLocalMesh(const mesh::Mesh &localMesh) const;
+
 private:
   /// return the one m2n, a ReceivedPartition can only have one m2n
   m2n::M2N &m2n();
@@ -69,6 +104,17 @@ private:
   /// Returns whether any mapping is defined
   bool hasAnyMapping() const;
 
+  /// Returns the largest thread pool of the mappings, nullptr if all mappings are computed serially
+  utils::ThreadPool *getMappingThreadPool() const;
+
+  /**
+   * @brief Returns whether any provided mesh the received mesh is mapped from or to is moving.
+   *
+   * After a move, the mappings may need any vertex within the bounding box, hence the received
+   * mesh is then only filtered by the bounding box, but not by the mappings.
+   */
+  bool isAnyLocalMeshMoving() const;
+
   /// Tag mesh in first round accoring to all mappings
   void tagMeshFirstRound();
 
@@ -80,6 +126,42 @@ private:
   /// Helper function for 'createOwnerFunction' to set local owner information
   void setOwnerInformation(const std::vector<int> &ownerVec);
 
+  /**
+   * @brief Loads the partition from the partition cache of the m2n, if it is enabled.
+   *
+   * Collective over all ranks and with the providing participant, which skips sending the mesh
+   * if the partition is loaded. The cache key consists of the partitioning options and the local
+   * meshes and tagging parameters of the mappings, followed by the combined hash of these keys of
+   * all ranks and the fingerprint of the provided mesh. Loaded partitions also have to match the
+   * size of the provided mesh. The mappings then restore the state they computed while tagging,
+   * as compute() skips the tagging.
+   *
+   * @returns true if all ranks loaded their partition
+   */
+  bool loadFromCache();
+
+  /// Stores the partition and the tagging state of the mappings in the partition cache of the m2n, if it is enabled
+  void storeInCache() const;
+
+  /// Concatenates the tagging states of all mappings, each preceded by its size
+  std::vector<double> getTaggingState() const;
+
+  /**
+   * @brief Splits a state of getTaggingState() into the states of the mappings.
+   *
+   * @returns false if the state does not consist of exactly one state per mapping
+   */
+  bool splitTaggingState(const std::vector<double> &state, std::vector<std::vector<double>> &states) const;
+
+  /// Returns the cost of owning a single vertex
+  int vertexCost() const;
+
+  /// Returns the cost of this rank which does not depend on the owned vertices
+  int baseCost() const;
+
+  /// Reports the balance of the costs of all ranks with vertices at the interface, called on the master
+  void reportOwnership(const std::vector<double> &costs, const std::vector<bool> &atInterface);
+
   /// Is the local other (i.e. provided) bounding box already prepared (i.e. has prepareBoundingBox() been called)
   bool _boundingBoxPrepared = false;
 
@@ -93,6 +175,16 @@ private:
 
   bool _allowDirectAccess;
 
+  Ownership _ownership = Ownership::GREEDY;
+
+  OwnershipCost _ownershipCost = OwnershipCost::VERTICES;
+
+  /// Key of the partition in the partition cache
+  utils::Fingerprint _cacheKey;
+
+  /// Is the partition loaded from the partition cache (i.e. compute() has nothing to do)
+  bool _loadedFromCache = false;
+
   logging::Logger _log{"partition::ReceivedPartition"};
 
   /// Max global vertex IDs of remote connected ranks
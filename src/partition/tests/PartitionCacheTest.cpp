@@ -0,0 +1,219 @@
+#include <Eigen/Core>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "com/Communication.hpp"
+#include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
+#include "mesh/Triangle.hpp"
+#include "mesh/Vertex.hpp"
+#include "partition/PartitionCache.hpp"
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Fingerprint.hpp"
+#include "utils/MasterSlave.hpp"
+
+using namespace precice;
+using namespace precice::partition;
+using precice::testing::TestContext;
+
+BOOST_AUTO_TEST_SUITE(PartitionTests)
+BOOST_AUTO_TEST_SUITE(PartitionCacheTests)
+
+namespace {
+void createMesh(mesh::Mesh &mesh)
+{
+  auto &v0 = mesh.createVertex(Eigen::Vector3d(0.0, 0.0, 0.0));
+  auto &v1 = mesh.createVertex(Eigen::Vector3d(1.0, 0.0, 0.0));
+  auto &v2 = mesh.createVertex(Eigen::Vector3d(0.0, 1.0, 0.5));
+  v0.setGlobalIndex(4);
+  v1.setGlobalIndex(5);
+  v2.setGlobalIndex(7);
+  v0.setOwner(false);
+  v1.setOwner(true);
+  v2.tag();
+  auto &e0 = mesh.createEdge(v0, v1);
+  auto &e1 = mesh.createEdge(v1, v2);
+  auto &e2 = mesh.createEdge(v2, v0);
+  mesh.createTriangle(e0, e1, e2);
+  mesh.getVertexOffsets()      = {2, 5};
+  mesh.getVertexDistribution() = {{0, {0, 1}}, {1, {4, 5, 7}}};
+  mesh.setGlobalNumberOfVertices(8);
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Fingerprint)
+{
+  PRECICE_TEST(1_rank);
+  mesh::Mesh mesh("Mesh", 3, testing::nextMeshID());
+  createMesh(mesh);
+  const auto original = fingerprint(mesh);
+
+  mesh::Mesh other("Mesh", 3, testing::nextMeshID());
+  createMesh(other);
+  BOOST_TEST(fingerprint(other) == original);
+
+  // Edges are part of the fingerprint
+  other.createEdge(other.vertices()[0], other.vertices()[2]);
+  BOOST_TEST(fingerprint(other) != original);
+}
+
+BOOST_AUTO_TEST_CASE(CombineFingerprints)
+{
+  PRECICE_TEST(""_on(2_ranks).setupMasterSlaves());
+  const auto combined = combineFingerprints(context.rank == 0 ? 1 : 2);
+
+  // Every rank gets the same result, which depends on the order of the ranks
+  const std::vector<int> own{static_cast<int>(combined), static_cast<int>(combined >> 32)};
+  if (context.isMaster()) {
+    utils::MasterSlave::_communication->broadcast(own);
+  } else {
+    std::vector<int> master;
+    utils::MasterSlave::_communication->broadcast(master, 0);
+    BOOST_TEST(own == master, boost::test_tools::per_element());
+  }
+  BOOST_TEST(combineFingerprints(context.rank == 0 ? 2 : 1) != combined);
+}
+
+BOOST_AUTO_TEST_CASE(StoreAndLoad)
+{
+  PRECICE_TEST(1_rank);
+  const std::string directory = "partition-cache-unit-test";
+  boost::filesystem::remove_all(directory);
+
+  PartitionCache cache(directory, "Participant");
+  BOOST_TEST(cache.isEnabled());
+  BOOST_TEST(not PartitionCache().isEnabled());
+  BOOST_TEST(cache.filename("Mesh", 0) == directory + "/partition-Participant-Mesh-0.bin");
+
+  mesh::Mesh mesh("Mesh", 3, testing::nextMeshID());
+  createMesh(mesh);
+
+  utils::Fingerprint key;
+  key.add(42);
+  utils::Fingerprint otherKey;
+  otherKey.add(43);
+
+  const std::vector<double> state{1.5, 2.5};
+  std::vector<double>       loadedState;
+
+  mesh::Mesh missing("Mesh", 3, testing::nextMeshID());
+  BOOST_TEST(not cache.load(key, missing, 8, loadedState));
+  cache.store(key, mesh, state);
+  BOOST_TEST(boost::filesystem::exists(cache.filename("Mesh", 0)));
+
+  // Other participants use their own files
+  BOOST_TEST(not PartitionCache(directory, "Other").load(key, missing, 8, loadedState));
+
+  mesh::Mesh loaded("Mesh", 3, testing::nextMeshID());
+  BOOST_TEST(cache.load(key, loaded, 8, loadedState));
+  BOOST_TEST(loaded == mesh);
+  BOOST_TEST(loadedState == state, boost::test_tools::per_element());
+  BOOST_TEST(loaded.vertices().size() == 3);
+  BOOST_TEST(loaded.vertices()[2].getGlobalIndex() == 7);
+  BOOST_TEST(loaded.vertices()[1].isOwner());
+  BOOST_TEST(not loaded.vertices()[0].isOwner());
+  BOOST_TEST(loaded.vertices()[2].isTagged());
+  BOOST_TEST(loaded.getVertexOffsets() == mesh.getVertexOffsets(), boost::test_tools::per_element());
+  BOOST_TEST((loaded.getVertexDistribution() == mesh.getVertexDistribution()));
+  BOOST_TEST(loaded.getGlobalNumberOfVertices() == 8);
+
+  // Different keys are rejected
+  mesh::Mesh rejected("Mesh", 3, testing::nextMeshID());
+  BOOST_TEST(not cache.load(otherKey, rejected, 8, loadedState));
+  BOOST_TEST(rejected.vertices().empty());
+
+  // Keys with the same hash but different bytes are rejected
+  {
+    const std::string file = cache.filename("Mesh", 0);
+    std::fstream      stream(file, std::ios::binary | std::ios::in | std::ios::out);
+    // The key follows the header of 88 bytes
+    stream.seekp(88);
+    const int value = 43;
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(int));
+  }
+  BOOST_TEST(not cache.load(key, rejected, 8, loadedState));
+  BOOST_TEST(rejected.vertices().empty());
+  cache.store(key, mesh, state);
+
+  // Partitions of provided meshes of a different size are rejected
+  BOOST_TEST(not cache.load(key, rejected, 7, loadedState));
+  BOOST_TEST(rejected.vertices().empty());
+
+  // Out of range indices are rejected, the edges start before the triangles, offsets, and distribution
+  const std::string file  = cache.filename("Mesh", 0);
+  const auto        bytes = boost::filesystem::file_size(file);
+  {
+    std::fstream stream(file, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(bytes - (6 + 3 + 2 + 9) * sizeof(int));
+    const int vertex = 3;
+    stream.write(reinterpret_cast<const char *>(&vertex), sizeof(int));
+  }
+  BOOST_TEST(not cache.load(key, rejected, 8, loadedState));
+  BOOST_TEST(rejected.vertices().empty());
+
+  // Truncated files are rejected
+  cache.store(key, mesh, state);
+  mesh::Mesh reloaded("Mesh", 3, testing::nextMeshID());
+  BOOST_TEST(cache.load(key, reloaded, 8, loadedState));
+  boost::filesystem::resize_file(file, bytes - 4);
+  BOOST_TEST(not cache.load(key, rejected, 8, loadedState));
+  BOOST_TEST(rejected.vertices().empty());
+
+  boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_CASE(StoreAndLoadCommunicationMap)
+{
+  PRECICE_TEST(1_rank);
+  const std::string directory = "communication-map-cache-unit-test";
+  boost::filesystem::remove_all(directory);
+
+  PartitionCache cache(directory, "Participant");
+  BOOST_TEST(cache.communicationMapFilename("Mesh", 0) == directory + "/communication-Participant-Mesh-0.bin");
+
+  utils::Fingerprint key;
+  key.add(42);
+  utils::Fingerprint otherKey;
+  otherKey.add(43);
+
+  const PartitionCache::CommunicationMap communicationMap{{1, {0, 2}}, {3, {1, 2, 4}}};
+  PartitionCache::CommunicationMap       loaded;
+  BOOST_TEST(not cache.loadCommunicationMap(key, "Mesh", 5, loaded));
+  cache.storeCommunicationMap(key, "Mesh", 5, communicationMap);
+  BOOST_TEST(boost::filesystem::exists(cache.communicationMapFilename("Mesh", 0)));
+
+  BOOST_TEST(cache.loadCommunicationMap(key, "Mesh", 5, loaded));
+  BOOST_TEST((loaded == communicationMap));
+
+  // Different keys, meshes, and numbers of vertices are rejected
+  PartitionCache::CommunicationMap rejected;
+  BOOST_TEST(not cache.loadCommunicationMap(otherKey, "Mesh", 5, rejected));
+  BOOST_TEST(not cache.loadCommunicationMap(key, "Other", 5, rejected));
+  BOOST_TEST(not cache.loadCommunicationMap(key, "Mesh", 4, rejected));
+  BOOST_TEST(rejected.empty());
+
+  // Out of range indices are rejected
+  const std::string file  = cache.communicationMapFilename("Mesh", 0);
+  const auto        bytes = boost::filesystem::file_size(file);
+  {
+    std::fstream stream(file, std::ios::binary | std::ios::in | std::ios::out);
+    stream.seekp(bytes - sizeof(int));
+    const int vertex = 5;
+    stream.write(reinterpret_cast<const char *>(&vertex), sizeof(int));
+  }
+  BOOST_TEST(not cache.loadCommunicationMap(key, "Mesh", 5, rejected));
+  BOOST_TEST(rejected.empty());
+
+  // Truncated files are rejected
+  cache.storeCommunicationMap(key, "Mesh", 5, communicationMap);
+  boost::filesystem::resize_file(file, bytes - 4);
+  BOOST_TEST(not cache.loadCommunicationMap(key, "Mesh", 5, rejected));
+  BOOST_TEST(rejected.empty());
+
+  boost::filesystem::remove_all(directory);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // PartitionCacheTests
+BOOST_AUTO_TEST_SUITE_END() // PartitionTests
@@ -2,6 +2,8 @@
 
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/filesystem.hpp>
+#include <cmath>
 #include <map>
 #include <memory>
 #include <string>
@@ -18,6 +20,7 @@
 #include "mapping/Mapping.hpp"
 #include "mapping/NearestNeighborMapping.hpp"
 #include "mapping/NearestProjectionMapping.hpp"
+#include "mapping/PartitionOfUnityMapping.hpp"
 #include "mapping/PetRadialBasisFctMapping.hpp"
 #include "mapping/SharedPointer.hpp"
 #include "mapping/impl/BasisFunctions.hpp"
@@ -34,6 +37,7 @@
 #include "precice/types.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/MasterSlave.hpp"
 #include "utils/assertion.hpp"
 
 namespace precice {
@@ -293,6 +297,164 @@ BOOST_AUTO_TEST_CASE(RePartitionNNBroadcastFilter2D)
   tearDownParallelEnvironment();
 }
 
+BOOST_AUTO_TEST_CASE(ContainsMovedLocalMesh2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pOtherMesh(new mesh::Mesh("OtherMesh", dimensions, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+
+    createNastinMesh2D(pNastinMesh, context.rank);
+    pOtherMesh->createVertex(Eigen::Vector2d(10.0, 10.0));
+    pOtherMesh->computeBoundingBox();
+
+    double safetyFactor = 0.1;
+
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_SLAVES, safetyFactor);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    BOOST_TEST(part.containsLocalMesh(*pNastinMesh));
+    // Meshes which are not mapped do not depend on the filtering
+    BOOST_TEST(part.containsLocalMesh(*pOtherMesh));
+
+    if (context.isMaster()) {
+      // The bounding box (0,0) to (0,2) was scaled by the safety factor to (-0.2,-0.2) to (0.2,2.2)
+      pNastinMesh->vertices()[1].setCoords(Eigen::Vector2d(0.1, 2.1));
+      pNastinMesh->computeBoundingBox();
+      BOOST_TEST(part.containsLocalMesh(*pNastinMesh));
+
+      pNastinMesh->vertices()[1].setCoords(Eigen::Vector2d(0.0, 3.0));
+      pNastinMesh->computeBoundingBox();
+      BOOST_TEST(not part.containsLocalMesh(*pNastinMesh));
+    }
+  }
+
+  tearDownParallelEnvironment();
+}
+
+BOOST_AUTO_TEST_CASE(RePartitionMovingLocalMesh2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    pNastinMesh->setMoving(true);
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+
+    createNastinMesh2D(pNastinMesh, context.rank);
+
+    double safetyFactor = 0.1;
+
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_SLAVES, safetyFactor);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    // The moved vertices may need any vertex within the bounding box, not only the nearest neighbors of the initial positions
+    BOOST_TEST_CONTEXT(*pSolidzMesh)
+    {
+      if (context.isMaster()) { //Master
+        BOOST_TEST(pSolidzMesh->vertices().size() == 3);
+        BOOST_TEST(pSolidzMesh->edges().size() == 2);
+      } else if (context.isRank(1)) { //Slave1
+        BOOST_TEST(pSolidzMesh->vertices().size() == 0);
+      } else if (context.isRank(2)) { //Slave2
+        BOOST_TEST(pSolidzMesh->vertices().size() == 3);
+        BOOST_TEST(pSolidzMesh->edges().size() == 2);
+      }
+    }
+  }
+
+  tearDownParallelEnvironment();
+}
+
+BOOST_AUTO_TEST_CASE(RePartitionMovingReceivedMesh2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) { //SOLIDZ
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    createSolidzMesh2D(pSolidzMesh);
+    ProvidedPartition part(pSolidzMesh);
+    part.addM2N(m2n);
+    part.communicate();
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pNastinMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pSolidzMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+    pSolidzMesh->setMoving(true);
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pSolidzMesh, pNastinMesh);
+
+    createNastinMesh2D(pNastinMesh, context.rank);
+
+    double safetyFactor = 0.1;
+
+    ReceivedPartition part(pSolidzMesh, ReceivedPartition::ON_SLAVES, safetyFactor);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    // The vertices of the received mesh may move anywhere, hence every rank keeps all of them
+    BOOST_TEST(pSolidzMesh->vertices().size() == 6);
+    BOOST_TEST(pSolidzMesh->edges().size() == 5);
+    int owned = 0;
+    for (const mesh::Vertex &vertex : pSolidzMesh->vertices()) {
+      owned += vertex.isOwner() ? 1 : 0;
+    }
+    int totalOwned = 0;
+    utils::MasterSlave::allreduceSum(owned, totalOwned);
+    BOOST_TEST(totalOwned == 6);
+
+    // Moving the local mesh anywhere keeps the received mesh complete
+    pNastinMesh->createVertex(Eigen::Vector2d(10.0, 10.0));
+    pNastinMesh->computeBoundingBox();
+    BOOST_TEST(part.containsLocalMesh(*pNastinMesh));
+  }
+
+  tearDownParallelEnvironment();
+}
+
 BOOST_AUTO_TEST_CASE(RePartitionNNDoubleNode2D)
 {
   PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
@@ -864,6 +1026,305 @@ BOOST_AUTO_TEST_CASE(TestRepartitionAndDistribution2D)
   }
 }
 
+BOOST_AUTO_TEST_CASE(TestRepartitionWithMappingThreads2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) { //SOLIDZ
+    mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    Eigen::VectorXd position(dimensions);
+    position << 0.0, 0.0;
+    pMesh->createVertex(position);
+    position << 1.0, 0.0;
+    pMesh->createVertex(position);
+    position << 2.0, 0.0;
+    pMesh->createVertex(position);
+
+    pMesh->computeBoundingBox();
+
+    ProvidedPartition part(pMesh);
+    part.addM2N(m2n);
+    part.communicate();
+
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pOtherMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions, 2));
+    boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+    if (context.isMaster()) { //Master
+      Eigen::VectorXd position(dimensions);
+      position << 0.0, 0.0;
+      pOtherMesh->createVertex(position);
+      position << 0.8, 0.0;
+      pOtherMesh->createVertex(position);
+    } else if (context.isRank(1)) { //Slave2
+      Eigen::VectorXd position(dimensions);
+      position << 1.0, 0.0;
+      pOtherMesh->createVertex(position);
+      position << 1.2, 0.0;
+      pOtherMesh->createVertex(position);
+    } else if (context.isRank(2)) { //Slave3
+      // no vertices
+    }
+
+    pOtherMesh->computeBoundingBox();
+
+    // The master pre-filters with the threads of the mapping
+    double            safetyFactor = 20.0;
+    ReceivedPartition part(pMesh, ReceivedPartition::ON_MASTER, safetyFactor);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    BOOST_TEST(pMesh->getVertexOffsets().size() == 3);
+    BOOST_TEST(pMesh->getVertexOffsets().at(0) == 2);
+    BOOST_TEST(pMesh->getVertexOffsets().at(1) == 3);
+    BOOST_TEST(pMesh->getVertexOffsets().at(2) == 3);
+
+    if (context.isMaster()) { //Master
+      BOOST_TEST(pMesh->getVertexDistribution().at(0).size() == 2);
+      BOOST_TEST(pMesh->getVertexDistribution().at(1).size() == 1);
+      BOOST_TEST(pMesh->getVertexDistribution().at(2).size() == 0);
+      BOOST_TEST(pMesh->getVertexDistribution().at(0).at(0) == 0);
+      BOOST_TEST(pMesh->getVertexDistribution().at(0).at(1) == 1);
+      BOOST_TEST(pMesh->getVertexDistribution().at(1).at(0) == 1);
+      BOOST_TEST(pMesh->vertices().size() == 2);
+      BOOST_TEST(pMesh->vertices().at(0).getGlobalIndex() == 0);
+      BOOST_TEST(pMesh->vertices().at(1).getGlobalIndex() == 1);
+      BOOST_TEST(pMesh->vertices().at(0).isOwner() == true);
+      BOOST_TEST(pMesh->vertices().at(1).isOwner() == false);
+    } else if (context.isRank(1)) { //Slave2
+      BOOST_TEST(pMesh->vertices().size() == 1);
+      BOOST_TEST(pMesh->vertices().at(0).getGlobalIndex() == 1);
+      BOOST_TEST(pMesh->vertices().at(0).isOwner() == true);
+    } else if (context.isRank(2)) { //Slave3
+      BOOST_TEST(pMesh->vertices().size() == 0);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPartitionCache2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  const std::string           directory = "partition-cache-test";
+  testing::ConnectionOptions options;
+  options.partitionCacheDirectory = directory;
+  auto m2n                        = context.connectMasters("Solid", "Fluid", options);
+
+  int dimensions = 2;
+
+  if (context.isNamed("Fluid") && context.isMaster()) {
+    boost::filesystem::remove_all(directory);
+  }
+
+  // The second run loads the partition of the first run
+  std::vector<mesh::Mesh::VertexDistribution> distributions;
+  std::vector<std::vector<int>>               globalIndices;
+  std::vector<std::vector<bool>>              owners;
+  for (int run = 0; run < 2; ++run) {
+    if (context.isNamed("Solid")) {
+      mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+      for (int i = 0; i < 4; i++) {
+        pMesh->createVertex(Eigen::Vector2d(i, 0.0));
+      }
+      pMesh->createEdge(pMesh->vertices()[0], pMesh->vertices()[1]);
+      pMesh->computeBoundingBox();
+
+      ProvidedPartition part(pMesh);
+      part.addM2N(m2n);
+      part.communicate();
+
+    } else {
+      BOOST_TEST(context.isNamed("Fluid"));
+      mesh::PtrMesh pMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+      mesh::PtrMesh pOtherMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+      mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+          new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+      boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+      if (not context.isRank(2)) {
+        pOtherMesh->createVertex(Eigen::Vector2d(context.rank, 0.0));
+        pOtherMesh->createVertex(Eigen::Vector2d(context.rank + 1.0, 0.0));
+      }
+      pOtherMesh->computeBoundingBox();
+
+      ReceivedPartition part(pMesh, ReceivedPartition::ON_MASTER, 20.0);
+      part.addM2N(m2n);
+      part.addFromMapping(boundingFromMapping);
+      part.communicate();
+      part.compute();
+
+      distributions.push_back(pMesh->getVertexDistribution());
+      globalIndices.emplace_back();
+      owners.emplace_back();
+      for (const mesh::Vertex &vertex : pMesh->vertices()) {
+        globalIndices.back().push_back(vertex.getGlobalIndex());
+        owners.back().push_back(vertex.isOwner());
+      }
+      BOOST_TEST(pMesh->getVertexOffsets() == std::vector<int>({2, 4, 4}), boost::test_tools::per_element());
+      BOOST_TEST(pMesh->getGlobalNumberOfVertices() == 4);
+      BOOST_TEST(pMesh->edges().size() == (context.isMaster() ? 1 : 0));
+      if (run == 0) {
+        BOOST_TEST(boost::filesystem::exists(directory + "/partition-Fluid-NastinMesh-" + std::to_string(context.rank) + ".bin"));
+      }
+    }
+  }
+
+  if (context.isNamed("Fluid")) {
+    BOOST_TEST((distributions[0] == distributions[1]));
+    BOOST_TEST(globalIndices[0] == globalIndices[1], boost::test_tools::per_element());
+    BOOST_TEST(owners[0] == owners[1], boost::test_tools::per_element());
+    if (context.isMaster()) {
+      boost::filesystem::remove_all(directory);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestPartitionCacheMapping2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  const std::string           directory = "partition-cache-mapping-test";
+  testing::ConnectionOptions options;
+  options.partitionCacheDirectory = directory;
+  auto m2n                        = context.connectMasters("Solid", "Fluid", options);
+
+  int dimensions = 2;
+
+  if (context.isNamed("Fluid") && context.isMaster()) {
+    boost::filesystem::remove_all(directory);
+  }
+
+  // The cluster grid of the second run has to be the one of the unfiltered mesh of the first run
+  std::vector<std::vector<double>> results;
+  for (int run = 0; run < 2; ++run) {
+    if (context.isNamed("Solid")) {
+      mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+      // The spacing grows along x, the filtered meshes of the small local meshes thus yield other cluster radii
+      for (int i = 0; i < 13; i++) {
+        for (int j = 0; j < 5; j++) {
+          pMesh->createVertex(Eigen::Vector2d(3.0 * (i / 12.0) * (i / 12.0), 0.25 * j));
+        }
+      }
+      pMesh->computeBoundingBox();
+
+      ProvidedPartition part(pMesh);
+      part.addM2N(m2n);
+      part.communicate();
+
+    } else {
+      BOOST_TEST(context.isNamed("Fluid"));
+      mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+      mesh::PtrMesh pOtherMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+      mesh::PtrData inData  = pMesh->createData("Data", 1);
+      mesh::PtrData outData = pOtherMesh->createData("Data", 1);
+
+      mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+          new mapping::PartitionOfUnityMapping<mapping::ThinPlateSplines>(mapping::Mapping::CONSISTENT, dimensions, mapping::ThinPlateSplines(), false, false, false, 6, 0.3));
+      boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+      for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 4; j++) {
+          pOtherMesh->createVertex(Eigen::Vector2d(0.9 * context.rank + 0.05 * i + 0.05, 0.1 * j + 0.05));
+        }
+      }
+      pOtherMesh->computeBoundingBox();
+
+      ReceivedPartition part(pMesh, ReceivedPartition::NO_FILTER, 0.1);
+      part.addM2N(m2n);
+      part.addFromMapping(boundingFromMapping);
+      part.communicate();
+      part.compute();
+      BOOST_TEST(pMesh->getGlobalNumberOfVertices() == 65);
+
+      pMesh->allocateDataValues();
+      pOtherMesh->allocateDataValues();
+      for (const mesh::Vertex &vertex : pMesh->vertices()) {
+        inData->values()[vertex.getID()] = std::sin(vertex.getCoords()[0]) * std::exp(vertex.getCoords()[1]);
+      }
+      boundingFromMapping->computeMapping();
+      boundingFromMapping->map(inData->getID(), outData->getID());
+      results.emplace_back(outData->values().data(), outData->values().data() + outData->values().size());
+    }
+  }
+
+  if (context.isNamed("Fluid")) {
+    BOOST_TEST(results[0].size() == 20);
+    BOOST_TEST(results[0] == results[1], boost::test_tools::per_element());
+    if (context.isMaster()) {
+      boost::filesystem::remove_all(directory);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestBalancedOwnership2D)
+{
+  PRECICE_TEST("Solid"_on(1_rank), "Fluid"_on(3_ranks).setupMasterSlaves(), Require::Events);
+  auto m2n = context.connectMasters("Solid", "Fluid");
+
+  int dimensions = 2;
+
+  if (context.isNamed("Solid")) {
+    mesh::PtrMesh pMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    for (int i = 0; i < 6; i++) {
+      pMesh->createVertex(Eigen::Vector2d(i, 0.0));
+    }
+    pMesh->computeBoundingBox();
+
+    ProvidedPartition part(pMesh);
+    part.addM2N(m2n);
+    part.communicate();
+
+  } else {
+    BOOST_TEST(context.isNamed("Fluid"));
+    mesh::PtrMesh pMesh(new mesh::Mesh("NastinMesh", dimensions, testing::nextMeshID()));
+    mesh::PtrMesh pOtherMesh(new mesh::Mesh("SolidzMesh", dimensions, testing::nextMeshID()));
+
+    mapping::PtrMapping boundingFromMapping = mapping::PtrMapping(
+        new mapping::NearestNeighborMapping(mapping::Mapping::CONSISTENT, dimensions));
+    boundingFromMapping->setMeshes(pMesh, pOtherMesh);
+
+    // The first two ranks need all vertices, the last one only the first two vertices.
+    // The greedy ownership assigns 4, 2, and 0 vertices.
+    int localVertices = context.isRank(2) ? 2 : 6;
+    for (int i = 0; i < localVertices; i++) {
+      pOtherMesh->createVertex(Eigen::Vector2d(i, 0.0));
+    }
+    pOtherMesh->computeBoundingBox();
+
+    double            safetyFactor = 0.1;
+    ReceivedPartition part(pMesh, ReceivedPartition::NO_FILTER, safetyFactor);
+    part.setOwnership(ReceivedPartition::Ownership::BALANCED, ReceivedPartition::OwnershipCost::VERTICES);
+    part.addM2N(m2n);
+    part.addFromMapping(boundingFromMapping);
+    part.communicate();
+    part.compute();
+
+    int owned = std::count_if(pMesh->vertices().begin(), pMesh->vertices().end(),
+                              [](const mesh::Vertex &v) { return v.isOwner(); });
+    BOOST_TEST(pMesh->vertices().size() == static_cast<std::size_t>(localVertices));
+    if (context.isRank(2)) {
+      BOOST_TEST(owned == 0);
+    } else {
+      BOOST_TEST(owned == 3);
+      // Neighbouring vertices are assigned alternately, the lower rank winning ties
+      for (const mesh::Vertex &vertex : pMesh->vertices()) {
+        BOOST_TEST(vertex.isOwner() == (vertex.getGlobalIndex() % 2 == context.rank));
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(ProvideAndReceiveCouplingMode)
 {
   PRECICE_TEST("Fluid"_on(1_rank), "Solid"_on(1_rank), Require::Events);
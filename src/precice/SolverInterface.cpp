@@ -167,6 +167,15 @@ void SolverInterface::getMeshVertices(
   _impl->getMeshVertices(meshID, size, ids, positions);
 }
 
+void SolverInterface::setMeshVertexCoordinates(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions)
+{
+  _impl->setMeshVertexCoordinates(meshID, size, ids, positions);
+}
+
 void SolverInterface::getMeshVertexIDsFromPositions(
     int           meshID,
     int           size,
@@ -223,6 +232,31 @@ void SolverInterface::setMeshQuadWithEdges(
                               fourthVertexID);
 }
 
+void SolverInterface::setMeshEdges(
+    int        meshID,
+    int        size,
+    const int *vertices,
+    int *      ids)
+{
+  _impl->setMeshEdges(meshID, size, vertices, ids);
+}
+
+void SolverInterface::setMeshTriangles(
+    int        meshID,
+    int        size,
+    const int *vertices)
+{
+  _impl->setMeshTriangles(meshID, size, vertices);
+}
+
+void SolverInterface::setMeshQuads(
+    int        meshID,
+    int        size,
+    const int *vertices)
+{
+  _impl->setMeshQuads(meshID, size, vertices);
+}
+
 void SolverInterface::mapReadDataTo(
     int toMeshID)
 {
@@ -317,6 +351,20 @@ void SolverInterface::getMeshVerticesAndIDs(const int meshID,
   _impl->getMeshVerticesAndIDs(meshID, size, ids, coordinates);
 }
 
+double *SolverInterface::getWriteDataBuffer(
+    int  dataID,
+    int &size)
+{
+  return _impl->getWriteDataBuffer(dataID, size);
+}
+
+const double *SolverInterface::getReadDataBuffer(
+    int  dataID,
+    int &size) const
+{
+  return _impl->getReadDataBuffer(dataID, size);
+}
+
 std::string getVersionInformation()
 {
   return {precice::versionInformation};
@@ -434,6 +434,49 @@ public:
       const int *ids,
       double *   positions) const;
 
+  /**
+   * @brief Moves existing vertices of a provided mesh to new positions.
+   *
+   * The number of vertices and the connectivity of the mesh stay the same. The spatial
+   * indices of the mesh are updated and the mappings from and to the mesh are recomputed
+   * the next time data is mapped, without repartitioning.
+   *
+   * After initialize(), only meshes configured with <mesh moving="true"> may be moved.
+   * Participants receiving the moving mesh get the new coordinates along with the next data
+   * sent on this mesh, but only if the vertices moved since the last data was sent.
+   *
+   * The received meshes are filtered in initialize() to the bounding box of the local meshes
+   * of the mappings, enlarged by the safety-factor. Moving vertices of a local mesh out of this
+   * bounding box raises an error. Received meshes mapped from or to a moving mesh keep all
+   * vertices within this bounding box, as the mappings may need other vertices after a move.
+   * Received copies of a moving mesh are not filtered at all, as their vertices may move anywhere,
+   * which rules out the two-level initialization for them.
+   *
+   * After initialize(), this function is collective: all ranks of the participant have to call
+   * it for the same meshes in the same order, if necessary with size 0, as the mappings are
+   * recomputed by all ranks together.
+   *
+   * @param[in] meshID the id of the mesh to move the vertices of
+   * @param[in] size Number of vertices to move
+   * @param[in] ids The ids of the vertices to move
+   * @param[in] positions a pointer to the new coordinates of the vertices
+   *            The 2D-format is (d0x, d0y, d1x, d1y, ..., dnx, dny)
+   *            The 3D-format is (d0x, d0y, d0z, d1x, d1y, d1z, ..., dnx, dny, dnz)
+   *
+   * @pre count of available elements at positions matches the configured dimension * size
+   * @pre count of available elements at ids matches size
+   * @pre after initialize(), the mesh is configured as moving
+   * @pre after initialize(), all ranks of the participant call this function for the same mesh
+   * @pre after initialize(), the vertices stay inside the bounding box the received meshes of the mappings were filtered to
+   *
+   * @see getDimensions()
+   */
+  void setMeshVertexCoordinates(
+      int           meshID,
+      int           size,
+      const int *   ids,
+      const double *positions);
+
   /**
    * @brief Gets mesh vertex IDs from positions.
    *
@@ -553,6 +596,64 @@ public:
       int thirdVertexID,
       int fourthVertexID);
 
+  /**
+   * @brief Sets multiple mesh edges from vertex IDs.
+   *
+   * This is equivalent to calling setMeshEdge() for each edge.
+   *
+   * @param[in] meshID ID of the mesh to add the edges to
+   * @param[in] size Number of edges to create
+   * @param[in] vertices the IDs of the vertices of the edges, two per edge
+   *            The format is (e0v0, e0v1, e1v0, e1v1, ..., env0, env1)
+   * @param[out] ids the IDs of the created edges, -1 if the mesh requires no connectivity
+   *
+   * @pre count of available elements at vertices matches 2 * size
+   * @pre count of available elements at ids matches size
+   * @pre vertices with the given IDs were added to the mesh with the ID meshID
+   */
+  void setMeshEdges(
+      int        meshID,
+      int        size,
+      const int *vertices,
+      int *      ids);
+
+  /**
+   * @brief Sets multiple mesh triangles from vertex IDs and creates missing edges.
+   *
+   * This is equivalent to calling setMeshTriangleWithEdges() for each triangle.
+   * Existing edges are looked up by a hash map, which makes this efficient for large meshes.
+   *
+   * @param[in] meshID ID of the mesh to add the triangles to
+   * @param[in] size Number of triangles to create
+   * @param[in] vertices the IDs of the vertices of the triangles, three per triangle
+   *            The format is (t0v0, t0v1, t0v2, t1v0, ..., tnv2)
+   *
+   * @pre count of available elements at vertices matches 3 * size
+   * @pre vertices with the given IDs were added to the mesh with the ID meshID
+   */
+  void setMeshTriangles(
+      int        meshID,
+      int        size,
+      const int *vertices);
+
+  /**
+   * @brief Sets multiple surface mesh quadrangles from vertex IDs and creates missing edges.
+   *
+   * This is equivalent to calling setMeshQuadWithEdges() for each quadrangle.
+   *
+   * @param[in] meshID ID of the mesh to add the quadrangles to
+   * @param[in] size Number of quadrangles to create
+   * @param[in] vertices the IDs of the vertices of the quadrangles, four per quadrangle
+   *            The format is (q0v0, q0v1, q0v2, q0v3, q1v0, ..., qnv3)
+   *
+   * @pre count of available elements at vertices matches 4 * size
+   * @pre vertices with the given IDs were added to the mesh with the ID meshID
+   */
+  void setMeshQuads(
+      int        meshID,
+      int        size,
+      const int *vertices);
+
   ///@}
 
   ///@name Data Access
@@ -880,6 +981,47 @@ public:
       int *     ids,
       double *  coordinates) const;
 
+  /**
+   * @brief Gives direct access to the internal values of write data.
+   *
+   * @experimental
+   *
+   * Writing to the returned buffer is equivalent to writeBlockScalarData() or
+   * writeBlockVectorData() on all vertices of the mesh, but avoids the copy.
+   * The values are ordered by vertex ID, the components of vector data of a vertex
+   * are stored consecutively: (d0x, d0y, d1x, d1y, ..., dnx, dny) in 2D.
+   *
+   * @param[in] dataID ID of the data to write to.
+   * @param[out] size Number of values in the buffer, i.e. vertex count times data dimensions.
+   *
+   * @returns a pointer to the first value of the data
+   *
+   * @pre initialize() has been called
+   *
+   * @note The buffer stays valid until finalize() is called or the mesh is changed.
+   */
+  double *getWriteDataBuffer(int dataID, int &size);
+
+  /**
+   * @brief Gives direct read-only access to the internal values of read data.
+   *
+   * @experimental
+   *
+   * Reading from the returned buffer is equivalent to readBlockScalarData() or
+   * readBlockVectorData() on all vertices of the mesh, but avoids the copy.
+   * The values are updated by advance(), the layout is the one of getWriteDataBuffer().
+   *
+   * @param[in] dataID ID of the data to read from.
+   * @param[out] size Number of values in the buffer, i.e. vertex count times data dimensions.
+   *
+   * @returns a pointer to the first value of the data
+   *
+   * @pre initialize() has been called
+   *
+   * @note The buffer stays valid until finalize() is called or the mesh is changed.
+   */
+  const double *getReadDataBuffer(int dataID, int &size) const;
+
   ///@}
 
   /// Disable copy construction
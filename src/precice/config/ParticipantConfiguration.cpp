@@ -168,6 +168,27 @@ ParticipantConfiguration::ParticipantConfiguration(
                            .setDefaultValue(VALUE_FILTER_ON_SLAVES);
   tagUseMesh.addAttribute(attrGeoFilter);
 
+  auto attrOwnership = XMLAttribute<std::string>(ATTR_OWNERSHIP)
+                           .setDocumentation(
+                               "If a mesh is received from another partipant (see tag <from>), vertices shared by several ranks "
+                               "are owned by a single rank. The \"greedy\" strategy gives every rank a rough share of its vertices "
+                               "and assigns the remaining vertices in rank order. The \"balanced\" strategy assigns shared vertices "
+                               "in a spatially coherent order to the rank with the lowest cost so far (see ownership-cost). "
+                               "\"balanced\" is not supported if you use two-level initialization.")
+                           .setOptions({VALUE_OWNERSHIP_GREEDY, VALUE_OWNERSHIP_BALANCED})
+                           .setDefaultValue(VALUE_OWNERSHIP_GREEDY);
+  tagUseMesh.addAttribute(attrOwnership);
+
+  auto attrOwnershipCost = XMLAttribute<std::string>(ATTR_OWNERSHIP_COST)
+                               .setDocumentation(
+                                   "Defines the cost of a rank balanced by ownership=\"balanced\": the number of owned vertices "
+                                   "(\"vertices\"), additionally the number of rows of the mappings on the local meshes "
+                                   "(\"mapping-rows\"), or the number of owned data values (\"data\"). "
+                                   "The costs of all ranks are reported in the events of the partitioning.")
+                               .setOptions({VALUE_COST_VERTICES, VALUE_COST_MAPPING_ROWS, VALUE_COST_DATA})
+                               .setDefaultValue(VALUE_COST_VERTICES);
+  tagUseMesh.addAttribute(attrOwnershipCost);
+
   auto attrDirectAccess = makeXMLAttribute(ATTR_DIRECT_ACCESS, false)
                               .setDocumentation(
                                   "If a mesh is received from another partipant (see tag <from>), it needs to be"
@@ -279,6 +300,8 @@ void ParticipantConfiguration::xmlTagCallback(
     double                                        safetyFactor      = tag.getDoubleAttributeValue(ATTR_SAFETY_FACTOR);
     partition::ReceivedPartition::GeometricFilter geoFilter         = getGeoFilter(tag.getStringAttributeValue(ATTR_GEOMETRIC_FILTER));
     const bool                                    allowDirectAccess = tag.getBooleanAttributeValue(ATTR_DIRECT_ACCESS);
+    partition::ReceivedPartition::Ownership       ownership         = getOwnership(tag.getStringAttributeValue(ATTR_OWNERSHIP));
+    partition::ReceivedPartition::OwnershipCost   ownershipCost     = getOwnershipCost(tag.getStringAttributeValue(ATTR_OWNERSHIP_COST));
 
     if (allowDirectAccess) {
       PRECICE_WARN("You configured the received mesh \"{}\" to use the option access-direct=\"true\", which is currently still experimental. Use with care.", name);
@@ -315,7 +338,15 @@ void ParticipantConfiguration::xmlTagCallback(
                   " or remove the direct access option.",
                   _participants.back()->getName(), name, name);
 
+    PRECICE_CHECK((ownership == partition::ReceivedPartition::Ownership::GREEDY && ownershipCost == partition::ReceivedPartition::OwnershipCost::VERTICES) || !from.empty(),
+                  "Participant \"{}\" uses mesh \"{}\", which is not received (no \"from\"), but has an ownership and/or an ownership cost defined. "
+                  "Please extend the use-mesh tag as follows: <use-mesh name=\"{}\" from=\"(other participant)\" />",
+                  _participants.back()->getName(), name, name);
+
     _participants.back()->useMesh(mesh, offset, false, from, safetyFactor, provide, geoFilter, allowDirectAccess);
+    impl::MeshContext &meshContext = _participants.back()->usedMeshContext(mesh->getID());
+    meshContext.ownership          = ownership;
+    meshContext.ownershipCost      = ownershipCost;
   } else if (tag.getName() == TAG_WRITE) {
     const std::string &dataName = tag.getStringAttributeValue(ATTR_NAME);
     std::string        meshName = tag.getStringAttributeValue(ATTR_MESH);
@@ -384,6 +415,28 @@ partition::ReceivedPartition::GeometricFilter ParticipantConfiguration::getGeoFi
   }
 }
 
+partition::ReceivedPartition::Ownership ParticipantConfiguration::getOwnership(const std::string &ownership) const
+{
+  if (ownership == VALUE_OWNERSHIP_BALANCED) {
+    return partition::ReceivedPartition::Ownership::BALANCED;
+  } else {
+    PRECICE_ASSERT(ownership == VALUE_OWNERSHIP_GREEDY);
+    return partition::ReceivedPartition::Ownership::GREEDY;
+  }
+}
+
+partition::ReceivedPartition::OwnershipCost ParticipantConfiguration::getOwnershipCost(const std::string &cost) const
+{
+  if (cost == VALUE_COST_MAPPING_ROWS) {
+    return partition::ReceivedPartition::OwnershipCost::MAPPING_ROWS;
+  } else if (cost == VALUE_COST_DATA) {
+    return partition::ReceivedPartition::OwnershipCost::DATA;
+  } else {
+    PRECICE_ASSERT(cost == VALUE_COST_VERTICES);
+    return partition::ReceivedPartition::OwnershipCost::VERTICES;
+  }
+}
+
 const mesh::PtrData &ParticipantConfiguration::getData(
     const mesh::PtrMesh &mesh,
     const std::string &  nameData) const
@@ -84,6 +84,8 @@ private:
   const std::string ATTR_SAFETY_FACTOR      = "safety-factor";
   const std::string ATTR_GEOMETRIC_FILTER   = "geometric-filter";
   const std::string ATTR_DIRECT_ACCESS      = "direct-access";
+  const std::string ATTR_OWNERSHIP          = "ownership";
+  const std::string ATTR_OWNERSHIP_COST     = "ownership-cost";
   const std::string ATTR_PROVIDE            = "provide";
   const std::string ATTR_MESH               = "mesh";
   const std::string ATTR_COORDINATE         = "coordinate";
@@ -97,6 +99,13 @@ private:
   const std::string VALUE_FILTER_ON_MASTER = "on-master";
   const std::string VALUE_NO_FILTER        = "no-filter";
 
+  const std::string VALUE_OWNERSHIP_GREEDY   = "greedy";
+  const std::string VALUE_OWNERSHIP_BALANCED = "balanced";
+
+  const std::string VALUE_COST_VERTICES     = "vertices";
+  const std::string VALUE_COST_MAPPING_ROWS = "mapping-rows";
+  const std::string VALUE_COST_DATA         = "data";
+
   const std::string VALUE_VTK = "vtk";
   const std::string VALUE_VTU = "vtu";
   const std::string VALUE_VTP = "vtp";
@@ -119,6 +128,10 @@ private:
 
   partition::ReceivedPartition::GeometricFilter getGeoFilter(const std::string &geoFilter) const;
 
+  partition::ReceivedPartition::Ownership getOwnership(const std::string &ownership) const;
+
+  partition::ReceivedPartition::OwnershipCost getOwnershipCost(const std::string &cost) const;
+
   mesh::PtrMesh copy(const mesh::PtrMesh &mesh) const;
 
   const mesh::PtrData &getData(
@@ -10,6 +10,7 @@
 #include "mesh/Mesh.hpp"
 #include "mesh/config/DataConfiguration.hpp"
 #include "mesh/config/MeshConfiguration.hpp"
+#include "partition/ReceivedPartition.hpp"
 #include "precice/config/SharedPointer.hpp"
 #include "precice/impl/MeshContext.hpp"
 #include "precice/impl/Participant.hpp"
@@ -89,6 +90,21 @@ void SolverInterfaceConfiguration::xmlEndTagCallback(
       }
       PRECICE_ASSERT(participantFound);
     }
+
+    // The two-level initialization decides the owners locally, hence it cannot balance them
+    for (const impl::PtrParticipant &participant : _participantConfiguration->getParticipants()) {
+      for (const impl::MeshContext *meshContext : participant->usedMeshContexts()) {
+        if (meshContext->ownership != partition::ReceivedPartition::Ownership::BALANCED ||
+            not _m2nConfiguration->isM2NConfigured(participant->getName(), meshContext->receiveMeshFrom)) {
+          continue;
+        }
+        PRECICE_CHECK(not _m2nConfiguration->getM2N(participant->getName(), meshContext->receiveMeshFrom)->usesTwoLevelInitialization(),
+                      "Participant \"{}\" receives mesh \"{}\" with ownership=\"balanced\", which is not supported "
+                      "in combination with two-level initialization. Please use the default ownership=\"greedy\" "
+                      "or switch off the two-level initialization in the m2n between \"{}\" and \"{}\".",
+                      participant->getName(), meshContext->mesh->getName(), participant->getName(), meshContext->receiveMeshFrom);
+      }
+    }
   }
 }
 
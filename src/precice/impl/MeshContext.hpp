@@ -49,6 +49,12 @@ struct MeshContext {
   /// type of geometric filter
   partition::ReceivedPartition::GeometricFilter geoFilter = partition::ReceivedPartition::GeometricFilter::UNDEFINED;
 
+  /// how the owners of shared vertices of a received mesh are decided
+  partition::ReceivedPartition::Ownership ownership = partition::ReceivedPartition::Ownership::GREEDY;
+
+  /// cost of a rank balanced by partition::ReceivedPartition::Ownership::BALANCED
+  partition::ReceivedPartition::OwnershipCost ownershipCost = partition::ReceivedPartition::OwnershipCost::VERTICES;
+
   /// Offset only applied to meshes local to the accessor.
   Eigen::VectorXd localOffset;
 
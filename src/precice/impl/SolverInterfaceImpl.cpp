@@ -2,12 +2,16 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <ostream>
 #include <sstream>
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -79,6 +83,21 @@ bool syncMode = false;
 
 namespace impl {
 
+namespace {
+
+/// Checks if the indices are consecutive, in which case the values are copied as a single block
+bool areConsecutive(const int *indices, int size)
+{
+  for (int i = 1; i < size; ++i) {
+    if (indices[i] != static_cast<std::int64_t>(indices[0]) + i) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
 SolverInterfaceImpl::SolverInterfaceImpl(
     std::string        participantName,
     const std::string &configurationFileName,
@@ -284,6 +303,19 @@ double SolverInterfaceImpl::initialize()
     m2nPair.second.cleanupEstablishment();
   }
 
+  // Received moving meshes are moved by the coupling scheme along with the data sent by the providing participant
+  for (MeshContext *meshContext : _accessor->usedMeshContexts()) {
+    if (meshContext->provideMesh || not meshContext->mesh->isMoving()) {
+      continue;
+    }
+    PRECICE_CHECK(_couplingScheme->receivesDataOn(meshContext->mesh->getID()),
+                  "The moving mesh \"{0}\" is received from participant \"{1}\", which does not send any data on it. "
+                  "The coordinates of moving meshes are sent along with their data. "
+                  "Please exchange at least one data set on mesh \"{0}\" from participant \"{1}\" to participant \"{2}\".",
+                  meshContext->mesh->getName(), meshContext->receiveMeshFrom, _accessorName);
+    meshContext->mesh->meshChanged.connect([meshContext](mesh::Mesh &) { meshContext->clearMappings(); });
+  }
+
   PRECICE_DEBUG("Initialize watchpoints");
   for (PtrWatchPoint &watchPoint : _accessor->watchPoints()) {
     watchPoint->initialize();
@@ -726,6 +758,69 @@ void SolverInterfaceImpl::getMeshVertices(
   }
 }
 
+void SolverInterfaceImpl::setMeshVertexCoordinates(
+    int           meshID,
+    int           size,
+    const int *   ids,
+    const double *positions)
+{
+  PRECICE_TRACE(meshID, size);
+  PRECICE_REQUIRE_MESH_PROVIDE(meshID);
+  PRECICE_CHECK(_state != State::Finalized, "setMeshVertexCoordinates() cannot be called after finalize().");
+  MeshContext & context = _accessor->usedMeshContext(meshID);
+  mesh::PtrMesh mesh(context.mesh);
+  // Received copies of the mesh are only updated by the coupling scheme for moving meshes
+  PRECICE_CHECK(_state == State::Constructed || mesh->isMoving(),
+                "setMeshVertexCoordinates() was called after initialize() on mesh \"{0}\", which is not moving. "
+                "Please configure the mesh as <mesh name=\"{0}\" moving=\"true\">.",
+                mesh->getName());
+
+  auto &vertices = mesh->vertices();
+  Eigen::Map<const Eigen::MatrixXd> posMatrix{
+      positions, _dimensions, static_cast<EIGEN_DEFAULT_DENSE_INDEX_TYPE>(size)};
+  for (int i = 0; i < size; ++i) {
+    PRECICE_CHECK(ids[i] >= 0 && static_cast<std::size_t>(ids[i]) < vertices.size(),
+                  "setMeshVertexCoordinates() was called with an invalid vertex ID {} for mesh \"{}\".",
+                  ids[i], mesh->getName());
+    vertices[ids[i]].setCoords(posMatrix.col(i));
+  }
+
+  if (_state == State::Constructed) {
+    return;
+  }
+
+  // All ranks recompute the mappings together, hence all of them have to move the same mesh
+  double masterMeshID = meshID;
+  utils::MasterSlave::broadcast(masterMeshID);
+  int mismatch   = (masterMeshID == meshID) ? 0 : 1;
+  int mismatches = 0;
+  utils::MasterSlave::allreduceSum(mismatch, mismatches);
+  PRECICE_CHECK(mismatches == 0,
+                "setMeshVertexCoordinates() was called for mesh \"{}\", while {} rank(s) called it for another mesh. "
+                "After initialize(), all ranks have to call setMeshVertexCoordinates() for the same meshes in the same order, if necessary with size 0.",
+                mesh->getName(), mismatches);
+
+  PRECICE_DEBUG("Refit the indices and clear the mappings of mesh \"{}\"", mesh->getName());
+  mesh->computeBoundingBox();
+  // Received meshes are only filtered in initialize(), hence their vertices around the moved vertices may be missing
+  for (const MeshContext *receivedContext : _accessor->usedMeshContexts()) {
+    if (receivedContext->provideMesh) {
+      continue;
+    }
+    const auto &partition = static_cast<const partition::ReceivedPartition &>(*receivedContext->partition);
+    PRECICE_CHECK(partition.containsLocalMesh(*mesh),
+                  "setMeshVertexCoordinates() moved vertices of mesh \"{}\" out of the bounding box, to which the received mesh \"{}\" was filtered in initialize(). "
+                  "The vertices of \"{}\" around the moved vertices are not available on this rank. "
+                  "Please increase the safety-factor of <use-mesh name=\"{}\" from=\"{}\" /> to cover the movement of the vertices.",
+                  mesh->getName(), receivedContext->mesh->getName(), receivedContext->mesh->getName(),
+                  receivedContext->mesh->getName(), receivedContext->receiveMeshFrom);
+  }
+  // The coupling scheme sends the coordinates to the receiving participants along with the next data on the mesh
+  mesh->countMove();
+  mesh->meshChanged(*mesh);
+  context.clearMappings();
+}
+
 void SolverInterfaceImpl::getMeshVertexIDsFromPositions(
     int           meshID,
     size_t        size,
@@ -826,28 +921,8 @@ void SolverInterfaceImpl::setMeshTriangleWithEdges(
   PRECICE_REQUIRE_MESH_MODIFY(meshID);
   MeshContext &context = _accessor->usedMeshContext(meshID);
   if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL) {
-    mesh::PtrMesh &mesh = context.mesh;
-    using impl::errorInvalidVertexID;
-    PRECICE_CHECK(mesh->isValidVertexID(firstVertexID), errorInvalidVertexID(firstVertexID));
-    PRECICE_CHECK(mesh->isValidVertexID(secondVertexID), errorInvalidVertexID(secondVertexID));
-    PRECICE_CHECK(mesh->isValidVertexID(thirdVertexID), errorInvalidVertexID(thirdVertexID));
-    PRECICE_CHECK(utils::unique_elements(utils::make_array(firstVertexID, secondVertexID, thirdVertexID)),
-                  "setMeshTriangleWithEdges() was called with repeated Vertex IDs ({}, {}, {}).",
-                  firstVertexID, secondVertexID, thirdVertexID);
-    mesh::Vertex *vertices[3];
-    vertices[0] = &mesh->vertices()[firstVertexID];
-    vertices[1] = &mesh->vertices()[secondVertexID];
-    vertices[2] = &mesh->vertices()[thirdVertexID];
-    PRECICE_CHECK(utils::unique_elements(utils::make_array(vertices[0]->getCoords(),
-                                                           vertices[1]->getCoords(), vertices[2]->getCoords())),
-                  "setMeshTriangleWithEdges() was called with vertices located at identical coordinates (IDs: {}, {}, {}).",
-                  firstVertexID, secondVertexID, thirdVertexID);
-    mesh::Edge *edges[3];
-    edges[0] = &mesh->createUniqueEdge(*vertices[0], *vertices[1]);
-    edges[1] = &mesh->createUniqueEdge(*vertices[1], *vertices[2]);
-    edges[2] = &mesh->createUniqueEdge(*vertices[2], *vertices[0]);
-
-    mesh->createTriangle(*edges[0], *edges[1], *edges[2]);
+    PRECICE_ASSERT(context.mesh);
+    createTriangleWithEdges(*context.mesh, "setMeshTriangleWithEdges", firstVertexID, secondVertexID, thirdVertexID);
   }
 }
 
@@ -926,53 +1001,152 @@ void SolverInterfaceImpl::setMeshQuadWithEdges(
   MeshContext &context = _accessor->usedMeshContext(meshID);
   if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL) {
     PRECICE_ASSERT(context.mesh);
-    mesh::Mesh &mesh = *(context.mesh);
-    using impl::errorInvalidVertexID;
+    createQuadWithEdges(*context.mesh, firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
+  }
+}
+
+void SolverInterfaceImpl::setMeshEdges(
+    MeshID     meshID,
+    int        size,
+    const int *vertices,
+    int *      ids)
+{
+  PRECICE_TRACE(meshID, size);
+  PRECICE_REQUIRE_MESH_MODIFY(meshID);
+  MeshContext &context = _accessor->usedMeshContext(meshID);
+  if (context.meshRequirement != mapping::Mapping::MeshRequirement::FULL) {
+    std::fill_n(ids, size, -1);
+    return;
+  }
+  mesh::Mesh &mesh = *context.mesh;
+  using impl::errorInvalidVertexID;
+  for (int i = 0; i < size; ++i) {
+    const int firstVertexID  = vertices[2 * i];
+    const int secondVertexID = vertices[2 * i + 1];
     PRECICE_CHECK(mesh.isValidVertexID(firstVertexID), errorInvalidVertexID(firstVertexID));
     PRECICE_CHECK(mesh.isValidVertexID(secondVertexID), errorInvalidVertexID(secondVertexID));
-    PRECICE_CHECK(mesh.isValidVertexID(thirdVertexID), errorInvalidVertexID(thirdVertexID));
-    PRECICE_CHECK(mesh.isValidVertexID(fourthVertexID), errorInvalidVertexID(fourthVertexID));
-
-    auto vertexIDs = utils::make_array(firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
-    PRECICE_CHECK(utils::unique_elements(vertexIDs), "The four vertex ID's are not unique. Please check that the vertices that form the quad are correct.");
-
-    auto coords = mesh::coordsFor(mesh, vertexIDs);
-    PRECICE_CHECK(utils::unique_elements(coords),
-                  "The four vertices that form the quad are not unique. The resulting shape may be a point, line or triangle."
-                  "Please check that the adapter sends the four unique vertices that form the quad, or that the mesh on the interface "
-                  "is composed of quads. A mix of triangles and quads are not supported.");
-
-    auto convexity = math::geometry::isConvexQuad(coords);
-    PRECICE_CHECK(convexity.convex, "The given quad is not convex. "
-                                    "Please check that the adapter send the four correct vertices or that the interface is composed of quads. "
-                                    "A mix of triangles and quads are not supported.");
-    auto reordered = utils::reorder_array(convexity.vertexOrder, mesh::vertexPtrsFor(mesh, vertexIDs));
-
-    // Vertices are now in the order: V0-V1-V2-V3-V0.
-    // The order now identifies all outer edges of the quad.
-    auto &edge0 = mesh.createUniqueEdge(*reordered[0], *reordered[1]);
-    auto &edge1 = mesh.createUniqueEdge(*reordered[1], *reordered[2]);
-    auto &edge2 = mesh.createUniqueEdge(*reordered[2], *reordered[3]);
-    auto &edge3 = mesh.createUniqueEdge(*reordered[3], *reordered[0]);
+    ids[i] = mesh.createEdge(mesh.vertices()[firstVertexID], mesh.vertices()[secondVertexID]).getID();
+  }
+}
 
-    // Use the shortest diagonal to split the quad into 2 triangles.
-    // Vertices are now in V0-V1-V2-V3-V0 order. The new edge, e[4] is either 0-2 or 1-3
-    double distance1 = (reordered[0]->getCoords() - reordered[2]->getCoords()).norm();
-    double distance2 = (reordered[1]->getCoords() - reordered[3]->getCoords()).norm();
+void SolverInterfaceImpl::setMeshTriangles(
+    MeshID     meshID,
+    int        size,
+    const int *vertices)
+{
+  PRECICE_TRACE(meshID, size);
+  PRECICE_CHECK(_dimensions == 3, "setMeshTriangles is only possible for 3D cases."
+                                  " Please set the dimension to 3 in the preCICE configuration file.");
+  PRECICE_REQUIRE_MESH_MODIFY(meshID);
+  MeshContext &context = _accessor->usedMeshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL) {
+    PRECICE_ASSERT(context.mesh);
+    for (int i = 0; i < size; ++i) {
+      createTriangleWithEdges(*context.mesh, "setMeshTriangles", vertices[3 * i], vertices[3 * i + 1], vertices[3 * i + 2]);
+    }
+  }
+}
 
-    // The new edge, e[4], is the shortest diagonal of the quad
-    if (distance1 <= distance2) {
-      auto &diag = mesh.createUniqueEdge(*reordered[0], *reordered[2]);
-      mesh.createTriangle(edge0, edge1, diag);
-      mesh.createTriangle(edge2, edge3, diag);
-    } else {
-      auto &diag = mesh.createUniqueEdge(*reordered[1], *reordered[3]);
-      mesh.createTriangle(edge3, edge0, diag);
-      mesh.createTriangle(edge1, edge2, diag);
+void SolverInterfaceImpl::setMeshQuads(
+    MeshID     meshID,
+    int        size,
+    const int *vertices)
+{
+  PRECICE_TRACE(meshID, size);
+  PRECICE_CHECK(_dimensions == 3, "setMeshQuads is only possible for 3D cases."
+                                  " Please set the dimension to 3 in the preCICE configuration file.");
+  PRECICE_REQUIRE_MESH_MODIFY(meshID);
+  MeshContext &context = _accessor->usedMeshContext(meshID);
+  if (context.meshRequirement == mapping::Mapping::MeshRequirement::FULL) {
+    PRECICE_ASSERT(context.mesh);
+    for (int i = 0; i < size; ++i) {
+      createQuadWithEdges(*context.mesh, vertices[4 * i], vertices[4 * i + 1], vertices[4 * i + 2], vertices[4 * i + 3]);
     }
   }
 }
 
+void SolverInterfaceImpl::createTriangleWithEdges(
+    mesh::Mesh &mesh,
+    const char *caller,
+    int         firstVertexID,
+    int         secondVertexID,
+    int         thirdVertexID)
+{
+  using impl::errorInvalidVertexID;
+  PRECICE_CHECK(mesh.isValidVertexID(firstVertexID), errorInvalidVertexID(firstVertexID));
+  PRECICE_CHECK(mesh.isValidVertexID(secondVertexID), errorInvalidVertexID(secondVertexID));
+  PRECICE_CHECK(mesh.isValidVertexID(thirdVertexID), errorInvalidVertexID(thirdVertexID));
+  PRECICE_CHECK(utils::unique_elements(utils::make_array(firstVertexID, secondVertexID, thirdVertexID)),
+                "{}() was called with repeated Vertex IDs ({}, {}, {}).", caller,
+                firstVertexID, secondVertexID, thirdVertexID);
+  mesh::Vertex *vertices[3];
+  vertices[0] = &mesh.vertices()[firstVertexID];
+  vertices[1] = &mesh.vertices()[secondVertexID];
+  vertices[2] = &mesh.vertices()[thirdVertexID];
+  PRECICE_CHECK(utils::unique_elements(utils::make_array(vertices[0]->getCoords(),
+                                                         vertices[1]->getCoords(), vertices[2]->getCoords())),
+                "{}() was called with vertices located at identical coordinates (IDs: {}, {}, {}).", caller,
+                firstVertexID, secondVertexID, thirdVertexID);
+  mesh::Edge *edges[3];
+  edges[0] = &mesh.createUniqueEdge(*vertices[0], *vertices[1]);
+  edges[1] = &mesh.createUniqueEdge(*vertices[1], *vertices[2]);
+  edges[2] = &mesh.createUniqueEdge(*vertices[2], *vertices[0]);
+
+  mesh.createTriangle(*edges[0], *edges[1], *edges[2]);
+}
+
+void SolverInterfaceImpl::createQuadWithEdges(
+    mesh::Mesh &mesh,
+    int         firstVertexID,
+    int         secondVertexID,
+    int         thirdVertexID,
+    int         fourthVertexID)
+{
+  using impl::errorInvalidVertexID;
+  PRECICE_CHECK(mesh.isValidVertexID(firstVertexID), errorInvalidVertexID(firstVertexID));
+  PRECICE_CHECK(mesh.isValidVertexID(secondVertexID), errorInvalidVertexID(secondVertexID));
+  PRECICE_CHECK(mesh.isValidVertexID(thirdVertexID), errorInvalidVertexID(thirdVertexID));
+  PRECICE_CHECK(mesh.isValidVertexID(fourthVertexID), errorInvalidVertexID(fourthVertexID));
+
+  auto vertexIDs = utils::make_array(firstVertexID, secondVertexID, thirdVertexID, fourthVertexID);
+  PRECICE_CHECK(utils::unique_elements(vertexIDs), "The four vertex ID's are not unique. Please check that the vertices that form the quad are correct.");
+
+  auto coords = mesh::coordsFor(mesh, vertexIDs);
+  PRECICE_CHECK(utils::unique_elements(coords),
+                "The four vertices that form the quad are not unique. The resulting shape may be a point, line or triangle."
+                "Please check that the adapter sends the four unique vertices that form the quad, or that the mesh on the interface "
+                "is composed of quads. A mix of triangles and quads are not supported.");
+
+  auto convexity = math::geometry::isConvexQuad(coords);
+  PRECICE_CHECK(convexity.convex, "The given quad is not convex. "
+                                  "Please check that the adapter send the four correct vertices or that the interface is composed of quads. "
+                                  "A mix of triangles and quads are not supported.");
+  auto reordered = utils::reorder_array(convexity.vertexOrder, mesh::vertexPtrsFor(mesh, vertexIDs));
+
+  // Vertices are now in the order: V0-V1-V2-V3-V0.
+  // The order now identifies all outer edges of the quad.
+  auto &edge0 = mesh.createUniqueEdge(*reordered[0], *reordered[1]);
+  auto &edge1 = mesh.createUniqueEdge(*reordered[1], *reordered[2]);
+  auto &edge2 = mesh.createUniqueEdge(*reordered[2], *reordered[3]);
+  auto &edge3 = mesh.createUniqueEdge(*reordered[3], *reordered[0]);
+
+  // Use the shortest diagonal to split the quad into 2 triangles.
+  // Vertices are now in V0-V1-V2-V3-V0 order. The new edge, e[4] is either 0-2 or 1-3
+  double distance1 = (reordered[0]->getCoords() - reordered[2]->getCoords()).norm();
+  double distance2 = (reordered[1]->getCoords() - reordered[3]->getCoords()).norm();
+
+  // The new edge, e[4], is the shortest diagonal of the quad
+  if (distance1 <= distance2) {
+    auto &diag = mesh.createUniqueEdge(*reordered[0], *reordered[2]);
+    mesh.createTriangle(edge0, edge1, diag);
+    mesh.createTriangle(edge2, edge3, diag);
+  } else {
+    auto &diag = mesh.createUniqueEdge(*reordered[1], *reordered[3]);
+    mesh.createTriangle(edge3, edge0, diag);
+    mesh.createTriangle(edge1, edge2, diag);
+  }
+}
+
 void SolverInterfaceImpl::mapWriteDataFrom(
     int fromMeshID)
 {
@@ -992,6 +1166,7 @@ void SolverInterfaceImpl::mapWriteDataFrom(
       PRECICE_DEBUG("Compute mapping from mesh \"{}\"", context.mesh->getName());
       mappingContext.mapping->computeMapping();
     }
+    std::vector<mapping::Mapping::DataIDPair> dataIDs;
     for (impl::DataContext &context : _accessor->writeDataContexts()) {
 
       if (context.getMeshID() != fromMeshID) {
@@ -1000,8 +1175,9 @@ void SolverInterfaceImpl::mapWriteDataFrom(
       context.resetToData();
       PRECICE_DEBUG("Map data \"{}\" from mesh \"{}\"", context.getDataName(), context.getMeshName());
       PRECICE_ASSERT(mappingContext.mapping == context.mappingContext().mapping);
-      mappingContext.mapping->map(context.getFromDataID(), context.getToDataID());
+      dataIDs.emplace_back(context.getFromDataID(), context.getToDataID());
     }
+    mappingContext.mapping->map(dataIDs);
     mappingContext.hasMappedData = true;
   }
   performDataActions({action::Action::WRITE_MAPPING_POST}, time, 0, 0, 0);
@@ -1026,6 +1202,7 @@ void SolverInterfaceImpl::mapReadDataTo(
       PRECICE_DEBUG("Compute mapping from mesh \"{}\"", context.mesh->getName());
       mappingContext.mapping->computeMapping();
     }
+    std::vector<mapping::Mapping::DataIDPair> dataIDs;
     for (impl::DataContext &context : _accessor->readDataContexts()) {
       if (context.getMeshID() != toMeshID) {
         continue;
@@ -1033,9 +1210,9 @@ void SolverInterfaceImpl::mapReadDataTo(
       context.resetToData();
       PRECICE_DEBUG("Map data \"{}\" to mesh \"{}\"", context.getDataName(), context.getMeshName());
       PRECICE_ASSERT(mappingContext.mapping == context.mappingContext().mapping);
-      mappingContext.mapping->map(context.getFromDataID(), context.getToDataID());
-      PRECICE_DEBUG("Mapped values = {}", utils::previewRange(3, context.toData()->values())); // @todo might be better to move this debug message into Mapping::map and remove getter DataContext::toData()
+      dataIDs.emplace_back(context.getFromDataID(), context.getToDataID());
     }
+    mappingContext.mapping->map(dataIDs);
     mappingContext.hasMappedData = true;
   }
   performDataActions({action::Action::READ_MAPPING_POST}, time, 0, 0, 0);
@@ -1064,6 +1241,15 @@ void SolverInterfaceImpl::writeBlockVectorData(
 
   auto &     valuesInternal = data.values();
   const auto vertexCount    = valuesInternal.size() / data.getDimensions();
+  if (areConsecutive(valueIndices, size)) {
+    const int first = valueIndices[0];
+    PRECICE_CHECK(0 <= first && size <= vertexCount - first,
+                  "Cannot write data \"{}\" to invalid Vertex IDs ({} to {}). "
+                  "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
+                  data.getName(), first, static_cast<std::int64_t>(first) + size - 1);
+    std::copy_n(values, size * _dimensions, valuesInternal.data() + first * _dimensions);
+    return;
+  }
   for (int i = 0; i < size; i++) {
     const auto valueIndex = valueIndices[i];
     PRECICE_CHECK(0 <= valueIndex && valueIndex < vertexCount,
@@ -1130,6 +1316,15 @@ void SolverInterfaceImpl::writeBlockScalarData(
 
   auto &     valuesInternal = data.values();
   const auto vertexCount    = valuesInternal.size() / data.getDimensions();
+  if (areConsecutive(valueIndices, size)) {
+    const int first = valueIndices[0];
+    PRECICE_CHECK(0 <= first && size <= vertexCount - first,
+                  "Cannot write data \"{}\" to invalid Vertex IDs ({} to {}). "
+                  "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
+                  data.getName(), first, static_cast<std::int64_t>(first) + size - 1);
+    std::copy_n(values, size, valuesInternal.data() + first);
+    return;
+  }
   for (int i = 0; i < size; i++) {
     const auto valueIndex = valueIndices[i];
     PRECICE_CHECK(0 <= valueIndex && valueIndex < vertexCount,
@@ -1191,6 +1386,15 @@ void SolverInterfaceImpl::readBlockVectorData(
                 data.getName());
   auto &     valuesInternal = data.values();
   const auto vertexCount    = valuesInternal.size() / data.getDimensions();
+  if (areConsecutive(valueIndices, size)) {
+    const int first = valueIndices[0];
+    PRECICE_CHECK(0 <= first && size <= vertexCount - first,
+                  "Cannot read data \"{}\" from invalid Vertex IDs ({} to {}). "
+                  "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
+                  data.getName(), first, static_cast<std::int64_t>(first) + size - 1);
+    std::copy_n(valuesInternal.data() + first * _dimensions, size * _dimensions, values);
+    return;
+  }
   for (int i = 0; i < size; i++) {
     const auto valueIndex = valueIndices[i];
     PRECICE_CHECK(0 <= valueIndex && valueIndex < vertexCount,
@@ -1259,6 +1463,15 @@ void SolverInterfaceImpl::readBlockScalarData(
   auto &     valuesInternal = data.values();
   const auto vertexCount    = valuesInternal.size();
 
+  if (areConsecutive(valueIndices, size)) {
+    const int first = valueIndices[0];
+    PRECICE_CHECK(0 <= first && size <= vertexCount - first,
+                  "Cannot read data \"{}\" from invalid Vertex IDs ({} to {}). "
+                  "Please make sure you only use the results from calls to setMeshVertex/Vertices().",
+                  data.getName(), first, static_cast<std::int64_t>(first) + size - 1);
+    std::copy_n(valuesInternal.data() + first, size, values);
+    return;
+  }
   for (int i = 0; i < size; i++) {
     const auto valueIndex = valueIndices[i];
     PRECICE_CHECK(0 <= valueIndex && valueIndex < vertexCount,
@@ -1370,6 +1583,34 @@ void SolverInterfaceImpl::getMeshVerticesAndIDs(
   }
 }
 
+double *SolverInterfaceImpl::getWriteDataBuffer(
+    int  dataID,
+    int &size)
+{
+  PRECICE_TRACE(dataID);
+  PRECICE_CHECK(_state == State::Initialized, "getWriteDataBuffer(...) can only be called between initialize() and finalize().");
+  PRECICE_REQUIRE_DATA_WRITE(dataID);
+  DataContext &context = _accessor->dataContext(dataID);
+  PRECICE_ASSERT(context.providedData() != nullptr);
+  auto &values = context.providedData()->values();
+  size         = values.size();
+  return values.data();
+}
+
+const double *SolverInterfaceImpl::getReadDataBuffer(
+    int  dataID,
+    int &size) const
+{
+  PRECICE_TRACE(dataID);
+  PRECICE_CHECK(_state == State::Initialized, "getReadDataBuffer(...) can only be called between initialize() and finalize().");
+  PRECICE_REQUIRE_DATA_READ(dataID);
+  DataContext &context = _accessor->dataContext(dataID);
+  PRECICE_ASSERT(context.providedData() != nullptr);
+  const auto &values = context.providedData()->values();
+  size               = values.size();
+  return values.data();
+}
+
 void SolverInterfaceImpl::exportMesh(const std::string &filenameSuffix) const
 {
   PRECICE_TRACE(filenameSuffix);
@@ -1460,7 +1701,9 @@ void SolverInterfaceImpl::configurePartitions(
 
       PRECICE_DEBUG("Receiving mesh from {}", provider);
 
-      context->partition = partition::PtrPartition(new partition::ReceivedPartition(context->mesh, context->geoFilter, context->safetyFactor, context->allowDirectAccess));
+      auto receivedPartition = std::make_shared<partition::ReceivedPartition>(context->mesh, context->geoFilter, context->safetyFactor, context->allowDirectAccess);
+      receivedPartition->setOwnership(context->ownership, context->ownershipCost);
+      context->partition = receivedPartition;
 
       m2n::PtrM2N m2n = m2nConfig->getM2N(receiver, provider);
       m2n->createDistributedCommunication(context->mesh);
@@ -1538,6 +1781,22 @@ void SolverInterfaceImpl::computePartitions()
     }
     meshContext->mesh->allocateDataValues();
   }
+
+  // The memory report of the meshes
+  Event      memory("meshMemory");
+  const auto addBytes = [&memory](const std::string &key, std::size_t bytes) {
+    memory.addData(key, static_cast<std::int64_t>(bytes));
+  };
+  for (MeshContext *meshContext : contexts) {
+    const auto  usage = meshContext->mesh->memoryUsage();
+    const auto &name  = meshContext->mesh->getName();
+    addBytes(name + ".vertexBytes", usage.vertices);
+    addBytes(name + ".edgeBytes", usage.edges);
+    addBytes(name + ".triangleBytes", usage.triangles);
+    addBytes(name + ".dataBytes", usage.data);
+    PRECICE_DEBUG("Mesh {} allocates {} bytes: {} for vertices, {} for edges, {} for triangles, and {} for data",
+                  name, usage.total(), usage.vertices, usage.edges, usage.triangles, usage.data);
+  }
 }
 
 void SolverInterfaceImpl::computeMappings(const utils::ptr_vector<MappingContext> &contexts, const std::string &mappingType)
@@ -1563,7 +1822,11 @@ void SolverInterfaceImpl::mapData(const utils::ptr_vector<DataContext> &contexts
 {
   PRECICE_TRACE();
   using namespace mapping;
-  MappingConfiguration::Timing timing;
+  // Data sharing a mapping are mapped in a single call. The groups keep the order
+  // of the contexts, which is required for mappings communicating between ranks.
+  std::vector<std::pair<Mapping *, std::vector<Mapping::DataIDPair>>> groups;
+  std::vector<impl::DataContext *>                                   mappedContexts;
+  MappingConfiguration::Timing                                       timing;
   for (impl::DataContext &context : contexts) {
     if (context.hasMapping()) {
       timing         = context.mappingContext().timing;
@@ -1577,11 +1840,24 @@ void SolverInterfaceImpl::mapData(const utils::ptr_vector<DataContext> &contexts
                       mappingType, context.getDataName(), context.getMeshName());
         context.resetToData();
         PRECICE_DEBUG("Map from dataID {} to dataID: {}", inDataID, outDataID);
-        context.mappingContext().mapping->map(inDataID, outDataID);
-        PRECICE_DEBUG("Mapped values = {}", utils::previewRange(3, context.toData()->values())); // @todo might be better to move this debug message into Mapping::map and remove getter DataContext::toData()
+        Mapping *mapping = context.mappingContext().mapping.get();
+        auto     group   = std::find_if(groups.begin(), groups.end(), [mapping](const auto &g) { return g.first == mapping; });
+        if (group == groups.end()) {
+          groups.emplace_back(mapping, std::vector<Mapping::DataIDPair>{});
+          group = std::prev(groups.end());
+        }
+        group->second.emplace_back(inDataID, outDataID);
+        mappedContexts.push_back(&context);
       }
     }
   }
+  for (auto &group : groups) {
+    PRECICE_DEBUG("Map {} data at once", group.second.size());
+    group.first->map(group.second);
+  }
+  for (impl::DataContext *context : mappedContexts) {
+    PRECICE_DEBUG("Mapped values of data \"{}\" = {}", context->getDataName(), utils::previewRange(3, context->toData()->values())); // @todo might be better to move this debug message into Mapping::map and remove getter DataContext::toData()
+  }
 }
 
 void SolverInterfaceImpl::clearMappings(utils::ptr_vector<MappingContext> contexts)
@@ -295,6 +295,13 @@ public:
       const int *ids,
       double *   positions) const;
 
+  /// @copydoc precice::SolverInterface::setMeshVertexCoordinates()
+  void setMeshVertexCoordinates(
+      int           meshID,
+      int           size,
+      const int *   ids,
+      const double *positions);
+
   /**
    * @brief Gets vertex data ids from positions.
    *
@@ -348,6 +355,25 @@ public:
       int    thirdVertexID,
       int    fourthVertexID);
 
+  /// Sets multiple edges of a solver mesh.
+  void setMeshEdges(
+      MeshID     meshID,
+      int        size,
+      const int *vertices,
+      int *      ids);
+
+  /// Sets multiple triangles and creates/sets edges automatically of a solver mesh.
+  void setMeshTriangles(
+      MeshID     meshID,
+      int        size,
+      const int *vertices);
+
+  /// Sets multiple quadrangles and creates/sets edges automatically of a solver mesh.
+  void setMeshQuads(
+      MeshID     meshID,
+      int        size,
+      const int *vertices);
+
   /**
    * @brief Computes and maps all write data mapped from mesh with given ID.
    *
@@ -488,6 +514,16 @@ public:
       int *     ids,
       double *  coordinates) const;
 
+  /**
+   * @copydoc precice::SolverInterface::getWriteDataBuffer()
+   */
+  double *getWriteDataBuffer(int dataID, int &size);
+
+  /**
+   * @copydoc precice::SolverInterface::getReadDataBuffer()
+   */
+  const double *getReadDataBuffer(int dataID, int &size) const;
+
   /**
    * @brief Sets the location for all output of preCICE.
    *
@@ -604,6 +640,22 @@ private:
    */
   void configure(const config::SolverInterfaceConfiguration &configuration);
 
+  /// Creates a triangle and its missing edges from vertex IDs, caller is the API function for error messages
+  void createTriangleWithEdges(
+      mesh::Mesh &mesh,
+      const char *caller,
+      int         firstVertexID,
+      int         secondVertexID,
+      int         thirdVertexID);
+
+  /// Creates the two triangles of a quadrangle and its missing edges from vertex IDs
+  void createQuadWithEdges(
+      mesh::Mesh &mesh,
+      int         firstVertexID,
+      int         secondVertexID,
+      int         thirdVertexID,
+      int         fourthVertexID);
+
   void configureM2Ns(const m2n::M2NConfiguration::SharedPointer &config);
 
   /// Exports meshes with data and watch point data.
@@ -3069,6 +3069,169 @@ BOOST_AUTO_TEST_CASE(testQuadMappingDiagonalNearestProjectionImplicitEdgesWideKi
   testQuadMappingNearestProjectionWideKite(defineEdgesExplicitly, configFile, context);
 }
 
+/**
+ * @brief Tests setting the connectivity of a mesh with setMeshEdges, setMeshTriangles, and setMeshQuads
+ *
+ */
+BOOST_AUTO_TEST_CASE(testBulkConnectivity)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank));
+  using Eigen::Vector3d;
+
+  SolverInterface cplInterface("SolverOne", _pathToTests + "mapping-nearest-projection.xml", 0, 1);
+  const int       meshOneID = cplInterface.getMeshID("MeshOne");
+
+  std::vector<double> coords{0.0, 0.0, 0.0,
+                             1.0, 0.0, 0.0,
+                             1.0, 1.0, 0.0,
+                             0.0, 1.0, 0.0,
+                             1.0, 2.0, 0.0,
+                             0.0, 2.0, 0.0};
+  std::vector<int>    vertexIDs(6);
+  cplInterface.setMeshVertices(meshOneID, 6, coords.data(), vertexIDs.data());
+
+  std::vector<int> edgeVertices{vertexIDs[0], vertexIDs[1]};
+  std::vector<int> edgeIDs(1, -1);
+  cplInterface.setMeshEdges(meshOneID, 1, edgeVertices.data(), edgeIDs.data());
+  BOOST_TEST(edgeIDs[0] == 0);
+
+  // The explicit edge and the diagonal are shared by the triangles
+  std::vector<int> triangleVertices{vertexIDs[0], vertexIDs[1], vertexIDs[2],
+                                    vertexIDs[0], vertexIDs[2], vertexIDs[3]};
+  cplInterface.setMeshTriangles(meshOneID, 2, triangleVertices.data());
+
+  std::vector<int> quadVertices{vertexIDs[3], vertexIDs[2], vertexIDs[4], vertexIDs[5]};
+  cplInterface.setMeshQuads(meshOneID, 1, quadVertices.data());
+
+  auto &mesh = testing::WhiteboxAccessor::impl(cplInterface).mesh("MeshOne");
+  BOOST_TEST(mesh.vertices().size() == 6);
+  BOOST_TEST(mesh.edges().size() == 9);
+  BOOST_TEST(mesh.triangles().size() == 4);
+
+  cplInterface.finalize();
+}
+
+/// Moves vertices of a sent mesh before and after initialize() and of a local mesh after initialize()
+BOOST_AUTO_TEST_CASE(testSetMeshVertexCoordinates)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  if (context.isNamed("SolverOne")) {
+    SolverInterface cplInterface("SolverOne", _pathToTests + "moving-mesh.xml", 0, 1);
+    const int       meshID = cplInterface.getMeshID("MeshOne");
+    const int       dataID = cplInterface.getDataID("DataOne", meshID);
+
+    std::vector<double> coords{0.0, 0.0, 0.0,
+                               1.0, 0.0, 0.0};
+    std::vector<int>    vertexIDs(2);
+    cplInterface.setMeshVertices(meshID, 2, coords.data(), vertexIDs.data());
+
+    std::vector<double> moved{2.0, 0.0, 0.0};
+    cplInterface.setMeshVertexCoordinates(meshID, 1, &vertexIDs[1], moved.data());
+
+    std::vector<double> positions(6);
+    cplInterface.getMeshVertices(meshID, 2, vertexIDs.data(), positions.data());
+    std::vector<double> expected{0.0, 0.0, 0.0,
+                                 2.0, 0.0, 0.0};
+    BOOST_TEST(positions == expected, boost::test_tools::per_element());
+
+    cplInterface.initialize();
+    std::vector<double> values{1.0, 2.0};
+    cplInterface.writeBlockScalarData(dataID, 2, vertexIDs.data(), values.data());
+    cplInterface.advance(1.0);
+
+    // SolverTwo receives the new coordinates along with the data
+    std::vector<double> movedAgain{3.0, 0.0, 0.0};
+    cplInterface.setMeshVertexCoordinates(meshID, 1, &vertexIDs[0], movedAgain.data());
+    cplInterface.writeBlockScalarData(dataID, 2, vertexIDs.data(), values.data());
+    cplInterface.advance(1.0);
+    BOOST_TEST(not cplInterface.isCouplingOngoing());
+    cplInterface.finalize();
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    SolverInterface cplInterface("SolverTwo", _pathToTests + "moving-mesh.xml", 0, 1);
+    const int       meshID = cplInterface.getMeshID("MeshTwo");
+    const int       dataID = cplInterface.getDataID("DataOne", meshID);
+
+    std::vector<double> coords{0.1, 0.0, 0.0};
+    int                 vertexID = -1;
+    cplInterface.setMeshVertices(meshID, 1, coords.data(), &vertexID);
+
+    cplInterface.initialize();
+    double value = 0.0;
+    cplInterface.readScalarData(dataID, vertexID, value);
+    BOOST_TEST(value == 1.0);
+
+    // Closest to the second vertex of MeshOne at its initial position
+    std::vector<double> moved{2.9, 0.0, 0.0};
+    cplInterface.setMeshVertexCoordinates(meshID, 1, &vertexID, moved.data());
+    std::vector<double> position(3);
+    cplInterface.getMeshVertices(meshID, 1, &vertexID, position.data());
+    BOOST_TEST(position == moved, boost::test_tools::per_element());
+
+    // The mappings are recomputed for both moved meshes, where the first vertex of MeshOne became the closest
+    cplInterface.advance(1.0);
+    auto &receivedMesh = testing::WhiteboxAccessor::impl(cplInterface).mesh("MeshOne");
+    BOOST_TEST(testing::equals(receivedMesh.vertices()[0].getCoords(), Eigen::Vector3d(3.0, 0.0, 0.0)));
+    cplInterface.readScalarData(dataID, vertexID, value);
+    BOOST_TEST(value == 1.0);
+    cplInterface.advance(1.0);
+    BOOST_TEST(not cplInterface.isCouplingOngoing());
+    cplInterface.finalize();
+  }
+}
+
+/// Writes and reads data through the internal buffers and consecutive vertex IDs
+BOOST_AUTO_TEST_CASE(testDataBuffers)
+{
+  PRECICE_TEST("SolverOne"_on(1_rank), "SolverTwo"_on(1_rank));
+
+  std::vector<double> coords{0.0, 0.0, 0.0,
+                             1.0, 0.0, 0.0,
+                             2.0, 0.0, 0.0};
+  std::vector<int>    vertexIDs(3);
+
+  if (context.isNamed("SolverOne")) {
+    SolverInterface cplInterface("SolverOne", _pathToTests + "mapping-nearest-projection.xml", 0, 1);
+    const int       meshID = cplInterface.getMeshID("MeshOne");
+    const int       dataID = cplInterface.getDataID("DataOne", meshID);
+    cplInterface.setMeshVertices(meshID, 3, coords.data(), vertexIDs.data());
+    cplInterface.initialize();
+
+    int     size   = 0;
+    double *buffer = cplInterface.getWriteDataBuffer(dataID, size);
+    BOOST_TEST(size == 3);
+    std::fill_n(buffer, size, 1.0);
+
+    // Overwrites the last two values as a single block
+    std::vector<double> values{2.0, 3.0};
+    cplInterface.writeBlockScalarData(dataID, 2, &vertexIDs[1], values.data());
+
+    cplInterface.advance(1.0);
+    cplInterface.finalize();
+  } else {
+    BOOST_TEST(context.isNamed("SolverTwo"));
+    SolverInterface cplInterface("SolverTwo", _pathToTests + "mapping-nearest-projection.xml", 0, 1);
+    const int       meshID = cplInterface.getMeshID("MeshTwo");
+    const int       dataID = cplInterface.getDataID("DataOne", meshID);
+    cplInterface.setMeshVertices(meshID, 3, coords.data(), vertexIDs.data());
+    cplInterface.initialize();
+
+    int           size   = 0;
+    const double *buffer = cplInterface.getReadDataBuffer(dataID, size);
+    BOOST_TEST(size == 3);
+    std::vector<double> expected{1.0, 2.0, 3.0};
+    BOOST_TEST(std::vector<double>(buffer, buffer + size) == expected, boost::test_tools::per_element());
+
+    std::vector<double> values(3);
+    cplInterface.readBlockScalarData(dataID, 3, vertexIDs.data(), values.data());
+    BOOST_TEST(values == expected, boost::test_tools::per_element());
+
+    cplInterface.advance(1.0);
+    cplInterface.finalize();
+  }
+}
+
 /**
  * @brief method to test whether certain convergence measures give the correct number of iterations
  *
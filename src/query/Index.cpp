@@ -1,13 +1,18 @@
 #include <Eigen/Core>
 #include <algorithm>
+#include <boost/optional.hpp>
 #include <boost/range/irange.hpp>
+#include <iterator>
 #include <utility>
 
 #include "Index.hpp"
 #include "impl/Indexer.hpp"
+#include "impl/SpaceFillingCurve.hpp"
 #include "logging/LogMacros.hpp"
+#include "math/barycenter.hpp"
 #include "precice/types.hpp"
 #include "utils/Event.hpp"
+#include "utils/ThreadPool.hpp"
 
 namespace precice {
 extern bool syncMode;
@@ -18,8 +23,97 @@ precice::logging::Logger Index::_log{"query::Index"};
 namespace bg  = boost::geometry;
 namespace bgi = boost::geometry::index;
 
+namespace {
+/// Number of consecutive locations on the space-filling curve queried by a thread at once
+constexpr std::ptrdiff_t BATCH_GRAIN_SIZE = 256;
+
+/**
+ * Candidates with a barycentric coordinate from the batched kernels below this bound, relative
+ * to the largest coordinate, cannot be interpolations. The bound is loose, as the kernels round
+ * differently than mapping::Polation, which decides on the remaining candidates.
+ */
+constexpr double REJECTION_TOLERANCE = 1e-8;
+
+/// Returns whether the barycentric coordinates of a candidate exclude an interpolation
+template <typename Coordinates>
+bool isRejected(const Coordinates &coordinates)
+{
+  const double bound = -REJECTION_TOLERANCE * (1.0 + coordinates.cwiseAbs().maxCoeff());
+  // NaN coordinates of degenerated candidates compare false, hence they are never rejected
+  return (coordinates.array() < bound).any();
+}
+
+/// Copies the coordinates of a vertex to a row of the corners
+void setCorner(math::barycenter::BatchedCorners &corners, int row, const mesh::Vertex &vertex)
+{
+  corners.row(row) = Eigen::Map<const Eigen::RowVector3d>(vertex.rawCoords().data());
+}
+
+Index::RawCoords toRaw(const Eigen::VectorXd &location)
+{
+  Index::RawCoords raw{};
+  std::copy_n(location.data(), location.size(), raw.begin());
+  return raw;
+}
+
+/// Queries the n nearest primitives of an R-tree and writes them to matches sorted by distance
+template <typename Match, typename Tree, typename Container>
+int nearestPrimitives(const Tree &tree, const Container &primitives, const Index::RawCoords &location, span<Match> matches)
+{
+  int found = 0;
+  tree.query(bgi::nearest(location, matches.size()), boost::make_function_output_iterator([&](const auto &value) {
+               const auto id    = value.second;
+               matches[found++] = Match(bg::distance(location, primitives[id]), id);
+             }));
+  std::sort(matches.begin(), matches.begin() + found);
+  return found;
+}
+} // namespace
+
 struct Index::IndexImpl {
   impl::MeshIndices indices;
+
+  /// Add the vertex index to the local cache
+  const impl::VertexIndex &vertexIndex(const mesh::PtrMesh &mesh, utils::ThreadPool *pool = nullptr)
+  {
+    if (not indices.vertexIndex) {
+      precice::utils::Event e("query.index.getVertexIndexTree." + mesh->getName());
+      indices.vertexIndex = impl::Indexer::instance()->getVertexIndex(mesh, pool);
+    }
+    return *indices.vertexIndex;
+  }
+
+  /// Add the edge tree to the local cache
+  const impl::EdgeTraits::RTree &edgeRTree(const mesh::PtrMesh &mesh)
+  {
+    if (not indices.edgeRTree) {
+      precice::utils::Event e("query.index.getEdgeIndexTree." + mesh->getName());
+      indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(mesh);
+    }
+    return *indices.edgeRTree;
+  }
+
+  /// Add the triangle tree to the local cache
+  const impl::TriangleTraits::RTree &triangleRTree(const mesh::PtrMesh &mesh)
+  {
+    if (not indices.triangleRTree) {
+      precice::utils::Event e("query.index.getTriangleIndexTree." + mesh->getName());
+      indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(mesh);
+    }
+    return *indices.triangleRTree;
+  }
+};
+
+struct Index::ProjectionCandidates {
+  std::vector<EdgeMatch>     edges;
+  std::vector<TriangleMatch> triangles;
+
+  /// Corners and barycentric coordinates of the candidates for the batched kernels
+  math::barycenter::BatchedCorners         a, b, c;
+  Eigen::Matrix<double, Eigen::Dynamic, 3> coordinates;
+
+  /// The location as required by Polation
+  Eigen::VectorXd location;
 };
 
 Index::Index(mesh::PtrMesh mesh)
@@ -31,109 +125,269 @@ Index::Index(mesh::PtrMesh mesh)
 Index::~Index() = default;
 
 VertexMatch Index::getClosestVertex(const Eigen::VectorXd &sourceCoord)
+{
+  return getClosestVertex(toRaw(sourceCoord));
+}
+
+VertexMatch Index::getClosestVertex(const RawCoords &location)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
-  }
+  const auto &index = _pimpl->vertexIndex(_mesh);
 
   PRECICE_ASSERT(not _mesh->vertices().empty(), _mesh->getName());
   VertexMatch match;
-  _pimpl->indices.vertexRTree->query(bgi::nearest(sourceCoord, 1), boost::make_function_output_iterator([&](size_t matchID) {
-                                       match = VertexMatch(bg::distance(sourceCoord, _mesh->vertices()[matchID]), matchID);
-                                     }));
+  index.nearest(location.data(), 1, &match);
   return match;
 }
 
-std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord, int n)
+std::vector<VertexMatch> Index::getClosestVertices(const Eigen::VectorXd &sourceCoord, int n)
+{
+  std::vector<VertexMatch> matches(n);
+  matches.resize(getClosestVertices(toRaw(sourceCoord), matches));
+  return matches;
+}
+
+int Index::getClosestVertices(const RawCoords &location, span<VertexMatch> matches)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.edgeRTree) {
-    precice::utils::Event e("query.index.getEdgeIndexTree." + _mesh->getName());
-    _pimpl->indices.edgeRTree = impl::Indexer::instance()->getEdgeRTree(_mesh);
+  const auto &index = _pimpl->vertexIndex(_mesh);
+  return index.nearest(location.data(), matches.size(), matches.data());
+}
+
+std::vector<VertexMatch> Index::getClosestVerticesBatched(const Eigen::MatrixXd &locations, int n, utils::ThreadPool *pool)
+{
+  PRECICE_ASSERT(locations.rows() == _mesh->getDimensions(), locations.rows(), _mesh->getDimensions());
+  std::vector<VertexMatch> matches(locations.cols() * n);
+  getClosestVerticesBatched({locations.data(), static_cast<std::size_t>(locations.size())}, matches, pool);
+  return matches;
+}
+
+void Index::getClosestVerticesBatched(span<const double> coordinates, span<VertexMatch> matches, utils::ThreadPool *pool)
+{
+  const int          dimensions = _mesh->getDimensions();
+  const Eigen::Index count      = coordinates.size() / dimensions;
+  PRECICE_TRACE(count, matches.size());
+  PRECICE_ASSERT(coordinates.size() % dimensions == 0, coordinates.size(), dimensions);
+  PRECICE_ASSERT(count == 0 || matches.size() % count == 0, matches.size(), count);
+  if (count == 0) {
+    return;
+  }
+  const int n = matches.size() / count;
+  PRECICE_ASSERT(n > 0, n);
+  // Add the index to the local cache, before the threads share it
+  const auto &index = _pimpl->vertexIndex(_mesh, pool);
+
+  PRECICE_ASSERT(not _mesh->vertices().empty(), _mesh->getName());
+  const std::vector<int> order = impl::mortonOrder(Eigen::Map<const Eigen::MatrixXd>(coordinates.data(), dimensions, count));
+  std::fill(matches.begin(), matches.end(), VertexMatch{});
+
+  auto queryRange = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t position = begin; position < end; ++position) {
+      const int location = order[position];
+      index.nearest(coordinates.data() + location * dimensions, n, matches.data() + location * n);
+    }
+  };
+
+  if (pool) {
+    pool->parallelFor(0, order.size(), BATCH_GRAIN_SIZE, queryRange);
+  } else {
+    queryRange(0, order.size());
   }
+}
 
-  std::vector<EdgeMatch> matches;
-  _pimpl->indices.edgeRTree->query(bgi::nearest(sourceCoord, n), boost::make_function_output_iterator([&](size_t matchID) {
-                                     matches.emplace_back(bg::distance(sourceCoord, _mesh->edges()[matchID]), matchID);
-                                   }));
-  std::sort(matches.begin(), matches.end());
+std::vector<EdgeMatch> Index::getClosestEdges(const Eigen::VectorXd &sourceCoord, int n)
+{
+  std::vector<EdgeMatch> matches(n);
+  matches.resize(getClosestEdges(toRaw(sourceCoord), matches));
   return matches;
 }
 
-std::vector<TriangleMatch> Index::getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n)
+int Index::getClosestEdges(const RawCoords &location, span<EdgeMatch> matches)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.triangleRTree) {
-    precice::utils::Event e("query.index.getTriangleIndexTree." + _mesh->getName());
-    _pimpl->indices.triangleRTree = impl::Indexer::instance()->getTriangleRTree(_mesh);
-  }
-
-  std::vector<TriangleMatch> matches;
-  _pimpl->indices.triangleRTree->query(bgi::nearest(sourceCoord, n),
-                                       boost::make_function_output_iterator([&](impl::TriangleTraits::IndexType const &match) {
-                                         matches.emplace_back(bg::distance(sourceCoord, _mesh->triangles()[match.second]), match.second);
-                                       }));
-  std::sort(matches.begin(), matches.end());
+  return nearestPrimitives(_pimpl->edgeRTree(_mesh), _mesh->edges(), location, matches);
+}
+
+std::vector<TriangleMatch> Index::getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n)
+{
+  std::vector<TriangleMatch> matches(n);
+  matches.resize(getClosestTriangles(toRaw(sourceCoord), matches));
   return matches;
 }
 
+int Index::getClosestTriangles(const RawCoords &location, span<TriangleMatch> matches)
+{
+  PRECICE_TRACE();
+  return nearestPrimitives(_pimpl->triangleRTree(_mesh), _mesh->triangles(), location, matches);
+}
+
 std::vector<VertexID> Index::getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius)
+{
+  std::vector<VertexID> matches;
+  getVerticesInsideBox(centerVertex.rawCoords(), radius, matches);
+  return matches;
+}
+
+void Index::getVerticesInsideBox(const RawCoords &center, double radius, std::vector<VertexID> &matches)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (_pimpl->indices.vertexRTree == nullptr) {
-    precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
+  RawCoords min{}, max{};
+  for (int d = 0; d < _mesh->getDimensions(); ++d) {
+    min[d] = center[d] - radius;
+    max[d] = center[d] + radius;
   }
+  getVerticesInsideBox(min, max, matches);
+  matches.erase(std::remove_if(matches.begin(), matches.end(), [&](VertexID i) { return bg::distance(center, _mesh->vertices()[i]) > radius; }),
+                matches.end());
+}
 
-  // Prepare boost::geometry box
-  auto coords    = centerVertex.getCoords();
-  auto searchBox = query::makeBox(coords.array() - radius, coords.array() + radius);
-
+std::vector<VertexID> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
+{
   std::vector<VertexID> matches;
-  _pimpl->indices.vertexRTree->query(bgi::intersects(searchBox) and bg::index::satisfies([&](size_t const i) { return bg::distance(centerVertex, _mesh->vertices()[i]) <= radius; }),
-                                     std::back_inserter(matches));
+  getVerticesInsideBox(toRaw(bb.minCorner()), toRaw(bb.maxCorner()), matches);
   return matches;
 }
 
-std::vector<VertexID> Index::getVerticesInsideBox(const mesh::BoundingBox &bb)
+void Index::getVerticesInsideBox(const RawCoords &min, const RawCoords &max, std::vector<VertexID> &matches)
 {
   PRECICE_TRACE();
-  // Add tree to the local cache
-  if (not _pimpl->indices.vertexRTree) {
-    precice::utils::Event e("query.index.getVertexIndexTree." + _mesh->getName());
-    _pimpl->indices.vertexRTree = impl::Indexer::instance()->getVertexRTree(_mesh);
+  matches.clear();
+  _pimpl->vertexIndex(_mesh).insideBox(min.data(), max.data(), matches);
+}
+
+std::vector<std::vector<VertexID>> Index::getVerticesInsideBoxes(const std::vector<mesh::BoundingBox> &boxes, utils::ThreadPool *pool)
+{
+  PRECICE_TRACE(boxes.size());
+  std::vector<std::vector<VertexID>> matches(boxes.size());
+  if (_mesh->vertices().empty()) {
+    return matches;
+  }
+  // Add the index to the local cache, before the threads share it
+  const auto &index = _pimpl->vertexIndex(_mesh, pool);
+
+  auto queryRange = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t i = begin; i < end; ++i) {
+      if (boxes[i].empty()) {
+        continue;
+      }
+      const auto min = toRaw(boxes[i].minCorner());
+      const auto max = toRaw(boxes[i].maxCorner());
+      index.insideBox(min.data(), max.data(), matches[i]);
+      std::sort(matches[i].begin(), matches[i].end());
+    }
+  };
+
+  if (pool) {
+    pool->parallelFor(0, boxes.size(), 1, queryRange);
+  } else {
+    queryRange(0, boxes.size());
   }
-  std::vector<VertexID> matches;
-  _pimpl->indices.vertexRTree->query(bgi::intersects(query::makeBox(bb.minCorner(), bb.maxCorner())), std::back_inserter(matches));
   return matches;
 }
 
 ProjectionMatch Index::findNearestProjection(const Eigen::VectorXd &location, int n)
 {
+  return findNearestProjection(toRaw(location), n);
+}
+
+ProjectionMatch Index::findNearestProjection(const RawCoords &location, int n)
+{
+  ProjectionCandidates candidates;
+  return findNearestProjection(location, n, candidates);
+}
+
+std::vector<ProjectionMatch> Index::findNearestProjectionBatched(span<const double> coordinates, int n, utils::ThreadPool *pool)
+{
+  const int          dimensions = _mesh->getDimensions();
+  const Eigen::Index count      = coordinates.size() / dimensions;
+  PRECICE_TRACE(count, n);
+  PRECICE_ASSERT(coordinates.size() % dimensions == 0, coordinates.size(), dimensions);
+  if (count == 0) {
+    return {};
+  }
+
+  // Add all trees to the local cache, before the threads share them
+  _pimpl->vertexIndex(_mesh, pool);
+  _pimpl->edgeRTree(_mesh);
+  if (dimensions == 3) {
+    _pimpl->triangleRTree(_mesh);
+  }
+
+  const std::vector<int>                       order = impl::mortonOrder(Eigen::Map<const Eigen::MatrixXd>(coordinates.data(), dimensions, count));
+  std::vector<boost::optional<ProjectionMatch>> projections(count);
+
+  auto queryRange = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    ProjectionCandidates candidates;
+    for (std::ptrdiff_t position = begin; position < end; ++position) {
+      const int location    = order[position];
+      projections[location] = findNearestProjection(packedLocation(coordinates, location), n, candidates);
+    }
+  };
+
+  if (pool) {
+    pool->parallelFor(0, order.size(), BATCH_GRAIN_SIZE, queryRange);
+  } else {
+    queryRange(0, order.size());
+  }
+
+  std::vector<ProjectionMatch> matches;
+  matches.reserve(count);
+  for (auto &projection : projections) {
+    matches.push_back(std::move(*projection));
+  }
+  return matches;
+}
+
+Index::RawCoords Index::packedLocation(span<const double> coordinates, std::size_t i) const
+{
+  const int dimensions = _mesh->getDimensions();
+  RawCoords location{};
+  std::copy_n(coordinates.data() + i * dimensions, dimensions, location.begin());
+  return location;
+}
+
+ProjectionMatch Index::findNearestProjection(const RawCoords &location, int n, ProjectionCandidates &candidates)
+{
+  candidates.location = Eigen::Map<const Eigen::VectorXd>(location.data(), _mesh->getDimensions());
   if (_mesh->getDimensions() == 2) {
-    return findEdgeProjection(location, n);
+    return findEdgeProjection(location, n, candidates);
   } else {
-    return findTriangleProjection(location, n);
+    return findTriangleProjection(location, n, candidates);
   }
 }
 
-ProjectionMatch Index::findVertexProjection(const Eigen::VectorXd &location)
+ProjectionMatch Index::findVertexProjection(const RawCoords &location)
 {
   auto match = getClosestVertex(location);
   return {mapping::Polation{_mesh->vertices()[match.index]}, match.distance};
 }
 
-ProjectionMatch Index::findEdgeProjection(const Eigen::VectorXd &location, int n)
+ProjectionMatch Index::findEdgeProjection(const RawCoords &location, int n, ProjectionCandidates &candidates)
 {
-  auto matchedEdges = getClosestEdges(location, n);
-  for (const auto &match : matchedEdges) {
-    auto polation = mapping::Polation(location, _mesh->edges()[match.index]);
+  candidates.edges.resize(n);
+  const int found = getClosestEdges(location, candidates.edges);
+
+  // Reject candidates at once using the orthogonal projection, which matches Polation in 2D only
+  const bool filter = _mesh->getDimensions() == 2;
+  if (filter) {
+    candidates.a.resize(found, 3);
+    candidates.b.resize(found, 3);
+    candidates.coordinates.resize(found, 3);
+    for (int i = 0; i < found; ++i) {
+      const auto &edge = _mesh->edges()[candidates.edges[i].index];
+      setCorner(candidates.a, i, edge.vertex(0));
+      setCorner(candidates.b, i, edge.vertex(1));
+    }
+    math::barycenter::calcBarycentricCoordsForEdges(candidates.a, candidates.b, Eigen::Map<const Eigen::Vector3d>(location.data()),
+                                                    candidates.coordinates.leftCols<2>());
+  }
+
+  for (int i = 0; i < found; ++i) {
+    if (filter && isRejected(candidates.coordinates.row(i).head<2>())) {
+      continue;
+    }
+    const auto &match    = candidates.edges[i];
+    auto        polation = mapping::Polation(candidates.location, _mesh->edges()[match.index]);
     if (polation.isInterpolation()) {
       return {polation, match.distance};
     }
@@ -142,18 +396,72 @@ ProjectionMatch Index::findEdgeProjection(const Eigen::VectorXd &location, int n
   return findVertexProjection(location);
 }
 
-ProjectionMatch Index::findTriangleProjection(const Eigen::VectorXd &location, int n)
+ProjectionMatch Index::findTriangleProjection(const RawCoords &location, int n, ProjectionCandidates &candidates)
 {
-  auto matchedTriangles = getClosestTriangles(location, n);
-  for (const auto &match : matchedTriangles) {
-    auto polation = mapping::Polation(location, _mesh->triangles()[match.index]);
+  candidates.triangles.resize(n);
+  const int found = getClosestTriangles(location, candidates.triangles);
+
+  // Reject candidates at once, before computing the interpolation of the remaining ones
+  candidates.a.resize(found, 3);
+  candidates.b.resize(found, 3);
+  candidates.c.resize(found, 3);
+  candidates.coordinates.resize(found, 3);
+  for (int i = 0; i < found; ++i) {
+    const auto &triangle = _mesh->triangles()[candidates.triangles[i].index];
+    setCorner(candidates.a, i, triangle.vertex(0));
+    setCorner(candidates.b, i, triangle.vertex(1));
+    setCorner(candidates.c, i, triangle.vertex(2));
+  }
+  math::barycenter::calcBarycentricCoordsForTriangles(candidates.a, candidates.b, candidates.c, Eigen::Map<const Eigen::Vector3d>(location.data()),
+                                                      candidates.coordinates);
+
+  for (int i = 0; i < found; ++i) {
+    if (isRejected(candidates.coordinates.row(i))) {
+      continue;
+    }
+    const auto &match    = candidates.triangles[i];
+    auto        polation = mapping::Polation(candidates.location, _mesh->triangles()[match.index]);
     if (polation.isInterpolation()) {
       return {polation, match.distance};
     }
   }
 
   // Could not triangle find projection element, fall back to edge projection
-  return findEdgeProjection(location, n);
+  return findEdgeProjection(location, n, candidates);
+}
+
+void setIndexBackend(mesh::Mesh &mesh, IndexBackend backend)
+{
+  mesh.setIndexBackend(backend);
+  impl::Indexer::instance()->clearCache(mesh.getID());
+}
+
+std::vector<std::vector<int>> getOverlappingBoxes(const std::vector<mesh::BoundingBox> &boxes)
+{
+  using BoxValue = std::pair<RTreeBox, int>;
+  std::vector<BoxValue> values;
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    if (not boxes[i].empty()) {
+      values.emplace_back(makeBox(boxes[i].minCorner(), boxes[i].maxCorner()), i);
+    }
+  }
+  // The packing constructor builds the tree in one go
+  const bgi::rtree<BoxValue, impl::RTreeParameters> tree(values);
+
+  std::vector<std::vector<int>> overlaps(boxes.size());
+  std::vector<BoxValue>         matches;
+  for (const BoxValue &value : values) {
+    matches.clear();
+    tree.query(bgi::intersects(value.first), std::back_inserter(matches));
+    auto &overlap = overlaps[value.second];
+    for (const BoxValue &match : matches) {
+      if (match.second != value.second) {
+        overlap.push_back(match.second);
+      }
+    }
+    std::sort(overlap.begin(), overlap.end());
+  }
+  return overlaps;
 }
 
 void clearCache()
@@ -171,5 +479,10 @@ void clearCache(mesh::Mesh &mesh)
   impl::Indexer::instance()->clearCache(mesh.getID());
 }
 
+void updateCache(mesh::Mesh &mesh)
+{
+  impl::Indexer::instance()->update(mesh);
+}
+
 } // namespace query
 } // namespace precice
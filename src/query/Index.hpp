@@ -7,12 +7,18 @@
 #include "mapping/Polation.hpp"
 #include "mesh/BoundingBox.hpp"
 #include "mesh/Edge.hpp"
+#include "mesh/Mesh.hpp"
 #include "mesh/SharedPointer.hpp"
 #include "mesh/Triangle.hpp"
 #include "mesh/Vertex.hpp"
 #include "precice/types.hpp"
+#include "utils/span.hpp"
 
 namespace precice {
+namespace utils {
+class ThreadPool;
+}
+
 namespace query {
 
 /// Type used for the IDs of matching entities
@@ -45,34 +51,109 @@ using VertexMatch   = MatchType<struct VertexMatchTag>;
 using EdgeMatch     = MatchType<struct EdgeMatchTag>;
 using TriangleMatch = MatchType<struct TriangleTag>;
 
+using mesh::IndexBackend;
+
 /// Struct representing a projection match
 struct ProjectionMatch {
   mapping::Polation polation;
   Distance          distance;
 };
 
-/// Class to query the index trees of the mesh
+/**
+ * @brief Class to query the index trees of the mesh
+ *
+ * Besides the queries for Eigen vectors, there are overloads for raw coordinates, which write
+ * the results into buffers of the caller. Reusing these buffers, queries do not allocate memory.
+ */
 class Index {
 
 public:
+  using RawCoords = mesh::Vertex::RawCoords;
+
   Index(mesh::PtrMesh mesh);
   ~Index();
 
   /// Get n number of closest vertices to the given vertex
   VertexMatch getClosestVertex(const Eigen::VectorXd &sourceCoord);
 
+  /// Get the closest vertex to the given location, unused coordinates have to be zero
+  VertexMatch getClosestVertex(const RawCoords &location);
+
+  /// Get n number of closest vertices to the given vertex, sorted by distance
+  std::vector<VertexMatch> getClosestVertices(const Eigen::VectorXd &sourceCoord, int n);
+
+  /**
+   * @brief Get the closest vertices to the given location, sorted by distance.
+   *
+   * @param[in] location the coordinates of the location, unused coordinates have to be zero
+   * @param[out] matches the buffer for the matches, its size is the number of vertices to find
+   *
+   * @returns the number of matches, which is less than the size of matches if the mesh has less vertices
+   */
+  int getClosestVertices(const RawCoords &location, span<VertexMatch> matches);
+
+  /**
+   * @brief Get n number of closest vertices to each of the given locations, sorted by distance.
+   *
+   * The locations are queried in the order of a space-filling curve, such that consecutive
+   * queries traverse the same nodes of the tree. They are distributed over the threads of
+   * the pool, if given. Locations are not allocated individually.
+   *
+   * @param[in] locations the coordinates of one location per column
+   * @param[in] n the number of vertices per location
+   * @param[in] pool the threads to use, serial if nullptr
+   *
+   * @returns the matches of location i at [i * n, (i + 1) * n), padded with invalid matches if the mesh has less than n vertices
+   */
+  std::vector<VertexMatch> getClosestVerticesBatched(const Eigen::MatrixXd &locations, int n = 1, utils::ThreadPool *pool = nullptr);
+
+  /**
+   * @brief Get the closest vertices to each of the given packed locations, sorted by distance.
+   *
+   * @param[in] coordinates the coordinates of all locations, with as many entries per location as the mesh has dimensions
+   * @param[out] matches the matches of location i at [i * n, (i + 1) * n), padded with invalid matches if the mesh has less than n vertices
+   * @param[in] pool the threads to use, serial if nullptr
+   *
+   * @see getClosestVerticesBatched(const Eigen::MatrixXd &, int, utils::ThreadPool *)
+   */
+  void getClosestVerticesBatched(span<const double> coordinates, span<VertexMatch> matches, utils::ThreadPool *pool = nullptr);
+
   /// Get n number of closest edges to the given vertex
   std::vector<EdgeMatch> getClosestEdges(const Eigen::VectorXd &sourceCoord, int n);
 
+  /// Get the closest edges to the given location sorted by distance, returns the number of matches
+  int getClosestEdges(const RawCoords &location, span<EdgeMatch> matches);
+
   /// Get n number of closest triangles to the given vertex
   std::vector<TriangleMatch> getClosestTriangles(const Eigen::VectorXd &sourceCoord, int n);
 
+  /// Get the closest triangles to the given location sorted by distance, returns the number of matches
+  int getClosestTriangles(const RawCoords &location, span<TriangleMatch> matches);
+
   /// Return all the vertices inside the box formed by vertex and radius
   std::vector<VertexID> getVerticesInsideBox(const mesh::Vertex &centerVertex, double radius);
 
+  /// Replace the content of matches by all vertices within radius of the location
+  void getVerticesInsideBox(const RawCoords &center, double radius, std::vector<VertexID> &matches);
+
   /// Return all the vertices inside a bounding box
   std::vector<VertexID> getVerticesInsideBox(const mesh::BoundingBox &bb);
 
+  /// Replace the content of matches by all vertices inside the box [min, max]
+  void getVerticesInsideBox(const RawCoords &min, const RawCoords &max, std::vector<VertexID> &matches);
+
+  /**
+   * @brief Get the vertices inside each of the given bounding boxes.
+   *
+   * The index is built once and the boxes are distributed over the threads of the pool, if given.
+   *
+   * @param[in] boxes the bounding boxes to query
+   * @param[in] pool the threads to use, serial if nullptr
+   *
+   * @returns the ascending IDs of the vertices inside box i at position i
+   */
+  std::vector<std::vector<VertexID>> getVerticesInsideBoxes(const std::vector<mesh::BoundingBox> &boxes, utils::ThreadPool *pool = nullptr);
+
   /**
    * @brief Find the closest interpolation element to the given location. 
    * If exists, triangle or edge projection element is returned. If not vertex projection element, which is the nearest neighbor is returned.
@@ -85,23 +166,63 @@ public:
   */
   ProjectionMatch findNearestProjection(const Eigen::VectorXd &location, int n);
 
+  /// Find the closest interpolation element to the given location, unused coordinates have to be zero
+  ProjectionMatch findNearestProjection(const RawCoords &location, int n);
+
+  /**
+   * @brief Find the closest interpolation elements to each of the given packed locations.
+   *
+   * The buffers for the candidates are shared between all locations of a thread.
+   *
+   * @param[in] coordinates the coordinates of all locations, with as many entries per location as the mesh has dimensions
+   * @param[in] n how many nearest edges/faces are going to be checked
+   * @param[in] pool the threads to use, serial if nullptr
+   *
+   * @returns the projection of every location
+   */
+  std::vector<ProjectionMatch> findNearestProjectionBatched(span<const double> coordinates, int n, utils::ThreadPool *pool = nullptr);
+
 private:
   struct IndexImpl;
   std::unique_ptr<IndexImpl> _pimpl;
 
+  /// Buffers for the candidate elements of a projection
+  struct ProjectionCandidates;
+
   const mesh::PtrMesh             _mesh;
   static precice::logging::Logger _log;
 
+  /// Returns the raw coordinates of the packed location i
+  RawCoords packedLocation(span<const double> coordinates, std::size_t i) const;
+
+  ProjectionMatch findNearestProjection(const RawCoords &location, int n, ProjectionCandidates &candidates);
+
   /// Closest vertex projection element is always the nearest neighbor
-  ProjectionMatch findVertexProjection(const Eigen::VectorXd &location);
+  ProjectionMatch findVertexProjection(const RawCoords &location);
 
   /// Find closest edge interpolation element. If cannot be found, it falls back to vertex projection
-  ProjectionMatch findEdgeProjection(const Eigen::VectorXd &location, int n);
+  ProjectionMatch findEdgeProjection(const RawCoords &location, int n, ProjectionCandidates &candidates);
 
   /// Find closest face interpolation element. If cannot be found, it falls back to first edge interpolation element, then vertex if necessary
-  ProjectionMatch findTriangleProjection(const Eigen::VectorXd &location, int n);
+  ProjectionMatch findTriangleProjection(const RawCoords &location, int n, ProjectionCandidates &candidates);
 };
 
+/**
+ * @brief Selects the data structure indexing the vertices of a mesh.
+ *
+ * Queries for edges and triangles always use R-trees. Clears the cache of the mesh.
+ */
+void setIndexBackend(mesh::Mesh &mesh, IndexBackend backend);
+
+/**
+ * @brief Finds the overlapping pairs of the given bounding boxes with an R-tree over all boxes.
+ *
+ * Touching boxes overlap, empty boxes do not overlap with any box.
+ *
+ * @returns for every box the sorted indices of the other boxes it overlaps
+ */
+std::vector<std::vector<int>> getOverlappingBoxes(const std::vector<mesh::BoundingBox> &boxes);
+
 /// Clear all the cache
 void clearCache();
 
@@ -111,5 +232,8 @@ void clearCache(MeshID meshID);
 /// Clear the cache of given mesh
 void clearCache(mesh::Mesh &mesh);
 
+/// Update the cache of given mesh incrementally after it changed, see impl::Indexer::update
+void updateCache(mesh::Mesh &mesh);
+
 } // namespace query
 } // namespace precice
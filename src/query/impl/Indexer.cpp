@@ -1,4 +1,6 @@
-#include <boost/range/irange.hpp>
+#include <Eigen/Core>
+#include <utility>
+#include <vector>
 
 #include "Indexer.hpp"
 #include "mesh/BoundingBox.hpp"
@@ -14,76 +16,144 @@ std::shared_ptr<Indexer> Indexer::instance()
   return indexer;
 }
 
-MeshIndices &Indexer::cacheEntry(MeshID meshID)
+namespace {
+
+VertexTraits::IndexType indexValue(const mesh::Vertex &vertex, std::size_t i)
+{
+  return {vertex.rawCoords(), i};
+}
+
+EdgeTraits::IndexType indexValue(const mesh::Edge &edge, std::size_t i)
+{
+  return {{edge.vertex(0).rawCoords(), edge.vertex(1).rawCoords()}, i};
+}
+
+TriangleTraits::IndexType indexValue(const mesh::Triangle &triangle, std::size_t i)
+{
+  return {bg::return_envelope<RTreeBox>(triangle), i};
+}
+
+bool isSame(const mesh::Vertex::RawCoords &lhs, const mesh::Vertex::RawCoords &rhs)
+{
+  return lhs == rhs;
+}
+
+bool isSame(const bg::model::segment<mesh::Vertex::RawCoords> &lhs, const bg::model::segment<mesh::Vertex::RawCoords> &rhs)
+{
+  return lhs.first == rhs.first and lhs.second == rhs.second;
+}
+
+bool isSame(const RTreeBox &lhs, const RTreeBox &rhs)
 {
-  auto result = _cachedTrees.emplace(std::make_pair(meshID, MeshIndices{}));
-  return result.first->second;
+  return lhs.min_corner() == rhs.min_corner() and lhs.max_corner() == rhs.max_corner();
+}
+
+/// Builds the tree of all primitives of a container
+template <typename Traits>
+typename Traits::Ptr buildRTree(const typename Traits::MeshContainer &primitives)
+{
+  // Generating the rtree is expensive, so passing everything in the ctor is
+  // the best we can do. The values are generated beforehand, as a random access
+  // range allows for more efficient indexing.
+  std::vector<typename Traits::IndexType> values;
+  values.reserve(primitives.size());
+  for (std::size_t i = 0; i < primitives.size(); ++i) {
+    values.push_back(indexValue(primitives[i], i));
+  }
+  impl::RTreeParameters params;
+  return std::make_shared<typename Traits::RTree>(values, params);
+}
+
+/// Appends the values of the tree, whose stored geometry does not match their primitive anymore
+template <typename Tree, typename Container>
+void collectOutdated(const Tree &tree, const Container &primitives, std::vector<typename Tree::value_type> &outdated)
+{
+  for (const auto &value : tree) {
+    PRECICE_ASSERT(value.second < primitives.size(), value.second, primitives.size());
+    if (not isSame(value.first, indexValue(primitives[value.second], value.second).first)) {
+      outdated.push_back(value);
+    }
+  }
+}
+
+/// Reinserts the outdated values and inserts the primitives appended after the first indexed ones
+template <typename Tree, typename Container>
+void refresh(Tree &tree, const Container &primitives, const std::vector<typename Tree::value_type> &outdated, std::size_t indexed)
+{
+  for (const auto &value : outdated) {
+    tree.remove(value);
+    tree.insert(indexValue(primitives[value.second], value.second));
+  }
+  for (std::size_t i = indexed; i < primitives.size(); ++i) {
+    tree.insert(indexValue(primitives[i], i));
+  }
+}
+
+} // namespace
+
+MeshIndices &Indexer::cacheEntry(const mesh::Mesh &mesh)
+{
+  auto &entry   = _cachedTrees[mesh.getID()];
+  auto &indexed = entry.indexed;
+  if (entry.indices.empty() or
+      indexed.vertices != mesh.vertices().size() or
+      indexed.edges != mesh.edges().size() or
+      indexed.triangles != mesh.triangles().size()) {
+    update(mesh, entry);
+  }
+  return entry.indices;
 }
 
 VertexTraits::Ptr Indexer::getVertexRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
-  if (cache.vertexRTree) {
-    return cache.vertexRTree;
+  auto &cache = cacheEntry(*mesh);
+  if (not cache.vertexRTree) {
+    cache.vertexRTree = buildRTree<VertexTraits>(mesh->vertices());
   }
-
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters     params;
-  VertexTraits::IndexGetter ind(mesh->vertices());
-  auto                      tree = std::make_shared<VertexTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->vertices().size()), params, ind);
-
-  cache.vertexRTree = std::move(tree);
   return cache.vertexRTree;
 }
 
-EdgeTraits::Ptr Indexer::getEdgeRTree(const mesh::PtrMesh &mesh)
+std::shared_ptr<VertexIndex> Indexer::getVertexIndex(const mesh::PtrMesh &mesh, utils::ThreadPool *pool)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
-  if (cache.edgeRTree) {
-    return cache.edgeRTree;
+  auto &cache = cacheEntry(*mesh);
+  if (cache.vertexIndex) {
+    return cache.vertexIndex;
   }
 
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do. Even passing an index range instead of calling
-  // tree->insert repeatedly is about 10x faster.
-  impl::RTreeParameters   params;
-  EdgeTraits::IndexGetter ind(mesh->edges());
-  auto                    tree = std::make_shared<EdgeTraits::RTree>(
-      boost::irange<std::size_t>(0lu, mesh->edges().size()), params, ind);
-
-  cache.edgeRTree = std::move(tree);
-  return cache.edgeRTree;
+  switch (mesh->getIndexBackend()) {
+  case IndexBackend::RTree:
+    cache.vertexIndex = std::make_shared<RTreeVertexIndex>(*mesh, getVertexRTree(mesh));
+    break;
+  case IndexBackend::KDTree:
+    cache.vertexIndex = std::make_shared<KDTree>(*mesh, pool);
+    break;
+  case IndexBackend::Grid:
+    cache.vertexIndex = std::make_shared<UniformGrid>(*mesh, pool);
+    break;
+  }
+  PRECICE_ASSERT(cache.vertexIndex);
+  return cache.vertexIndex;
 }
 
-TriangleTraits::Ptr Indexer::getTriangleRTree(const mesh::PtrMesh &mesh)
+EdgeTraits::Ptr Indexer::getEdgeRTree(const mesh::PtrMesh &mesh)
 {
   PRECICE_ASSERT(mesh);
-  auto &cache = cacheEntry(mesh->getID());
-  if (cache.triangleRTree) {
-    return cache.triangleRTree;
+  auto &cache = cacheEntry(*mesh);
+  if (not cache.edgeRTree) {
+    cache.edgeRTree = buildRTree<EdgeTraits>(mesh->edges());
   }
+  return cache.edgeRTree;
+}
 
-  // We first generate the values for the triangle rtree.
-  // The resulting vector is a random access range, which can be passed to the
-  // constructor of the rtree for more efficient indexing.
-  std::vector<TriangleTraits::IndexType> elements;
-  elements.reserve(mesh->triangles().size());
-  for (size_t i = 0; i < mesh->triangles().size(); ++i) {
-    auto box = bg::return_envelope<RTreeBox>(mesh->triangles()[i]);
-    elements.emplace_back(std::move(box), i);
+TriangleTraits::Ptr Indexer::getTriangleRTree(const mesh::PtrMesh &mesh)
+{
+  PRECICE_ASSERT(mesh);
+  auto &cache = cacheEntry(*mesh);
+  if (not cache.triangleRTree) {
+    cache.triangleRTree = buildRTree<TriangleTraits>(mesh->triangles());
   }
-
-  // Generating the rtree is expensive, so passing everything in the ctor is
-  // the best we can do.
-  impl::RTreeParameters       params;
-  TriangleTraits::IndexGetter ind;
-  auto                        tree = std::make_shared<TriangleTraits::RTree>(elements, params, ind);
-  cache.triangleRTree              = std::move(tree);
   return cache.triangleRTree;
 }
 
@@ -102,6 +172,70 @@ void Indexer::clearCache(MeshID meshID)
   _cachedTrees.erase(meshID);
 }
 
+void Indexer::update(const mesh::Mesh &mesh)
+{
+  auto entry = _cachedTrees.find(mesh.getID());
+  if (entry != _cachedTrees.end()) {
+    update(mesh, entry->second);
+  }
+}
+
+void Indexer::update(const mesh::Mesh &mesh, CacheEntry &entry)
+{
+  auto &      indices   = entry.indices;
+  auto &      indexed   = entry.indexed;
+  const auto &vertices  = mesh.vertices();
+  const auto &edges     = mesh.edges();
+  const auto &triangles = mesh.triangles();
+
+  bool rebuild = indices.empty() or vertices.size() < indexed.vertices or
+                 edges.size() < indexed.edges or triangles.size() < indexed.triangles;
+
+  // Moved vertices and reconnected primitives do not match the geometry stored in the trees anymore
+  std::vector<VertexTraits::IndexType>   outdatedVertices;
+  std::vector<EdgeTraits::IndexType>     outdatedEdges;
+  std::vector<TriangleTraits::IndexType> outdatedTriangles;
+  if (not rebuild) {
+    if (indices.vertexRTree) {
+      collectOutdated(*indices.vertexRTree, vertices, outdatedVertices);
+    }
+    if (indices.edgeRTree) {
+      collectOutdated(*indices.edgeRTree, edges, outdatedEdges);
+    }
+    if (indices.triangleRTree) {
+      collectOutdated(*indices.triangleRTree, triangles, outdatedTriangles);
+    }
+
+    indexed.updated += outdatedVertices.size() + outdatedEdges.size() + outdatedTriangles.size() +
+                       (vertices.size() - indexed.vertices) + (edges.size() - indexed.edges) + (triangles.size() - indexed.triangles);
+    rebuild = indexed.updated > REBUILD_THRESHOLD * indexed.built;
+  }
+
+  if (rebuild) {
+    indices         = MeshIndices{};
+    indexed.built   = vertices.size() + edges.size() + triangles.size();
+    indexed.updated = 0;
+  } else {
+    if (indices.vertexRTree) {
+      refresh(*indices.vertexRTree, vertices, outdatedVertices, indexed.vertices);
+    }
+    if (indices.edgeRTree) {
+      refresh(*indices.edgeRTree, edges, outdatedEdges, indexed.edges);
+    }
+    if (indices.triangleRTree) {
+      refresh(*indices.triangleRTree, triangles, outdatedTriangles, indexed.triangles);
+    }
+    // Only the R-tree backend shares the updated tree, the others are rebuilt on demand
+    if (mesh.getIndexBackend() != IndexBackend::RTree) {
+      indices.vertexIndex.reset();
+    }
+  }
+
+  indexed.vertices  = vertices.size();
+  indexed.edges     = edges.size();
+  indexed.triangles = triangles.size();
+}
+
 } // namespace impl
 } // namespace query
 } // namespace precice
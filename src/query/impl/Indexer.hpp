@@ -1,9 +1,11 @@
 #pragma once
 
 #include <map>
+#include <vector>
 
 #include "precice/types.hpp"
 #include "query/impl/RTreeAdapter.hpp"
+#include "query/impl/VertexIndex.hpp"
 
 namespace precice {
 namespace query {
@@ -14,9 +16,16 @@ using EdgeTraits     = impl::RTreeTraits<mesh::Edge>;
 using TriangleTraits = impl::RTreeTraits<mesh::Triangle>;
 
 struct MeshIndices {
-  VertexTraits::Ptr   vertexRTree;
-  EdgeTraits::Ptr     edgeRTree;
-  TriangleTraits::Ptr triangleRTree;
+  VertexTraits::Ptr            vertexRTree;
+  std::shared_ptr<VertexIndex> vertexIndex;
+  EdgeTraits::Ptr              edgeRTree;
+  TriangleTraits::Ptr          triangleRTree;
+
+  /// Whether any index has been built
+  bool empty() const
+  {
+    return not(vertexRTree or vertexIndex or edgeRTree or triangleRTree);
+  }
 };
 
 /// Class to encapsulate boost::geometry implementations
@@ -30,6 +39,14 @@ public:
   /// Return vertex index tree from cache, if cache is empty, create the tree
   VertexTraits::Ptr getVertexRTree(const mesh::PtrMesh &mesh);
 
+  /**
+   * @brief Return the vertex index of the backend selected for the mesh from cache, if cache is empty, create the index
+   *
+   * @param[in] mesh the mesh to index
+   * @param[in] pool the threads to construct the index with, serial if nullptr
+   */
+  std::shared_ptr<VertexIndex> getVertexIndex(const mesh::PtrMesh &mesh, utils::ThreadPool *pool = nullptr);
+
   /// Return edge index tree from cache, if cache is empty, create the tree
   EdgeTraits::Ptr getEdgeRTree(const mesh::PtrMesh &mesh);
 
@@ -44,10 +61,52 @@ public:
   /// Clear the cache only for the given mesh
   void clearCache(MeshID meshID);
 
+  /**
+   * @brief Updates the cached indices of a mesh after it changed.
+   *
+   * The R-trees store the geometry of the primitives along with them. Values whose geometry does not match
+   * the mesh anymore, due to moved vertices or reconnected primitives, are reinserted and appended primitives
+   * are inserted. The indices are dropped and rebuilt on their next use instead, if primitives were removed,
+   * or if more than REBUILD_THRESHOLD of the primitives were updated since the indices were built, as
+   * incremental updates degrade the trees compared to bulk loading.
+   *
+   * Appended primitives are also detected without calling this function, moved vertices are not.
+   */
+  void update(const mesh::Mesh &mesh);
+
+  /// Fraction of updated primitives since the last build, beyond which the indices are rebuilt
+  static constexpr double REBUILD_THRESHOLD = 0.5;
+
 private:
+  /// The number of primitives of a mesh at the time they were indexed
+  struct IndexedPrimitives {
+    std::size_t vertices = 0;
+
+    std::size_t edges = 0;
+
+    std::size_t triangles = 0;
+
+    /// Number of primitives when the indices were built
+    std::size_t built = 0;
+
+    /// Number of primitives inserted or reinserted since the indices were built
+    std::size_t updated = 0;
+  };
+
+  struct CacheEntry {
+    MeshIndices       indices;
+    IndexedPrimitives indexed;
+  };
+
   Indexer(){};
-  MeshIndices &              cacheEntry(MeshID meshID);
-  std::map<int, MeshIndices> _cachedTrees;
+
+  /// Returns the cache entry of the mesh, after updating it if primitives were appended
+  MeshIndices &cacheEntry(const mesh::Mesh &mesh);
+
+  /// Updates the indices of the entry to the mesh
+  void update(const mesh::Mesh &mesh, CacheEntry &entry);
+
+  std::map<int, CacheEntry> _cachedTrees;
 };
 
 } // namespace impl
@@ -242,79 +242,20 @@ struct PrimitiveTraits<mesh::Triangle> {
   using MeshContainer = mesh::Mesh::TriangleContainer;
 };
 
-/// Makes a utils::PtrVector indexable and thus be usable in boost::geometry::rtree
-template <typename Container>
-class PtrVectorIndexable {
-  using size_type = typename Container::container::size_type;
-  using cref      = const typename Container::value_type &;
-  Container const &container;
-
-public:
-  using result_type = cref;
-
-  explicit PtrVectorIndexable(Container const &c)
-      : container(c)
-  {
-  }
-
-  result_type operator()(size_type i) const
-  {
-    return container[i];
-  }
-};
-
-/// Makes a std::vector indexable and thus be usable in boost::geometry::rtree
-template <typename Container>
-class VectorIndexable {
-  using size_type = typename Container::size_type;
-  using cref      = const typename Container::value_type &;
-  Container const &container;
-
-public:
-  using result_type = cref;
-
-  explicit VectorIndexable(Container const &c)
-      : container(c)
-  {
-  }
-
-  result_type operator()(size_type i) const
-  {
-    return container[i];
-  }
+/// The geometry of a primitive, which is stored along with its index in the rtree
+template <class Primitive>
+struct IndexedGeometry {
+  using type = RTreeBox;
 };
 
-template <typename Primitive>
-class IsDirectIndexableHelper {
-private:
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::point_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(char *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::segment_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(int *);
-  template <typename T, typename = typename std::enable_if<
-                            std::is_same<
-                                typename boost::geometry::traits::tag<T>::type,
-                                boost::geometry::box_tag>::value,
-                            std::nullptr_t>::type>
-  static std::true_type test(void *);
-
-  template <typename T>
-  static std::false_type test(...);
-
-public:
-  using type = decltype(test<Primitive>(nullptr));
+template <>
+struct IndexedGeometry<pm::Vertex> {
+  using type = pm::Vertex::RawCoords;
 };
 
-template <class Primitive>
-struct IsDirectIndexable : impl::IsDirectIndexableHelper<Primitive>::type {
+template <>
+struct IndexedGeometry<pm::Edge> {
+  using type = boost::geometry::model::segment<pm::Vertex::RawCoords>;
 };
 
 /// The type traits of a rtree based on a Primitive
@@ -323,15 +264,10 @@ struct RTreeTraits {
   using MeshContainer      = typename PrimitiveTraits<Primitive>::MeshContainer;
   using MeshContainerIndex = typename MeshContainer::size_type;
 
-  using IndexType = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      MeshContainerIndex,
-      std::pair<RTreeBox, MeshContainerIndex>>::type;
+  /// The geometry at the time of insertion is part of the value, such that outdated values can still be removed
+  using IndexType = std::pair<typename IndexedGeometry<Primitive>::type, MeshContainerIndex>;
 
-  using IndexGetter = typename std::conditional<
-      IsDirectIndexable<Primitive>::value,
-      impl::VectorIndexable<MeshContainer>,
-      boost::geometry::index::indexable<IndexType>>::type;
+  using IndexGetter = boost::geometry::index::indexable<IndexType>;
 
   using RTree = boost::geometry::index::rtree<IndexType, RTreeParameters, IndexGetter>;
   using Ptr   = std::shared_ptr<RTree>;
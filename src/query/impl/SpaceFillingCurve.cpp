@@ -0,0 +1,64 @@
+#include "query/impl/SpaceFillingCurve.hpp"
+#include <algorithm>
+#include <utility>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace query {
+namespace impl {
+
+namespace {
+/// Spreads the lowest bits of value, such that they are followed by (stride - 1) zero bits each
+std::uint64_t spreadBits(std::uint64_t value, int bits, int stride)
+{
+  std::uint64_t result = 0;
+  for (int bit = 0; bit < bits; ++bit) {
+    result |= ((value >> bit) & 1u) << (bit * stride);
+  }
+  return result;
+}
+} // namespace
+
+std::uint64_t mortonCode(const Eigen::Ref<const Eigen::VectorXd> &location, const Eigen::VectorXd &min, const Eigen::VectorXd &max)
+{
+  const int dimensions = location.size();
+  PRECICE_ASSERT(dimensions == 2 || dimensions == 3, dimensions);
+  PRECICE_ASSERT(min.size() == dimensions && max.size() == dimensions, min.size(), max.size(), dimensions);
+
+  // 64 bits are shared by all axes
+  const int           bits    = 64 / dimensions;
+  const std::uint64_t maximum = (std::uint64_t{1} << bits) - 1;
+
+  std::uint64_t code = 0;
+  for (int d = 0; d < dimensions; ++d) {
+    const double extent   = max[d] - min[d];
+    const double relative = extent > 0 ? (location[d] - min[d]) / extent : 0.0;
+    const auto   cell     = static_cast<std::uint64_t>(std::min(std::max(relative, 0.0), 1.0) * maximum);
+    code |= spreadBits(cell, bits, dimensions) << d;
+  }
+  return code;
+}
+
+std::vector<int> mortonOrder(const Eigen::Ref<const Eigen::MatrixXd> &locations)
+{
+  const int size = locations.cols();
+  if (size == 0) {
+    return {};
+  }
+  const Eigen::VectorXd min = locations.rowwise().minCoeff();
+  const Eigen::VectorXd max = locations.rowwise().maxCoeff();
+
+  std::vector<std::pair<std::uint64_t, int>> codes(size);
+  for (int i = 0; i < size; ++i) {
+    codes[i] = {mortonCode(locations.col(i), min, max), i};
+  }
+  std::sort(codes.begin(), codes.end());
+
+  std::vector<int> order(size);
+  std::transform(codes.begin(), codes.end(), order.begin(), [](const auto &code) { return code.second; });
+  return order;
+}
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <cstdint>
+#include <vector>
+
+namespace precice {
+namespace query {
+namespace impl {
+
+/**
+ * @brief Computes the Morton code of a location, which interleaves the bits of its quantized coordinates.
+ *
+ * @param[in] location the coordinates of a 2 or 3 dimensional location
+ * @param[in] min, max the bounding box used to quantize the coordinates
+ */
+std::uint64_t mortonCode(const Eigen::Ref<const Eigen::VectorXd> &location, const Eigen::VectorXd &min, const Eigen::VectorXd &max);
+
+/**
+ * @brief Returns the order of the locations along the Morton (Z-order) curve.
+ *
+ * Locations close on the curve are close in space. Processing queries in this order lets
+ * consecutive queries traverse the same nodes of a spatial index.
+ *
+ * @param[in] locations the coordinates of one location per column
+ * @returns the indices of the columns of locations in curve order
+ */
+std::vector<int> mortonOrder(const Eigen::Ref<const Eigen::MatrixXd> &locations);
+
+} // namespace impl
+} // namespace query
+} // namespace precice
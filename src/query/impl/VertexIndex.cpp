@@ -0,0 +1,425 @@
+#include "query/impl/VertexIndex.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include "mesh/Mesh.hpp"
+#include "mesh/Utils.hpp"
+#include "mesh/Vertex.hpp"
+#include "utils/ThreadPool.hpp"
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace query {
+namespace impl {
+
+namespace bgi = boost::geometry::index;
+
+namespace {
+/// Meshes with fewer vertices are indexed serially, as the threads do not pay off
+constexpr std::ptrdiff_t PARALLEL_BUILD_SIZE = 1 << 15;
+
+/// Number of vertices per chunk when computing cells in parallel
+constexpr std::ptrdiff_t BUILD_GRAIN_SIZE = 4096;
+
+bool buildInParallel(const utils::ThreadPool *pool, std::size_t vertices)
+{
+  return pool && pool->size() > 1 && static_cast<std::ptrdiff_t>(vertices) >= PARALLEL_BUILD_SIZE;
+}
+
+double squaredDistance(const double *a, const double *b, int dimensions)
+{
+  double sum = 0.0;
+  for (int d = 0; d < dimensions; ++d) {
+    const double diff = a[d] - b[d];
+    sum += diff * diff;
+  }
+  return sum;
+}
+
+/// Inserts a match into the found matches sorted by distance, of which at most n are kept
+void insertMatch(VertexMatch *matches, int n, int &found, double distance, VertexID id)
+{
+  if (found == n && not(distance < matches[n - 1].distance)) {
+    return;
+  }
+  int position = (found < n) ? found++ : n - 1;
+  while (position > 0 && distance < matches[position - 1].distance) {
+    matches[position] = matches[position - 1];
+    --position;
+  }
+  matches[position] = VertexMatch(distance, id);
+}
+
+/// Turns the squared distances of the matches into distances
+void finishMatches(VertexMatch *matches, int found)
+{
+  std::for_each(matches, matches + found, [](VertexMatch &match) { match.distance = std::sqrt(match.distance); });
+}
+
+bool isInside(const double *point, const double *min, const double *max, int dimensions)
+{
+  for (int d = 0; d < dimensions; ++d) {
+    if (point[d] < min[d] || point[d] > max[d]) {
+      return false;
+    }
+  }
+  return true;
+}
+} // namespace
+
+RTreeVertexIndex::RTreeVertexIndex(const mesh::Mesh &mesh, RTreeTraits<mesh::Vertex>::Ptr tree)
+    : _mesh(mesh), _tree(std::move(tree))
+{
+  PRECICE_ASSERT(_tree);
+}
+
+int RTreeVertexIndex::nearest(const double *point, int n, VertexMatch *matches) const
+{
+  mesh::Vertex::RawCoords location{};
+  std::copy_n(point, _mesh.getDimensions(), location.begin());
+
+  int found = 0;
+  _tree->query(bgi::nearest(location, n), boost::make_function_output_iterator([&](const RTreeTraits<mesh::Vertex>::IndexType &value) {
+                 matches[found++] = VertexMatch(bg::distance(location, value.first), value.second);
+               }));
+  std::sort(matches, matches + found);
+  return found;
+}
+
+void RTreeVertexIndex::insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const
+{
+  mesh::Vertex::RawCoords lower{}, upper{};
+  std::copy_n(min, _mesh.getDimensions(), lower.begin());
+  std::copy_n(max, _mesh.getDimensions(), upper.begin());
+  _tree->query(bgi::intersects(makeBox(lower, upper)), boost::make_function_output_iterator([&](const RTreeTraits<mesh::Vertex>::IndexType &value) {
+                 ids.push_back(value.second);
+               }));
+}
+
+KDTree::KDTree(const mesh::Mesh &mesh, utils::ThreadPool *pool)
+    : _dimensions(mesh.getDimensions())
+{
+  const std::vector<double> coords = mesh::packedCoordinates(mesh);
+  const std::ptrdiff_t      size   = mesh.vertices().size();
+
+  _ids.resize(size);
+  std::iota(_ids.begin(), _ids.end(), 0);
+  _splitValues.resize(size);
+  _splitAxes.resize(size);
+
+  if (buildInParallel(pool, size)) {
+    // Split the upper levels serially, until there are enough subtrees to balance the threads,
+    // or until all of them are leaves, as small meshes may have less leaves than threads.
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> nodes{{0, size}};
+    bool                                                   splitAny = true;
+    while (splitAny && nodes.size() < 4u * pool->size()) {
+      splitAny = false;
+      std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> children;
+      for (const auto &node : nodes) {
+        if (node.second - node.first <= LEAF_SIZE) {
+          children.push_back(node);
+          continue;
+        }
+        const std::ptrdiff_t median = split(node.first, node.second, coords);
+        children.emplace_back(node.first, median);
+        children.emplace_back(median, node.second);
+        splitAny = true;
+      }
+      nodes = std::move(children);
+    }
+    pool->parallelFor(0, nodes.size(), 1, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      for (std::ptrdiff_t i = begin; i < end; ++i) {
+        build(nodes[i].first, nodes[i].second, coords);
+      }
+    });
+  } else {
+    build(0, size, coords);
+  }
+
+  _points.resize(coords.size());
+  for (std::ptrdiff_t position = 0; position < size; ++position) {
+    std::copy_n(&coords[_ids[position] * _dimensions], _dimensions, &_points[position * _dimensions]);
+  }
+}
+
+std::ptrdiff_t KDTree::split(std::ptrdiff_t begin, std::ptrdiff_t end, const std::vector<double> &coords)
+{
+  PRECICE_ASSERT(end - begin > LEAF_SIZE, begin, end);
+  std::array<double, 3> min, max;
+  min.fill(std::numeric_limits<double>::max());
+  max.fill(std::numeric_limits<double>::lowest());
+  for (std::ptrdiff_t i = begin; i < end; ++i) {
+    const double *point = &coords[_ids[i] * _dimensions];
+    for (int d = 0; d < _dimensions; ++d) {
+      min[d] = std::min(min[d], point[d]);
+      max[d] = std::max(max[d], point[d]);
+    }
+  }
+  int axis = 0;
+  for (int d = 1; d < _dimensions; ++d) {
+    if (max[d] - min[d] > max[axis] - min[axis]) {
+      axis = d;
+    }
+  }
+
+  const std::ptrdiff_t median = begin + (end - begin) / 2;
+  std::nth_element(_ids.begin() + begin, _ids.begin() + median, _ids.begin() + end, [&](VertexID a, VertexID b) {
+    return coords[a * _dimensions + axis] < coords[b * _dimensions + axis];
+  });
+  _splitValues[median] = coords[_ids[median] * _dimensions + axis];
+  _splitAxes[median]   = axis;
+  return median;
+}
+
+void KDTree::build(std::ptrdiff_t begin, std::ptrdiff_t end, const std::vector<double> &coords)
+{
+  if (end - begin <= LEAF_SIZE) {
+    return;
+  }
+  const std::ptrdiff_t median = split(begin, end, coords);
+  build(begin, median, coords);
+  build(median, end, coords);
+}
+
+int KDTree::nearest(const double *point, int n, VertexMatch *matches) const
+{
+  int found = 0;
+  nearest(0, _ids.size(), point, n, matches, found);
+  finishMatches(matches, found);
+  return found;
+}
+
+void KDTree::nearest(std::ptrdiff_t begin, std::ptrdiff_t end, const double *point, int n, VertexMatch *matches, int &found) const
+{
+  if (end - begin <= LEAF_SIZE) {
+    for (std::ptrdiff_t i = begin; i < end; ++i) {
+      insertMatch(matches, n, found, squaredDistance(point, &_points[i * _dimensions], _dimensions), _ids[i]);
+    }
+    return;
+  }
+
+  // Descend into the side containing the point first, the other side only if it may be closer than the worst match
+  const std::ptrdiff_t median = begin + (end - begin) / 2;
+  const double         offset = point[_splitAxes[median]] - _splitValues[median];
+  if (offset < 0) {
+    nearest(begin, median, point, n, matches, found);
+    if (found < n || offset * offset < matches[n - 1].distance) {
+      nearest(median, end, point, n, matches, found);
+    }
+  } else {
+    nearest(median, end, point, n, matches, found);
+    if (found < n || offset * offset < matches[n - 1].distance) {
+      nearest(begin, median, point, n, matches, found);
+    }
+  }
+}
+
+void KDTree::insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const
+{
+  insideBox(0, _ids.size(), min, max, ids);
+}
+
+void KDTree::insideBox(std::ptrdiff_t begin, std::ptrdiff_t end, const double *min, const double *max, std::vector<VertexID> &ids) const
+{
+  if (end - begin <= LEAF_SIZE) {
+    for (std::ptrdiff_t i = begin; i < end; ++i) {
+      if (isInside(&_points[i * _dimensions], min, max, _dimensions)) {
+        ids.push_back(_ids[i]);
+      }
+    }
+    return;
+  }
+
+  const std::ptrdiff_t median = begin + (end - begin) / 2;
+  const int            axis   = _splitAxes[median];
+  if (min[axis] <= _splitValues[median]) {
+    insideBox(begin, median, min, max, ids);
+  }
+  if (max[axis] >= _splitValues[median]) {
+    insideBox(median, end, min, max, ids);
+  }
+}
+
+UniformGrid::UniformGrid(const mesh::Mesh &mesh, utils::ThreadPool *pool)
+    : _dimensions(mesh.getDimensions())
+{
+  const std::vector<double> coords = mesh::packedCoordinates(mesh);
+  const std::ptrdiff_t      size   = mesh.vertices().size();
+  if (size == 0) {
+    _cellOffsets.assign(2, 0);
+    return;
+  }
+
+  std::array<double, 3> max;
+  _origin.fill(std::numeric_limits<double>::max());
+  max.fill(std::numeric_limits<double>::lowest());
+  for (std::ptrdiff_t i = 0; i < size; ++i) {
+    for (int d = 0; d < _dimensions; ++d) {
+      _origin[d] = std::min(_origin[d], coords[i * _dimensions + d]);
+      max[d]     = std::max(max[d], coords[i * _dimensions + d]);
+    }
+  }
+
+  // Choose the cell size from the volume spanned by the non-flat axes. Axes shorter than
+  // a cell are flat as well, which requires to recompute the size from the remaining axes.
+  const double     targetCells = std::max<double>(1.0, static_cast<double>(size) / CELL_OCCUPANCY);
+  double           cellSize    = 0.0;
+  std::vector<int> axes;
+  for (int d = 0; d < _dimensions; ++d) {
+    axes.push_back(d);
+  }
+  while (true) {
+    axes.erase(std::remove_if(axes.begin(), axes.end(), [&](int d) { return max[d] - _origin[d] <= cellSize; }), axes.end());
+    if (axes.empty()) {
+      break;
+    }
+    double volume = 1.0;
+    for (int d : axes) {
+      volume *= max[d] - _origin[d];
+    }
+    const double candidate = std::pow(volume / targetCells, 1.0 / axes.size());
+    const bool   converged = std::none_of(axes.begin(), axes.end(), [&](int d) { return max[d] - _origin[d] <= candidate; });
+    cellSize               = candidate;
+    if (converged) {
+      break;
+    }
+  }
+  if (not(cellSize > 0.0) || not std::isfinite(cellSize)) {
+    cellSize = 1.0;
+  }
+  _inverseCellSize = 1.0 / cellSize;
+  for (int d = 0; d < _dimensions; ++d) {
+    _cells[d] = std::max<std::int64_t>(1, static_cast<std::int64_t>(std::ceil((max[d] - _origin[d]) * _inverseCellSize)));
+  }
+
+  // Sort the vertices by cell using a counting sort
+  std::vector<std::int64_t> cellOfVertex(size);
+  auto                      computeCells = [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+    for (std::ptrdiff_t i = begin; i < end; ++i) {
+      std::array<std::int64_t, 3> cell{0, 0, 0};
+      for (int d = 0; d < _dimensions; ++d) {
+        cell[d] = cellOf(coords[i * _dimensions + d], d);
+      }
+      cellOfVertex[i] = cellIndex(cell);
+    }
+  };
+  if (buildInParallel(pool, size)) {
+    pool->parallelFor(0, size, BUILD_GRAIN_SIZE, computeCells);
+  } else {
+    computeCells(0, size);
+  }
+
+  _cellOffsets.assign(_cells[0] * _cells[1] * _cells[2] + 1, 0);
+  for (std::int64_t cell : cellOfVertex) {
+    ++_cellOffsets[cell + 1];
+  }
+  std::partial_sum(_cellOffsets.begin(), _cellOffsets.end(), _cellOffsets.begin());
+
+  _ids.resize(size);
+  _points.resize(coords.size());
+  std::vector<std::int64_t> next(_cellOffsets.begin(), _cellOffsets.end() - 1);
+  for (std::ptrdiff_t i = 0; i < size; ++i) {
+    const std::int64_t position = next[cellOfVertex[i]]++;
+    _ids[position]              = i;
+    std::copy_n(&coords[i * _dimensions], _dimensions, &_points[position * _dimensions]);
+  }
+}
+
+std::int64_t UniformGrid::cellOf(double coordinate, int axis) const
+{
+  // Clamp before the conversion, which overflows for points far outside of the grid
+  const double cell = std::floor((coordinate - _origin[axis]) * _inverseCellSize);
+  return static_cast<std::int64_t>(std::min<double>(_cells[axis] - 1, std::max(0.0, cell)));
+}
+
+int UniformGrid::nearest(const double *point, int n, VertexMatch *matches) const
+{
+  int found = 0;
+  if (_ids.empty()) {
+    return found;
+  }
+
+  std::array<std::int64_t, 3> center{0, 0, 0};
+  for (int d = 0; d < _dimensions; ++d) {
+    center[d] = cellOf(point[d], d);
+  }
+
+  // Visit the cells in rings of growing distance around the cell of the point, until
+  // all cells outside of the visited ones are further away than the worst match.
+  const double cellSize = 1.0 / _inverseCellSize;
+  for (std::int64_t ring = 0;; ++ring) {
+    std::array<std::int64_t, 3> lower{0, 0, 0}, upper{0, 0, 0};
+    for (int d = 0; d < _dimensions; ++d) {
+      lower[d] = std::max<std::int64_t>(0, center[d] - ring);
+      upper[d] = std::min<std::int64_t>(_cells[d] - 1, center[d] + ring);
+    }
+
+    std::array<std::int64_t, 3> cell;
+    for (cell[2] = lower[2]; cell[2] <= upper[2]; ++cell[2]) {
+      for (cell[1] = lower[1]; cell[1] <= upper[1]; ++cell[1]) {
+        for (cell[0] = lower[0]; cell[0] <= upper[0]; ++cell[0]) {
+          const std::int64_t distance = std::max({std::abs(cell[0] - center[0]), std::abs(cell[1] - center[1]), std::abs(cell[2] - center[2])});
+          if (distance != ring) {
+            continue;
+          }
+          const std::int64_t index = cellIndex(cell);
+          for (std::int64_t i = _cellOffsets[index]; i < _cellOffsets[index + 1]; ++i) {
+            insertMatch(matches, n, found, squaredDistance(point, &_points[i * _dimensions], _dimensions), _ids[i]);
+          }
+        }
+      }
+    }
+
+    bool   complete = true;
+    double bound    = std::numeric_limits<double>::max();
+    for (int d = 0; d < _dimensions; ++d) {
+      if (lower[d] > 0) {
+        complete = false;
+        bound    = std::min(bound, point[d] - (_origin[d] + lower[d] * cellSize));
+      }
+      if (upper[d] < _cells[d] - 1) {
+        complete = false;
+        bound    = std::min(bound, _origin[d] + (upper[d] + 1) * cellSize - point[d]);
+      }
+    }
+    bound = std::max(bound, 0.0);
+    if (complete || (found == n && matches[n - 1].distance <= bound * bound)) {
+      break;
+    }
+  }
+
+  finishMatches(matches, found);
+  return found;
+}
+
+void UniformGrid::insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const
+{
+  if (_ids.empty()) {
+    return;
+  }
+  std::array<std::int64_t, 3> lower{0, 0, 0}, upper{0, 0, 0};
+  for (int d = 0; d < _dimensions; ++d) {
+    lower[d] = cellOf(min[d], d);
+    upper[d] = cellOf(max[d], d);
+  }
+
+  std::array<std::int64_t, 3> cell;
+  for (cell[2] = lower[2]; cell[2] <= upper[2]; ++cell[2]) {
+    for (cell[1] = lower[1]; cell[1] <= upper[1]; ++cell[1]) {
+      for (cell[0] = lower[0]; cell[0] <= upper[0]; ++cell[0]) {
+        const std::int64_t index = cellIndex(cell);
+        for (std::int64_t i = _cellOffsets[index]; i < _cellOffsets[index + 1]; ++i) {
+          if (isInside(&_points[i * _dimensions], min, max, _dimensions)) {
+            ids.push_back(_ids[i]);
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -0,0 +1,167 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "query/Index.hpp"
+#include "query/impl/RTreeAdapter.hpp"
+
+namespace precice {
+namespace utils {
+class ThreadPool;
+}
+
+namespace query {
+namespace impl {
+
+/**
+ * @brief Interface of the data structures indexing the vertices of a mesh.
+ *
+ * Points are given as pointers to the coordinates, which have as many entries as the mesh has dimensions.
+ * All queries are const and may be issued concurrently.
+ */
+class VertexIndex {
+public:
+  virtual ~VertexIndex() = default;
+
+  /**
+   * @brief Finds the n closest vertices of a point.
+   *
+   * @param[in] point the coordinates of the point
+   * @param[in] n the number of vertices to find
+   * @param[out] matches the matches sorted by distance, has to hold at least n entries
+   *
+   * @returns the number of matches, which is less than n if the mesh has less than n vertices
+   */
+  virtual int nearest(const double *point, int n, VertexMatch *matches) const = 0;
+
+  /// Appends all vertices inside the axis-aligned box [min, max] to ids
+  virtual void insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const = 0;
+};
+
+/// Forwards queries to the boost.geometry R-tree, which is shared with Indexer::getVertexRTree
+class RTreeVertexIndex : public VertexIndex {
+public:
+  RTreeVertexIndex(const mesh::Mesh &mesh, RTreeTraits<mesh::Vertex>::Ptr tree);
+
+  int nearest(const double *point, int n, VertexMatch *matches) const override;
+
+  void insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const override;
+
+private:
+  const mesh::Mesh &_mesh;
+
+  RTreeTraits<mesh::Vertex>::Ptr _tree;
+};
+
+/**
+ * @brief A kd-tree over a flat copy of the vertex coordinates.
+ *
+ * The tree is balanced and implicit: every node covers a contiguous range of the reordered
+ * vertices and is split at its median along the axis of its largest extent. Split planes are
+ * stored at the position of the median, hence the tree needs no pointers. Ranges of at most
+ * LEAF_SIZE vertices are leaves, which are scanned linearly.
+ */
+class KDTree : public VertexIndex {
+public:
+  /// Maximal number of vertices in a leaf
+  static constexpr int LEAF_SIZE = 16;
+
+  /**
+   * @brief Builds the tree.
+   *
+   * @param[in] mesh the mesh to index
+   * @param[in] pool the threads building the subtrees of large meshes, serial if nullptr
+   */
+  explicit KDTree(const mesh::Mesh &mesh, utils::ThreadPool *pool = nullptr);
+
+  int nearest(const double *point, int n, VertexMatch *matches) const override;
+
+  void insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const override;
+
+private:
+  int _dimensions;
+
+  /// Coordinates of the vertices in tree order
+  std::vector<double> _points;
+
+  /// IDs of the vertices in tree order
+  std::vector<VertexID> _ids;
+
+  /// Split value of the node whose median is at this position
+  std::vector<double> _splitValues;
+
+  /// Split axis of the node whose median is at this position
+  std::vector<std::uint8_t> _splitAxes;
+
+  /// Splits the node [begin, end), which has to be larger than a leaf, into [begin, median) and [median, end)
+  std::ptrdiff_t split(std::ptrdiff_t begin, std::ptrdiff_t end, const std::vector<double> &coords);
+
+  /// Recursively splits the node [begin, end)
+  void build(std::ptrdiff_t begin, std::ptrdiff_t end, const std::vector<double> &coords);
+
+  void nearest(std::ptrdiff_t begin, std::ptrdiff_t end, const double *point, int n, VertexMatch *matches, int &found) const;
+
+  void insideBox(std::ptrdiff_t begin, std::ptrdiff_t end, const double *min, const double *max, std::vector<VertexID> &ids) const;
+};
+
+/**
+ * @brief A uniform grid of cells over the bounding box of the vertices.
+ *
+ * The cell size is chosen such that a cell contains CELL_OCCUPANCY vertices on average.
+ * Axes along which the mesh is flat get a single layer of cells, which keeps surface meshes
+ * in 3D efficient. The vertices are sorted by cell, cells are offsets into them.
+ */
+class UniformGrid : public VertexIndex {
+public:
+  /// Targeted average number of vertices per cell
+  static constexpr int CELL_OCCUPANCY = 4;
+
+  /**
+   * @brief Builds the grid.
+   *
+   * @param[in] mesh the mesh to index
+   * @param[in] pool the threads computing the cells of large meshes, serial if nullptr
+   */
+  explicit UniformGrid(const mesh::Mesh &mesh, utils::ThreadPool *pool = nullptr);
+
+  int nearest(const double *point, int n, VertexMatch *matches) const override;
+
+  void insideBox(const double *min, const double *max, std::vector<VertexID> &ids) const override;
+
+private:
+  int _dimensions;
+
+  /// Lower corner of the grid
+  std::array<double, 3> _origin{};
+
+  /// Inverse of the edge length of the cells
+  double _inverseCellSize = 1.0;
+
+  /// Number of cells along each axis, 1 for unused axes
+  std::array<std::int64_t, 3> _cells{1, 1, 1};
+
+  /// Vertices of cell i are at [_cellOffsets[i], _cellOffsets[i + 1])
+  std::vector<std::int64_t> _cellOffsets;
+
+  /// Coordinates of the vertices sorted by cell
+  std::vector<double> _points;
+
+  /// IDs of the vertices sorted by cell
+  std::vector<VertexID> _ids;
+
+  /// Returns the cell coordinate of a point along an axis, clamped to the grid
+  std::int64_t cellOf(double coordinate, int axis) const;
+
+  /// Returns the linear index of a cell
+  std::int64_t cellIndex(const std::array<std::int64_t, 3> &cell) const
+  {
+    return (cell[2] * _cells[1] + cell[1]) * _cells[0] + cell[0];
+  }
+};
+
+} // namespace impl
+} // namespace query
+} // namespace precice
@@ -17,8 +17,11 @@
 #include "mesh/Vertex.hpp"
 #include "query/Index.hpp"
 #include "query/impl/Indexer.hpp"
+#include "query/impl/SpaceFillingCurve.hpp"
+#include "query/impl/VertexIndex.hpp"
 #include "testing/TestContext.hpp"
 #include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
 
 using namespace precice;
 using namespace precice::mesh;
@@ -89,6 +92,49 @@ PtrMesh vertexMesh3D()
   mesh->computeBoundingBox();
   return mesh;
 }
+
+/// Creates a mesh of random vertices, which are flat along the last axis if requested
+PtrMesh randomMesh(int dimensions, int size, bool flat)
+{
+  PtrMesh ptr(new Mesh("RandomMesh", dimensions, testing::nextMeshID()));
+  for (int i = 0; i < size; ++i) {
+    Eigen::VectorXd coords = Eigen::VectorXd::Random(dimensions);
+    if (flat) {
+      coords[dimensions - 1] = 0.5;
+    }
+    ptr->createVertex(coords);
+  }
+  return ptr;
+}
+
+/// Compares the queries of a vertex index to the ones of an R-tree
+void compareToRTree(const PtrMesh &mesh, const impl::VertexIndex &index)
+{
+  const int              dimensions = mesh->getDimensions();
+  const int              n          = 4;
+  const auto             rtree      = impl::Indexer::instance()->getVertexRTree(mesh);
+  impl::RTreeVertexIndex reference(*mesh, rtree);
+
+  // Include locations outside of the mesh
+  const Eigen::MatrixXd locations = 1.5 * Eigen::MatrixXd::Random(dimensions, 200);
+  for (int i = 0; i < locations.cols(); ++i) {
+    const double *location = locations.col(i).data();
+    VertexMatch   expected[n], matches[n];
+    BOOST_TEST(index.nearest(location, n, matches) == reference.nearest(location, n, expected));
+    for (int j = 0; j < n; ++j) {
+      BOOST_TEST(matches[j].distance == expected[j].distance, boost::test_tools::tolerance(1e-12));
+    }
+
+    const Eigen::VectorXd min = locations.col(i).array() - 0.3;
+    const Eigen::VectorXd max = locations.col(i).array() + 0.3;
+    std::vector<VertexID> inside, expectedInside;
+    index.insideBox(min.data(), max.data(), inside);
+    reference.insideBox(min.data(), max.data(), expectedInside);
+    std::sort(inside.begin(), inside.end());
+    std::sort(expectedInside.begin(), expectedInside.end());
+    BOOST_TEST(inside == expectedInside, boost::test_tools::per_element());
+  }
+}
 } // namespace
 
 BOOST_AUTO_TEST_SUITE(QueryTests)
@@ -119,6 +165,98 @@ BOOST_AUTO_TEST_CASE(Query3DVertex)
   BOOST_TEST(result.distance == 0.28284271247461906);
 }
 
+BOOST_AUTO_TEST_CASE(Query3DVertices)
+{
+  PRECICE_TEST(1_rank);
+  auto            mesh = vertexMesh3D();
+  Index           indexTree(mesh);
+  Eigen::Vector3d location(0.9, 0.0, 0.8);
+
+  auto results = indexTree.getClosestVertices(location, 3);
+  BOOST_TEST(results.size() == 3);
+  BOOST_TEST(mesh->vertices().at(results[0].index).getCoords() == Eigen::Vector3d(1, 0, 1));
+  BOOST_TEST(mesh->vertices().at(results[1].index).getCoords() == Eigen::Vector3d(1, 0, 0));
+  BOOST_TEST(mesh->vertices().at(results[2].index).getCoords() == Eigen::Vector3d(0, 0, 1));
+  BOOST_TEST(std::is_sorted(results.begin(), results.end()));
+}
+
+BOOST_AUTO_TEST_CASE(Query3DVerticesBatched)
+{
+  PRECICE_TEST(1_rank);
+  auto                  mesh = vertexMesh3D();
+  Index                 indexTree(mesh);
+  utils::ThreadPool     pool(2);
+  const Eigen::MatrixXd locations = Eigen::MatrixXd::Random(3, 1000);
+
+  auto results = indexTree.getClosestVerticesBatched(locations, 3, &pool);
+  BOOST_TEST(results.size() == 3000);
+  for (int i = 0; i < locations.cols(); ++i) {
+    auto expected = indexTree.getClosestVertices(locations.col(i), 3);
+    for (int j = 0; j < 3; ++j) {
+      BOOST_TEST(results[i * 3 + j].distance == expected[j].distance);
+    }
+    BOOST_TEST(results[i * 3].index == expected[0].index);
+  }
+
+  // Less vertices than requested are padded with invalid matches
+  Eigen::MatrixXd single(3, 1);
+  single << 0.9, 0.0, 0.8;
+  auto padded = indexTree.getClosestVerticesBatched(single, 10);
+  BOOST_TEST(padded.size() == 10);
+  BOOST_TEST(mesh->vertices().at(padded[0].index).getCoords() == Eigen::Vector3d(1, 0, 1));
+  BOOST_TEST(padded[9].index == NO_MATCH);
+}
+
+BOOST_AUTO_TEST_CASE(Query3DVerticesRaw)
+{
+  PRECICE_TEST(1_rank);
+  auto             mesh = vertexMesh3D();
+  Index            indexTree(mesh);
+  Index::RawCoords location{0.9, 0.0, 0.8};
+
+  std::vector<VertexMatch> matches(10);
+  BOOST_TEST(indexTree.getClosestVertices(location, matches) == 8);
+  BOOST_TEST(mesh->vertices().at(matches[0].index).getCoords() == Eigen::Vector3d(1, 0, 1));
+  BOOST_TEST(std::is_sorted(matches.begin(), matches.begin() + 8));
+  BOOST_TEST(indexTree.getClosestVertex(location).index == matches[0].index);
+
+  // The buffer of the results is reused
+  std::vector<VertexID> inside{42};
+  indexTree.getVerticesInsideBox(Index::RawCoords{0.8, 1, 0}, 0.81, inside);
+  BOOST_TEST(inside.size() == 2);
+  indexTree.getVerticesInsideBox(Index::RawCoords{-1, -1, -1}, Index::RawCoords{0.5, 0.5, 0.5}, inside);
+  BOOST_TEST(inside == std::vector<VertexID>{0}, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(Query3DVerticesInsideBoxes)
+{
+  PRECICE_TEST(1_rank);
+  auto              mesh = vertexMesh3D();
+  Index             indexTree(mesh);
+  utils::ThreadPool pool(2);
+
+  std::vector<BoundingBox> boxes(3, BoundingBox(3));
+  boxes[0] = BoundingBox({-1, 0.5, -1, 0.5, -1, 0.5});
+  boxes[1] = BoundingBox({0.5, 2, -1, 2, -1, 2});
+  // The last box stays empty
+
+  auto inside = indexTree.getVerticesInsideBoxes(boxes, &pool);
+  BOOST_TEST(inside.size() == 3);
+  BOOST_TEST(inside[0] == std::vector<VertexID>{0}, boost::test_tools::per_element());
+  BOOST_TEST(inside[1] == (std::vector<VertexID>{4, 5, 6, 7}), boost::test_tools::per_element());
+  BOOST_TEST(inside[2].empty());
+}
+
+BOOST_AUTO_TEST_CASE(MortonOrder)
+{
+  PRECICE_TEST(1_rank);
+  Eigen::MatrixXd locations(2, 4);
+  locations << 1.0, 0.0, 1.0, 0.0,
+      1.0, 0.0, 0.0, 1.0;
+  auto order = impl::mortonOrder(locations);
+  BOOST_TEST(order == (std::vector<int>{1, 2, 3, 0}), boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_CASE(Query3DFullVertex)
 {
   PRECICE_TEST(1_rank);
@@ -202,6 +340,123 @@ BOOST_AUTO_TEST_CASE(QueryWithBoxEverything)
 
 BOOST_AUTO_TEST_SUITE_END() // Vertex
 
+BOOST_AUTO_TEST_SUITE(Boxes)
+
+BOOST_AUTO_TEST_CASE(OverlappingBoxes2D)
+{
+  PRECICE_TEST(1_rank);
+  std::vector<mesh::BoundingBox> boxes{
+      mesh::BoundingBox(std::vector<double>{0.0, 1.0, 0.0, 1.0}),
+      mesh::BoundingBox(std::vector<double>{1.0, 2.0, 0.5, 1.5}), // touches the first box
+      mesh::BoundingBox(std::vector<double>{3.0, 4.0, 0.0, 1.0}),
+      mesh::BoundingBox(2),                                       // empty
+      mesh::BoundingBox(std::vector<double>{-1.0, 5.0, 0.2, 0.3})};
+
+  const auto overlaps = getOverlappingBoxes(boxes);
+  BOOST_TEST(overlaps.size() == 5);
+  BOOST_TEST(overlaps[0] == std::vector<int>({1, 4}), boost::test_tools::per_element());
+  BOOST_TEST(overlaps[1] == std::vector<int>({0}), boost::test_tools::per_element());
+  BOOST_TEST(overlaps[2] == std::vector<int>({4}), boost::test_tools::per_element());
+  BOOST_TEST(overlaps[3].empty());
+  BOOST_TEST(overlaps[4] == std::vector<int>({0, 2}), boost::test_tools::per_element());
+
+  // Agrees with the pairwise comparison
+  for (std::size_t i = 0; i < boxes.size(); ++i) {
+    for (std::size_t j = 0; j < boxes.size(); ++j) {
+      if (i != j) {
+        const bool found = std::count(overlaps[i].begin(), overlaps[i].end(), static_cast<int>(j)) == 1;
+        BOOST_TEST(found == boxes[i].overlapping(boxes[j]));
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Boxes
+
+BOOST_AUTO_TEST_SUITE(Backends)
+
+BOOST_AUTO_TEST_CASE(KDTree)
+{
+  PRECICE_TEST(1_rank);
+  for (int dimensions : {2, 3}) {
+    for (bool flat : {false, true}) {
+      auto mesh = randomMesh(dimensions, 500, flat);
+      compareToRTree(mesh, impl::KDTree(*mesh));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Grid)
+{
+  PRECICE_TEST(1_rank);
+  for (int dimensions : {2, 3}) {
+    for (bool flat : {false, true}) {
+      auto mesh = randomMesh(dimensions, 500, flat);
+      compareToRTree(mesh, impl::UniformGrid(*mesh));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(Degenerate)
+{
+  PRECICE_TEST(1_rank);
+  // Coinciding vertices and less vertices than requested matches
+  PtrMesh mesh(new Mesh("MyMesh", 3, testing::nextMeshID()));
+  mesh->createVertex(Eigen::Vector3d(1, 2, 3));
+  mesh->createVertex(Eigen::Vector3d(1, 2, 3));
+  compareToRTree(mesh, impl::KDTree(*mesh));
+  compareToRTree(mesh, impl::UniformGrid(*mesh));
+
+  PtrMesh     empty(new Mesh("EmptyMesh", 2, testing::nextMeshID()));
+  VertexMatch match;
+  BOOST_TEST(impl::KDTree(*empty).nearest(Eigen::Vector2d(0, 0).data(), 1, &match) == 0);
+  BOOST_TEST(impl::UniformGrid(*empty).nearest(Eigen::Vector2d(0, 0).data(), 1, &match) == 0);
+}
+
+BOOST_AUTO_TEST_CASE(ParallelConstruction)
+{
+  PRECICE_TEST(1_rank);
+  utils::ThreadPool pool(2);
+  auto              mesh = randomMesh(3, 40000, false);
+  compareToRTree(mesh, impl::KDTree(*mesh, &pool));
+  compareToRTree(mesh, impl::UniformGrid(*mesh, &pool));
+}
+
+BOOST_AUTO_TEST_CASE(ParallelConstructionManyThreads)
+{
+  PRECICE_TEST(1_rank);
+  // The smallest mesh built in parallel has 2048 leaves, which are less than four subtrees per thread
+  utils::ThreadPool pool(600);
+  auto              mesh = randomMesh(3, 1 << 15, false);
+  compareToRTree(mesh, impl::KDTree(*mesh, &pool));
+}
+
+BOOST_AUTO_TEST_CASE(SelectBackend)
+{
+  PRECICE_TEST(1_rank);
+  auto mesh = vertexMesh3D();
+  BOOST_TEST((mesh->getIndexBackend() == IndexBackend::RTree));
+  auto rtreeMatches = Index(mesh).getClosestVertices(Eigen::Vector3d(0.9, 0.0, 0.8), 3);
+
+  for (auto backend : {IndexBackend::KDTree, IndexBackend::Grid}) {
+    setIndexBackend(*mesh, backend);
+    Index index(mesh);
+    auto  matches = index.getClosestVertices(Eigen::Vector3d(0.9, 0.0, 0.8), 3);
+    BOOST_TEST(matches.size() == 3);
+    for (int i = 0; i < 3; ++i) {
+      BOOST_TEST(matches[i].index == rtreeMatches[i].index);
+    }
+    BOOST_TEST(index.getVerticesInsideBox(mesh::Vertex(Eigen::Vector3d(0.8, 1, 0), 0), 0.81).size() == 2);
+  }
+
+  // The selection belongs to the mesh, not to its ID
+  mesh::Mesh sameID("SameID", 3, mesh->getID());
+  BOOST_TEST((sameID.getIndexBackend() == IndexBackend::RTree));
+  query::clearCache();
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Backends
+
 BOOST_AUTO_TEST_SUITE(Edge)
 
 BOOST_AUTO_TEST_CASE(Query2DEdge)
@@ -327,17 +582,120 @@ BOOST_AUTO_TEST_SUITE_END() // Triangle
 
 BOOST_AUTO_TEST_SUITE(Cache)
 
-BOOST_AUTO_TEST_CASE(ClearOnChange)
+BOOST_AUTO_TEST_CASE(UpdateOnChange)
 {
   PRECICE_TEST(1_rank);
   PtrMesh mesh(new precice::mesh::Mesh("MyMesh", 2, precice::testing::nextMeshID()));
-  mesh->createVertex(Eigen::Vector2d(0, 0));
+  for (int i = 0; i < 10; ++i) {
+    mesh->createVertex(Eigen::Vector2d(i, 0));
+  }
 
-  // The Cache should clear whenever a mesh changes
+  // The Cache should update whenever a mesh changes
   auto vTree = query::impl::Indexer::instance()->getVertexRTree(mesh);
   BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 1);
+  mesh->createVertex(Eigen::Vector2d(0, 1));
   mesh->meshChanged(*mesh); // Emit signal, that mesh has changed
-  BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 0);
+  BOOST_TEST(query::impl::Indexer::instance()->getCacheSize() == 1);
+  BOOST_TEST(vTree->size() == 11);
+  BOOST_TEST(query::impl::Indexer::instance()->getVertexRTree(mesh) == vTree);
+
+  // The Cache should rebuild when primitives are removed
+  mesh->clear();
+  mesh->createVertex(Eigen::Vector2d(0, 0));
+  auto rebuilt = query::impl::Indexer::instance()->getVertexRTree(mesh);
+  BOOST_TEST(rebuilt != vTree);
+  BOOST_TEST(rebuilt->size() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(AppendIncrementally)
+{
+  PRECICE_TEST(1_rank);
+  auto ptr = fullMesh();
+
+  auto vt = impl::Indexer::instance()->getVertexRTree(ptr);
+  auto et = impl::Indexer::instance()->getEdgeRTree(ptr);
+  auto tt = impl::Indexer::instance()->getTriangleRTree(ptr);
+
+  // Appended primitives are detected without a signal
+  auto &v1 = ptr->vertices()[2];
+  auto &v2 = ptr->vertices()[3];
+  auto &v3 = ptr->createVertex(Eigen::Vector3d(2, -1, 0));
+  auto &e1 = ptr->createEdge(v1, v2);
+  auto &e2 = ptr->createEdge(v2, v3);
+  auto &e3 = ptr->createEdge(v3, v1);
+  auto &t  = ptr->createTriangle(e1, e2, e3);
+
+  BOOST_TEST(impl::Indexer::instance()->getVertexRTree(ptr) == vt);
+  BOOST_TEST(impl::Indexer::instance()->getEdgeRTree(ptr) == et);
+  BOOST_TEST(impl::Indexer::instance()->getTriangleRTree(ptr) == tt);
+  BOOST_TEST(vt->size() == 5);
+  BOOST_TEST(et->size() == 8);
+  BOOST_TEST(tt->size() == 3);
+
+  Index           index(ptr);
+  Eigen::Vector3d location(2, -1.2, 0);
+  BOOST_TEST(index.getClosestVertex(location).index == v3.getID());
+  BOOST_TEST(index.getClosestTriangles(location, 1).front().index == t.getID());
+}
+
+BOOST_AUTO_TEST_CASE(MoveIncrementally)
+{
+  PRECICE_TEST(1_rank);
+  auto mesh = randomMesh(3, 100, false);
+  for (int i = 0; i + 2 < 100; i += 3) {
+    auto &e1 = mesh->createEdge(mesh->vertices()[i], mesh->vertices()[i + 1]);
+    auto &e2 = mesh->createEdge(mesh->vertices()[i + 1], mesh->vertices()[i + 2]);
+    auto &e3 = mesh->createEdge(mesh->vertices()[i + 2], mesh->vertices()[i]);
+    mesh->createTriangle(e1, e2, e3);
+  }
+
+  auto vt = impl::Indexer::instance()->getVertexRTree(mesh);
+  auto et = impl::Indexer::instance()->getEdgeRTree(mesh);
+  auto tt = impl::Indexer::instance()->getTriangleRTree(mesh);
+
+  // Move the first triangle far away
+  const Eigen::Vector3d offset(10, 10, 10);
+  for (int i = 0; i < 3; ++i) {
+    mesh->vertices()[i].setCoords(mesh->vertices()[i].getCoords() + offset);
+  }
+  mesh->meshChanged(*mesh);
+
+  BOOST_TEST(impl::Indexer::instance()->getVertexRTree(mesh) == vt);
+  BOOST_TEST(impl::Indexer::instance()->getEdgeRTree(mesh) == et);
+  BOOST_TEST(impl::Indexer::instance()->getTriangleRTree(mesh) == tt);
+  BOOST_TEST(vt->size() == 100);
+  BOOST_TEST(et->size() == 99);
+  BOOST_TEST(tt->size() == 33);
+
+  Index index(mesh);
+  for (int i = 0; i < 3; ++i) {
+    BOOST_TEST(index.getClosestVertex(mesh->vertices()[i].getCoords()).index == i);
+  }
+  BOOST_TEST(index.getClosestEdges(offset, 3).size() == 3);
+  for (const auto &match : index.getClosestEdges(offset, 3)) {
+    BOOST_TEST(match.index < 3);
+  }
+  BOOST_TEST(index.getClosestTriangles(offset, 1).front().index == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RebuildAfterManyUpdates)
+{
+  PRECICE_TEST(1_rank);
+  auto mesh = randomMesh(2, 100, false);
+  auto vt   = impl::Indexer::instance()->getVertexRTree(mesh);
+
+  // Move more than the rebuild threshold of the vertices
+  const int moved = static_cast<int>(impl::Indexer::REBUILD_THRESHOLD * 100) + 1;
+  for (int i = 0; i < moved; ++i) {
+    mesh->vertices()[i].setCoords(Eigen::Vector2d(2 + i, 0));
+  }
+  mesh->meshChanged(*mesh);
+
+  auto rebuilt = impl::Indexer::instance()->getVertexRTree(mesh);
+  BOOST_TEST(rebuilt != vt);
+  BOOST_TEST(rebuilt->size() == 100);
+  Index index(mesh);
+  BOOST_TEST(index.getClosestVertex(Eigen::Vector2d(2.1, 0)).index == 0);
 }
 
 BOOST_AUTO_TEST_CASE(ClearOnDestruction)
@@ -471,6 +829,29 @@ BOOST_AUTO_TEST_CASE(ProjectionToTriangle)
   }
 }
 
+BOOST_AUTO_TEST_CASE(ProjectionBatched)
+{
+  PRECICE_TEST(1_rank);
+  auto              meshPtr = fullMesh();
+  Index             indexTree(meshPtr);
+  utils::ThreadPool pool(2);
+
+  const Eigen::MatrixXd locations = 2 * Eigen::MatrixXd::Random(3, 600);
+  auto                  matches   = indexTree.findNearestProjectionBatched({locations.data(), static_cast<std::size_t>(locations.size())}, 2, &pool);
+  BOOST_TEST(matches.size() == 600);
+  for (int i = 0; i < locations.cols(); ++i) {
+    auto expected = indexTree.findNearestProjection(Eigen::VectorXd(locations.col(i)), 2);
+    BOOST_TEST(matches[i].distance == expected.distance);
+    const auto &elements         = matches[i].polation.getWeightedElements();
+    const auto &expectedElements = expected.polation.getWeightedElements();
+    BOOST_TEST_REQUIRE(elements.size() == expectedElements.size());
+    for (size_t j = 0; j < elements.size(); ++j) {
+      BOOST_TEST(elements[j].vertexID == expectedElements[j].vertexID);
+      BOOST_TEST(elements[j].weight == expectedElements[j].weight);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Projection
 
 BOOST_AUTO_TEST_SUITE_END() // Mesh
@@ -80,6 +80,8 @@ target_sources(precice
     src/com/MPISinglePortsCommunicationFactory.hpp
     src/com/Request.cpp
     src/com/Request.hpp
+    src/com/SerializedMesh.cpp
+    src/com/SerializedMesh.hpp
     src/com/SharedPointer.hpp
     src/com/SocketCommunication.cpp
     src/com/SocketCommunication.hpp
@@ -175,14 +177,25 @@ target_sources(precice
     src/mapping/NearestNeighborMapping.hpp
     src/mapping/NearestProjectionMapping.cpp
     src/mapping/NearestProjectionMapping.hpp
+    src/mapping/PartitionOfUnityMapping.hpp
     src/mapping/PetRadialBasisFctMapping.hpp
     src/mapping/Polation.cpp
     src/mapping/Polation.hpp
     src/mapping/RadialBasisFctMapping.hpp
     src/mapping/SharedPointer.hpp
+    src/mapping/SparseRadialBasisFctMapping.hpp
     src/mapping/config/MappingConfiguration.cpp
     src/mapping/config/MappingConfiguration.hpp
     src/mapping/impl/BasisFunctions.hpp
+    src/mapping/impl/DenseAlgebra.cpp
+    src/mapping/impl/DenseAlgebra.hpp
+    src/mapping/impl/InterpolationSolver.cpp
+    src/mapping/impl/InterpolationSolver.hpp
+    src/mapping/impl/OperatorCache.cpp
+    src/mapping/impl/OperatorCache.hpp
+    src/mapping/impl/RBFAssembly.hpp
+    src/mapping/impl/SparseInterpolationSolver.cpp
+    src/mapping/impl/SparseInterpolationSolver.hpp
     src/math/barycenter.cpp
     src/math/barycenter.hpp
     src/math/constants.hpp
@@ -214,6 +227,8 @@ target_sources(precice
     src/mesh/config/MeshConfiguration.hpp
     src/partition/Partition.cpp
     src/partition/Partition.hpp
+    src/partition/PartitionCache.cpp
+    src/partition/PartitionCache.hpp
     src/partition/ProvidedPartition.cpp
     src/partition/ProvidedPartition.hpp
     src/partition/ReceivedPartition.cpp
@@ -251,6 +266,10 @@ target_sources(precice
     src/query/impl/Indexer.cpp
     src/query/impl/Indexer.hpp
     src/query/impl/RTreeAdapter.hpp
+    src/query/impl/SpaceFillingCurve.cpp
+    src/query/impl/SpaceFillingCurve.hpp
+    src/query/impl/VertexIndex.cpp
+    src/query/impl/VertexIndex.hpp
     src/utils/ArgumentFormatter.hpp
     src/utils/Dimensions.cpp
     src/utils/Dimensions.hpp
@@ -261,6 +280,8 @@ target_sources(precice
     src/utils/Event.hpp
     src/utils/EventUtils.cpp
     src/utils/EventUtils.hpp
+    src/utils/Fingerprint.cpp
+    src/utils/Fingerprint.hpp
     src/utils/Helpers.cpp
     src/utils/Helpers.hpp
     src/utils/MPI_Mock.hpp
@@ -279,6 +300,8 @@ target_sources(precice
     src/utils/String.hpp
     src/utils/TableWriter.cpp
     src/utils/TableWriter.hpp
+    src/utils/ThreadPool.cpp
+    src/utils/ThreadPool.hpp
     src/utils/TypeNames.hpp
     src/utils/algorithm.hpp
     src/utils/assertion.hpp
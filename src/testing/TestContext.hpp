@@ -131,6 +131,11 @@ struct ConnectionOptions {
    */
   bool useTwoLevelInit = false;
 
+  /** The directory to cache the partitions in, empty to disable the cache
+   * @see M2N::M2N()
+   */
+  std::string partitionCacheDirectory;
+
   /** The type of \ref DistributedCommunication to create
    * @see M2N::M2N()Q
    */
@@ -37,12 +37,17 @@ target_sources(testprecice
     src/io/tests/TXTWriterReaderTest.cpp
     src/m2n/tests/GatherScatterCommunicationTest.cpp
     src/m2n/tests/PointToPointCommunicationTest.cpp
+    src/mapping/tests/InterpolationSolverTest.cpp
     src/mapping/tests/MappingConfigurationTest.cpp
     src/mapping/tests/NearestNeighborMappingTest.cpp
     src/mapping/tests/NearestProjectionMappingTest.cpp
+    src/mapping/tests/OperatorCacheTest.cpp
+    src/mapping/tests/PartitionOfUnityMappingTest.cpp
     src/mapping/tests/PetRadialBasisFctMappingTest.cpp
     src/mapping/tests/PolationTest.cpp
+    src/mapping/tests/RBFAssemblyTest.cpp
     src/mapping/tests/RadialBasisFctMappingTest.cpp
+    src/mapping/tests/SparseOperatorTest.cpp
     src/math/tests/BarycenterTest.cpp
     src/math/tests/DifferencesTest.cpp
     src/math/tests/GeometryTest.cpp
@@ -52,6 +57,7 @@ target_sources(testprecice
     src/mesh/tests/MeshTest.cpp
     src/mesh/tests/TriangleTest.cpp
     src/mesh/tests/VertexTest.cpp
+    src/partition/tests/PartitionCacheTest.cpp
     src/partition/tests/ProvidedPartitionTest.cpp
     src/partition/tests/ReceivedPartitionTest.cpp
     src/partition/tests/fixtures.hpp
@@ -79,6 +85,7 @@ target_sources(testprecice
     src/utils/tests/AlgorithmTest.cpp
     src/utils/tests/DimensionsTest.cpp
     src/utils/tests/EigenHelperFunctionsTest.cpp
+    src/utils/tests/FingerprintTest.cpp
     src/utils/tests/ManageUniqueIDsTest.cpp
     src/utils/tests/MasterSlaveTest.cpp
     src/utils/tests/MultiLockTest.cpp
@@ -86,6 +93,7 @@ target_sources(testprecice
     src/utils/tests/PointerVectorTest.cpp
     src/utils/tests/StatisticsTest.cpp
     src/utils/tests/StringTest.cpp
+    src/utils/tests/ThreadPoolTest.cpp
     src/xml/tests/ParserTest.cpp
     src/xml/tests/PrinterTest.cpp
     src/xml/tests/XMLTest.cpp
@@ -79,7 +79,7 @@ Event::Clock::duration Event::getDuration() const
   return duration;
 }
 
-void Event::addData(const std::string &key, int value)
+void Event::addData(const std::string &key, std::int64_t value)
 {
   data[key].push_back(value);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <utility>
@@ -27,7 +28,7 @@ public:
 
   using StateChanges = std::vector<std::pair<State, Clock::time_point>>;
 
-  using Data = std::map<std::string, std::vector<int>>;
+  using Data = std::map<std::string, std::vector<std::int64_t>>;
 
   /// An Event can't be copied.
   Event(const Event &other) = delete;
@@ -57,8 +58,8 @@ public:
   /// Gets the duration of the event.
   Clock::duration getDuration() const;
 
-  /// Adds named integer data, associated to an event.
-  void addData(const std::string &key, int value);
+  /// Adds named integer data, associated to an event. The values are 64 bit to hold byte counts.
+  void addData(const std::string &key, std::int64_t value);
 
   Data data;
 
@@ -464,7 +464,7 @@ void EventRegistry::collect()
       auto &val = std::get<1>(md);
       MPI_Isend(const_cast<char *>(key.c_str()), key.size(), MPI_CHAR, 0, 0, comm, &req);
       requests.push_back(req);
-      MPI_Isend(const_cast<int *>(val.data()), val.size(), MPI_INT, 0, 0, comm, &req);
+      MPI_Isend(const_cast<std::int64_t *>(val.data()), val.size(), MPI_INT64_T, 0, 0, comm, &req);
       requests.push_back(req);
     }
 
@@ -507,9 +507,9 @@ void EventRegistry::collect()
           std::string key(count, '\0');
           MPI_Recv(&key[0], count, MPI_CHAR, i, MPI_ANY_TAG, comm, MPI_STATUS_IGNORE);
           MPI_Probe(i, MPI_ANY_TAG, comm, &status);
-          MPI_Get_count(&status, MPI_INT, &count);
-          std::vector<int> val(count);
-          MPI_Recv(val.data(), count, MPI_INT, i, MPI_ANY_TAG, comm, MPI_STATUS_IGNORE);
+          MPI_Get_count(&status, MPI_INT64_T, &count);
+          std::vector<std::int64_t> val(count);
+          MPI_Recv(val.data(), count, MPI_INT64_T, i, MPI_ANY_TAG, comm, MPI_STATUS_IGNORE);
           dataMap[key] = val;
         }
 
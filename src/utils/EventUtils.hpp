@@ -57,7 +57,7 @@ public:
 private:
   std::string                             name;
   long                                    count = 0;
-  std::map<std::string, std::vector<int>> data;
+  Event::Data                             data;
 };
 
 /// Holds all EventData of one particular rank
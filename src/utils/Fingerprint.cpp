@@ -0,0 +1,32 @@
+#include "utils/Fingerprint.hpp"
+
+namespace precice {
+namespace utils {
+
+Fingerprint::Fingerprint(bool keepKey)
+    : _keepKey(keepKey)
+{
+}
+
+void Fingerprint::add(const void *data, std::size_t bytes)
+{
+  constexpr std::uint64_t prime = 1099511628211ull;
+
+  const auto *begin = static_cast<const unsigned char *>(data);
+  for (std::size_t i = 0; i < bytes; ++i) {
+    _hash ^= begin[i];
+    _hash *= prime;
+  }
+  if (_keepKey) {
+    _key.insert(_key.end(), static_cast<const char *>(data), static_cast<const char *>(data) + bytes);
+  }
+}
+
+void Fingerprint::add(const std::string &value)
+{
+  add(value.size());
+  add(value.data(), value.size());
+}
+
+} // namespace utils
+} // namespace precice
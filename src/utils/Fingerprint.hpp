@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief Hash of everything a cached result depends on.
+ *
+ * Uses the 64 bit FNV-1a hash of the raw bytes. Fingerprints that keep their key additionally
+ * store all added bytes, such that fingerprints with colliding hashes can be told apart.
+ * Fingerprints that are only compared by their hash should not keep the key.
+ */
+class Fingerprint {
+public:
+  /// Constructor, a fingerprint without key only accumulates the hash
+  explicit Fingerprint(bool keepKey = true);
+
+  /// Adds the given bytes
+  void add(const void *data, std::size_t bytes);
+
+  /// Adds the bytes of a trivially copyable value
+  template <typename T>
+  void add(const T &value)
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be hashed bytewise.");
+    add(&value, sizeof(T));
+  }
+
+  void add(const std::string &value);
+
+  std::uint64_t value() const
+  {
+    return _hash;
+  }
+
+  bool keepsKey() const
+  {
+    return _keepKey;
+  }
+
+  /// Returns all added bytes, empty if the key is not kept
+  const std::vector<char> &key() const
+  {
+    return _key;
+  }
+
+private:
+  std::uint64_t _hash = 14695981039346656037ull;
+
+  bool _keepKey;
+
+  std::vector<char> _key;
+};
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,108 @@
+#include "utils/ThreadPool.hpp"
+#include <algorithm>
+#include "utils/assertion.hpp"
+
+namespace precice {
+namespace utils {
+
+ThreadPool::ThreadPool(int threads)
+{
+  PRECICE_ASSERT(threads >= 0, threads);
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  for (int i = 1; i < threads; ++i) {
+    _workers.emplace_back([this] { work(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop = true;
+  }
+  _start.notify_all();
+  for (auto &worker : _workers) {
+    worker.join();
+  }
+}
+
+void ThreadPool::parallelFor(std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grainSize, const Body &body)
+{
+  PRECICE_ASSERT(grainSize > 0, grainSize);
+  if (begin >= end) {
+    return;
+  }
+  if (_workers.empty() || end - begin <= grainSize) {
+    for (std::ptrdiff_t chunk = begin; chunk < end; chunk += grainSize) {
+      body(chunk, std::min(chunk + grainSize, end));
+    }
+    return;
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  PRECICE_ASSERT(_loop.body == nullptr, "Loops of a thread pool must not be nested.");
+  _loop = Loop{&body, begin, end, grainSize, 1, nullptr};
+  ++_generation;
+  _start.notify_all();
+
+  runChunks(lock);
+  --_loop.active;
+  _finished.wait(lock, [this] { return _loop.active == 0; });
+
+  const auto error = _loop.error;
+  _loop            = Loop{};
+  lock.unlock();
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+void ThreadPool::work()
+{
+  std::size_t                  generation = 0;
+  std::unique_lock<std::mutex> lock(_mutex);
+  while (true) {
+    _start.wait(lock, [&] { return _stop || (_generation != generation && _loop.body != nullptr); });
+    if (_stop) {
+      return;
+    }
+    generation = _generation;
+    ++_loop.active;
+    runChunks(lock);
+    if (--_loop.active == 0) {
+      _finished.notify_one();
+    }
+  }
+}
+
+void ThreadPool::runChunks(std::unique_lock<std::mutex> &lock)
+{
+  while (_loop.next < _loop.end) {
+    const std::ptrdiff_t begin = _loop.next;
+    const std::ptrdiff_t end   = std::min(begin + _loop.grainSize, _loop.end);
+    _loop.next                 = end;
+    const Body &body           = *_loop.body;
+
+    lock.unlock();
+    std::exception_ptr error;
+    try {
+      body(begin, end);
+    } catch (...) {
+      error = std::current_exception();
+    }
+    lock.lock();
+
+    if (error) {
+      if (not _loop.error) {
+        _loop.error = error;
+      }
+      // Skip the remaining chunks
+      _loop.next = _loop.end;
+    }
+  }
+}
+
+} // namespace utils
+} // namespace precice
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace precice {
+namespace utils {
+
+/**
+ * @brief A fixed set of threads, which executes loops in parallel within a rank.
+ *
+ * The calling thread takes part in every loop, hence a pool of size one does not
+ * start any thread and runs all loops inline.
+ * Loops of a pool must not be nested and the pool must only be used from one thread at a time.
+ */
+class ThreadPool {
+public:
+  /// The body of a loop, called with the half-open range [begin, end) of a chunk
+  using Body = std::function<void(std::ptrdiff_t begin, std::ptrdiff_t end)>;
+
+  /**
+   * @brief Starts the threads of the pool.
+   *
+   * @param[in] threads Number of threads including the calling one, 0 uses all hardware threads.
+   */
+  explicit ThreadPool(int threads = 1);
+
+  /// Stops and joins all threads
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// Returns the number of threads including the calling one
+  int size() const
+  {
+    return static_cast<int>(_workers.size()) + 1;
+  }
+
+  /**
+   * @brief Calls body on chunks of at most grainSize iterations, which cover [begin, end).
+   *
+   * Chunks are distributed dynamically, such that uneven chunks are balanced.
+   * Blocks until all chunks are processed. The first exception thrown by body is rethrown.
+   */
+  void parallelFor(std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grainSize, const Body &body);
+
+private:
+  /// The loop currently executed by the pool
+  struct Loop {
+    const Body *       body;
+    std::ptrdiff_t     next;
+    std::ptrdiff_t     end;
+    std::ptrdiff_t     grainSize;
+    int                active;
+    std::exception_ptr error;
+  };
+
+  std::vector<std::thread> _workers;
+
+  std::mutex _mutex;
+
+  /// Notifies the workers about a new loop or the shutdown
+  std::condition_variable _start;
+
+  /// Notifies the caller about the end of the loop
+  std::condition_variable _finished;
+
+  Loop _loop{};
+
+  /// Incremented for every loop, lets workers distinguish new loops from spurious wake-ups
+  std::size_t _generation = 0;
+
+  bool _stop = false;
+
+  void work();
+
+  /// Processes chunks of the current loop until none is left, expects a locked mutex
+  void runChunks(std::unique_lock<std::mutex> &lock);
+};
+
+} // namespace utils
+} // namespace precice
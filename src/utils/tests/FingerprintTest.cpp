@@ -0,0 +1,58 @@
+#include <string>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/Fingerprint.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(FingerprintTests)
+
+BOOST_AUTO_TEST_CASE(Values)
+{
+  PRECICE_TEST(1_rank);
+  Fingerprint original;
+  original.add(42);
+  original.add(std::string("Mesh"));
+  Fingerprint same;
+  same.add(42);
+  same.add(std::string("Mesh"));
+  BOOST_TEST(original.value() == same.value());
+  BOOST_TEST(original.key() == same.key());
+
+  // The order of the values matters
+  Fingerprint swapped;
+  swapped.add(std::string("Mesh"));
+  swapped.add(42);
+  BOOST_TEST(original.value() != swapped.value());
+
+  // Strings are prefixed by their length
+  Fingerprint split;
+  split.add(std::string("Me"));
+  split.add(std::string("sh"));
+  Fingerprint joined;
+  joined.add(std::string("Mesh"));
+  BOOST_TEST(split.value() != joined.value());
+}
+
+BOOST_AUTO_TEST_CASE(Key)
+{
+  PRECICE_TEST(1_rank);
+  Fingerprint withKey;
+  withKey.add(42);
+  withKey.add(0.5);
+  BOOST_TEST(withKey.keepsKey());
+  BOOST_TEST(withKey.key().size() == sizeof(int) + sizeof(double));
+
+  // Fingerprints without key only accumulate the same hash
+  Fingerprint hashOnly(false);
+  hashOnly.add(42);
+  hashOnly.add(0.5);
+  BOOST_TEST(not hashOnly.keepsKey());
+  BOOST_TEST(hashOnly.key().empty());
+  BOOST_TEST(hashOnly.value() == withKey.value());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // FingerprintTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
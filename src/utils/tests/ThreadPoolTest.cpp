@@ -0,0 +1,81 @@
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include "testing/TestContext.hpp"
+#include "testing/Testing.hpp"
+#include "utils/ThreadPool.hpp"
+
+using namespace precice;
+using namespace precice::utils;
+
+BOOST_AUTO_TEST_SUITE(UtilsTests)
+BOOST_AUTO_TEST_SUITE(ThreadPoolTests)
+
+namespace {
+/// Checks that every iteration of [begin, end) is executed exactly once
+void testCoverage(ThreadPool &pool, std::ptrdiff_t begin, std::ptrdiff_t end, std::ptrdiff_t grainSize)
+{
+  std::vector<std::atomic<int>> counts(end);
+  for (auto &count : counts) {
+    count = 0;
+  }
+  pool.parallelFor(begin, end, grainSize, [&](std::ptrdiff_t chunkBegin, std::ptrdiff_t chunkEnd) {
+    BOOST_REQUIRE(chunkEnd - chunkBegin <= grainSize);
+    for (std::ptrdiff_t i = chunkBegin; i < chunkEnd; ++i) {
+      ++counts[i];
+    }
+  });
+  for (std::ptrdiff_t i = 0; i < end; ++i) {
+    BOOST_TEST(counts[i] == (i < begin ? 0 : 1));
+  }
+}
+} // namespace
+
+BOOST_AUTO_TEST_CASE(Serial)
+{
+  PRECICE_TEST(1_rank);
+  ThreadPool pool;
+  BOOST_TEST(pool.size() == 1);
+  testCoverage(pool, 0, 100, 7);
+  testCoverage(pool, 10, 11, 4);
+}
+
+BOOST_AUTO_TEST_CASE(Threaded)
+{
+  PRECICE_TEST(1_rank);
+  ThreadPool pool(4);
+  BOOST_TEST(pool.size() == 4);
+  // The pool is reused for many loops of different shapes
+  for (int repetition = 0; repetition < 20; ++repetition) {
+    testCoverage(pool, 0, 1000, 3);
+    testCoverage(pool, 5, 1000, 64);
+    testCoverage(pool, 0, 2, 1);
+  }
+  testCoverage(pool, 0, 0, 1);
+}
+
+BOOST_AUTO_TEST_CASE(AllHardwareThreads)
+{
+  PRECICE_TEST(1_rank);
+  ThreadPool pool(0);
+  BOOST_TEST(pool.size() >= 1);
+  testCoverage(pool, 0, 257, 16);
+}
+
+BOOST_AUTO_TEST_CASE(Exception)
+{
+  PRECICE_TEST(1_rank);
+  ThreadPool pool(3);
+  const auto throwing = [](std::ptrdiff_t begin, std::ptrdiff_t) {
+    if (begin == 42) {
+      throw std::runtime_error("Chunk failed");
+    }
+  };
+  BOOST_CHECK_THROW(pool.parallelFor(0, 100, 1, throwing), std::runtime_error);
+  // The pool remains usable
+  testCoverage(pool, 0, 100, 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // ThreadPoolTests
+BOOST_AUTO_TEST_SUITE_END() // UtilsTests
@@ -7,7 +7,7 @@ import subprocess
 import collections
 
 """ Files matching this pattern will be filtered out """
-IGNORE_PATTERNS = ["drivers"]
+IGNORE_PATTERNS = ["benchmarks", "drivers"]
 
 """ Configured files, which should be ignored by git """
 CONFIGURED_SOURCES = ["${CMAKE_BINARY_DIR}/src/precice/impl/versions.hpp", "${CMAKE_BINARY_DIR}/src/precice/impl/versions.cpp"]